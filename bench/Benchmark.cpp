@@ -0,0 +1,228 @@
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "Algorithms.h"
+#include "FlowReport.h"
+#include "GraphArena.h"
+#include "Network.h"
+#include "NetworkParser.h"
+#include "ResidualGraph.h"
+
+namespace {
+	using MaxFlowAlgorithm = std::function<int(ResidualGraph&, ResidualGraph::NodeId, ResidualGraph::NodeId)>;
+
+	/**
+	 * \struct Timing
+	 * \brief Tempos de uma fase em todas as repetições, em milissegundos.
+	 */
+	struct Timing {
+		double min;
+		double median;
+	};
+
+	/**
+	 * \brief Executa 'phase' 'repeat' vezes e retorna o menor tempo e a mediana.
+	 */
+	Timing measure(std::size_t repeat, const std::function<void()>& phase) {
+		std::vector<double> samples;
+		for (std::size_t i = 0; i < repeat; i++) {
+			auto start = std::chrono::steady_clock::now();
+			phase();
+			std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+			samples.push_back(elapsed.count());
+		}
+		std::sort(samples.begin(), samples.end());
+		return { samples.front(), samples[samples.size() / 2] };
+	}
+
+	/**
+	 * \brief Separa uma lista "a,b,c".
+	 */
+	std::vector<std::string> split(const std::string& list) {
+		std::vector<std::string> items;
+		std::stringstream stream(list);
+		for (std::string item; std::getline(stream, item, ',');)
+			if (!item.empty())
+				items.push_back(item);
+		return items;
+	}
+}
+
+/**
+ * \brief Mede separadamente a leitura, a montagem da rede residual, cada algoritmo de fluxo máximo
+ *        e o relatório, para cada arquivo de entrada.
+ *
+ * Os resultados são acrescentados a um arquivo CSV (uma linha por arquivo, fase e algoritmo),
+ * com um rótulo livre (por exemplo, o commit) para comparar execuções ao longo do tempo.
+ *
+ * As renumerações de nós de '--orders' (BFS e Cuthill-McKee invertido, ambas por padrão) são
+ * medidas com os mesmos algoritmos, nas linhas "algoritmo/ordem", e o ganho sobre a ordem da
+ * entrada (razão entre as medianas) é mostrado na saída padrão.
+ *
+ * Uso: bench.out [--repeat=N] [--threads=N] [--algorithms=a,b] [--orders=bfs,rcm] [--label=TEXTO] [--output=ARQ] entrada...
+ */
+int main(int argc, char* argv[]) {
+	std::size_t repeat = 3;
+	std::size_t threadCount = 0;
+	std::string label = "local";
+	std::string outputPath = "bench/results.csv";
+	std::vector<std::string> selected = { "edmonds-karp", "edmonds-karp-diropt", "edmonds-karp-bidir", "push-relabel", "dinic",
+		"capacity-scaling", "capacity-scaling-diropt", "capacity-scaling-bidir", "parallel-push-relabel" };
+	std::vector<std::string> orders = { "bfs", "rcm" };
+	std::vector<std::string> inputs;
+
+	try {
+		for (int i = 1; i < argc; i++) {
+			std::string arg = argv[i];
+			std::size_t equals = arg.find('=');
+			std::string name = arg.substr(0, equals);
+			std::string value = equals == std::string::npos ? "" : arg.substr(equals + 1);
+
+			if (name == "--repeat")
+				repeat = std::max<std::size_t>(1, std::stoul(value));
+			else if (name == "--threads")
+				threadCount = std::stoul(value);
+			else if (name == "--algorithms")
+				selected = split(value);
+			else if (name == "--orders")
+				orders = split(value);
+			else if (name == "--label")
+				label = value;
+			else if (name == "--output")
+				outputPath = value;
+			else if (arg.rfind("--", 0) != 0)
+				inputs.push_back(arg);
+			else
+				throw std::runtime_error("opção desconhecida: " + arg);
+		}
+		if (inputs.empty())
+			throw std::runtime_error("nenhuma entrada");
+		for (const std::string& order : orders)
+			if (order != "bfs" && order != "rcm")
+				throw std::runtime_error("ordem desconhecida: " + order);
+	}
+	catch (const std::exception& error) {
+		std::cerr << argv[0] << ": " << error.what() << std::endl;
+		std::cerr << "Uso: " << argv[0] << " [--repeat=N] [--threads=N] [--algorithms=a,b] [--orders=bfs,rcm] [--label=TEXTO] [--output=ARQ] entrada..." << std::endl;
+		return 1;
+	}
+
+	const std::vector<std::pair<std::string, MaxFlowAlgorithm>> algorithms = {
+		{ "edmonds-karp", [](ResidualGraph& network, ResidualGraph::NodeId source, ResidualGraph::NodeId sink) {
+			return Algorithms::EdmondKarp(network, source, sink); } },
+		{ "edmonds-karp-diropt", [](ResidualGraph& network, ResidualGraph::NodeId source, ResidualGraph::NodeId sink) {
+			return Algorithms::EdmondKarp(network, source, sink, Algorithms::BfsStrategy::DirectionOptimizing); } },
+		{ "edmonds-karp-bidir", [](ResidualGraph& network, ResidualGraph::NodeId source, ResidualGraph::NodeId sink) {
+			return Algorithms::EdmondKarp(network, source, sink, Algorithms::BfsStrategy::Bidirectional); } },
+		{ "push-relabel", [](ResidualGraph& network, ResidualGraph::NodeId source, ResidualGraph::NodeId sink) {
+			return Algorithms::PushRelabel(network, source, sink); } },
+		{ "dinic", [](ResidualGraph& network, ResidualGraph::NodeId source, ResidualGraph::NodeId sink) {
+			return Algorithms::Dinic(network, source, sink); } },
+		{ "capacity-scaling", [](ResidualGraph& network, ResidualGraph::NodeId source, ResidualGraph::NodeId sink) {
+			return Algorithms::CapacityScaling(network, source, sink); } },
+		{ "capacity-scaling-diropt", [](ResidualGraph& network, ResidualGraph::NodeId source, ResidualGraph::NodeId sink) {
+			return Algorithms::CapacityScaling(network, source, sink, Algorithms::BfsStrategy::DirectionOptimizing); } },
+		{ "capacity-scaling-bidir", [](ResidualGraph& network, ResidualGraph::NodeId source, ResidualGraph::NodeId sink) {
+			return Algorithms::CapacityScaling(network, source, sink, Algorithms::BfsStrategy::Bidirectional); } },
+		{ "parallel-push-relabel", [threadCount](ResidualGraph& network, ResidualGraph::NodeId source, ResidualGraph::NodeId sink) {
+			return Algorithms::ParallelPushRelabel(network, source, sink, threadCount); } },
+	};
+
+	bool newFile = !std::ifstream(outputPath).good();
+	std::ofstream results(outputPath, std::ios::app);
+	if (!results) {
+		std::cerr << argv[0] << ": Erro ao criar arquivo: " << outputPath << std::endl;
+		return 1;
+	}
+	if (newFile)
+		results << "label,input,nodes,edges,phase,algorithm,repeat,min_ms,median_ms,max_flow\n";
+
+	std::cout << std::left << std::setw(28) << "entrada" << std::setw(10) << "fase" << std::setw(24) << "algoritmo"
+		<< std::right << std::setw(12) << "min (ms)" << std::setw(12) << "mediana" << '\n';
+
+	for (const std::string& input : inputs) {
+		Network network;
+		try {
+			network = NetworkParser::parseFile(input);
+		}
+		catch (const std::runtime_error& error) {
+			std::cerr << input << ": " << error.what() << std::endl;
+			return 1;
+		}
+
+		auto record = [&](const std::string& phase, const std::string& algorithm, Timing timing, int maxFlow) {
+			results << label << ',' << input << ',' << network.getNodeCount() << ',' << network.getEdgeCount() << ','
+				<< phase << ',' << algorithm << ',' << repeat << ',' << timing.min << ',' << timing.median << ','
+				<< maxFlow << '\n';
+			std::cout << std::left << std::setw(28) << input.substr(input.find_last_of('/') + 1) << std::setw(10) << phase
+				<< std::setw(24) << algorithm << std::right << std::fixed << std::setprecision(2)
+				<< std::setw(12) << timing.min << std::setw(12) << timing.median << '\n';
+		};
+
+		record("parse", "", measure(repeat, [&]() { NetworkParser::parseFile(input); }), 0);
+
+		ResidualGraph graph(network);
+		record("build", "", measure(repeat, [&]() { ResidualGraph rebuilt(network); }), 0);
+		record("build", "graph-arena", measure(repeat, [&]() { GraphArena arena(network); }), 0);
+		{
+			GraphArena arena(network);
+			std::cout << "  memória por conexão: " << std::fixed << std::setprecision(1)
+				<< static_cast<double>(graph.getMemoryUsage()) / static_cast<double>(graph.getEdgeCount())
+				<< " bytes (rede residual), " << arena.getBytesPerEdge() << " bytes (GraphArena)\n";
+		}
+
+		ResidualGraph::NodeId source = graph.getNodeId(network.getSourceIndex());
+		ResidualGraph::NodeId sink = graph.getNodeId(network.getSinkIndex());
+		int maxFlow = 0;
+		std::map<std::string, double> inputMedians;
+		for (const auto& [name, algorithm] : algorithms) {
+			if (std::find(selected.begin(), selected.end(), name) == selected.end())
+				continue;
+			// O tempo de restaurar as capacidades residuais entra na medida; é O(E) e pequeno
+			// diante do próprio algoritmo.
+			Timing timing = measure(repeat, [&]() {
+				graph.reset();
+				maxFlow = algorithm(graph, source, sink);
+			});
+			record("solve", name, timing, maxFlow);
+			inputMedians[name] = timing.median;
+		}
+
+		for (const std::string& orderName : orders) {
+			NodeOrder order = orderName == "bfs" ? NodeOrder::Bfs : NodeOrder::ReverseCuthillMcKee;
+			record("build", "order-" + orderName, measure(repeat, [&]() { ResidualGraph rebuilt(network, order); }), 0);
+
+			ResidualGraph reordered(network, order);
+			ResidualGraph::NodeId reorderedSource = reordered.getNodeId(network.getSourceIndex());
+			ResidualGraph::NodeId reorderedSink = reordered.getNodeId(network.getSinkIndex());
+			for (const auto& [name, algorithm] : algorithms) {
+				if (std::find(selected.begin(), selected.end(), name) == selected.end())
+					continue;
+				int reorderedFlow = 0;
+				Timing timing = measure(repeat, [&]() {
+					reordered.reset();
+					reorderedFlow = algorithm(reordered, reorderedSource, reorderedSink);
+				});
+				record("solve", name + "/" + orderName, timing, reorderedFlow);
+				std::cout << "  ganho sobre a ordem da entrada: " << std::setprecision(2)
+					<< inputMedians[name] / std::max(timing.median, 1e-9) << "x\n";
+			}
+		}
+
+		record("report", "", measure(repeat, [&]() {
+			std::ostringstream report;
+			FlowReport::write(report, network, graph, maxFlow);
+		}), maxFlow);
+	}
+
+	return 0;
+}
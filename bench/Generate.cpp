@@ -0,0 +1,50 @@
+#include <iostream>
+#include <stdexcept>
+#include <string>
+
+#include "Network.h"
+#include "NetworkGenerator.h"
+
+/**
+ * \brief Gera uma rede sintética no formato texto lido pelo programa principal.
+ *
+ * Uso: generate.out [--topology=layered|geometric|grid|mesh|adversarial] [--nodes=V] [--edges=E]
+ *                   [--min-capacity=N] [--max-capacity=N] [--seed=N]
+ */
+int main(int argc, char* argv[]) {
+	NetworkGenerator::Options options;
+	try {
+		for (int i = 1; i < argc; i++) {
+			std::string arg = argv[i];
+			std::size_t equals = arg.find('=');
+			std::string name = arg.substr(0, equals);
+			std::string value = equals == std::string::npos ? "" : arg.substr(equals + 1);
+
+			if (name == "--topology")
+				options.topology = NetworkGenerator::parseTopology(value);
+			else if (name == "--nodes")
+				options.nodeCount = std::stoul(value);
+			else if (name == "--edges")
+				options.edgeCount = std::stoul(value);
+			else if (name == "--min-capacity")
+				options.minCapacity = std::stoi(value);
+			else if (name == "--max-capacity")
+				options.maxCapacity = std::stoi(value);
+			else if (name == "--seed")
+				options.seed = std::stoull(value);
+			else
+				throw std::runtime_error("opção desconhecida: " + arg);
+		}
+
+		Network network = NetworkGenerator::generate(options);
+		network.print(std::cout);
+		std::cout.flush();
+	}
+	catch (const std::exception& error) {
+		std::cerr << argv[0] << ": " << error.what() << std::endl;
+		std::cerr << "Uso: " << argv[0] << " [--topology=layered|geometric|grid|mesh|adversarial] [--nodes=V] [--edges=E]"
+			<< " [--min-capacity=N] [--max-capacity=N] [--seed=N]" << std::endl;
+		return 1;
+	}
+	return 0;
+}
@@ -1,18 +1,56 @@
 #ifndef ALGORITHMS_H
 #define ALGORITHMS_H
 
+#include <cstdint>
+#include <functional>
 #include <iostream>
 #include <unordered_map>
+#include <vector>
 
 #include "Graph.h"
+#include "ResidualGraph.h"
+
+class ThreadPool;
+
+/**
+ * \struct MinCostFlow
+ * \brief Resultado de 'Algorithms::MinCostMaxFlow': o fluxo mximo e o seu custo total.
+ */
+template <typename Capacity>
+struct MinCostFlow {
+	Capacity flow;
+	std::int64_t cost;
+};
 
 /**
  * \class Algorithms
  *
  * \brief Algotimos aprendidos a partir do livro Algorithm Design de Jon Kleinberg
+ *
+ * As verses sobre 'BasicResidualGraph' so modelos no tipo de capacidade ('CapacityTraits'),
+ * instanciados para 'int', 'std::int64_t' e 'double'; as verses sobre 'Graph' usam 'int'.
  */
 class Algorithms {
 public:
+	/**
+	 * \brief Estratgia da BFS que procura os caminhos aumentantes.
+	 *
+	 * 'TopDown' expande cada n da fronteira pelos seus arcos de sada. 'DirectionOptimizing'
+	 * alterna para a varredura de baixo para cima quando a fronteira fica grande: cada n ainda
+	 * no visitado procura, entre os seus arcos de entrada com capacidade residual, um que venha da
+	 * fronteira (guardada em um mapa de bits), e para no primeiro. Em redes largas e rasas a
+	 * fronteira cobre boa parte da rede em poucos nveis, e a varredura de baixo para cima evita
+	 * examinar arcos que levam a ns j visitados. Nas buscas de caminhos aumentantes, porm, a
+	 * troca quase nunca compensa: nas redes do 'make bench' a estratgia foi mais lenta que
+	 * 'TopDown', que continua sendo o padro.
+	 *
+	 * 'Bidirectional' cresce uma fronteira a partir da origem e outra a partir do sumidouro (por
+	 * arcos de entrada), expandindo a cada passo o nvel inteiro da menor, e para quando elas se
+	 * encontram. O caminho devolvido continua sendo um caminho aumentante mnimo, e em redes
+	 * profundas as duas buscas juntas visitam bem menos ns que uma busca a partir da origem.
+	 */
+	enum class BfsStrategy { TopDown, DirectionOptimizing, Bidirectional };
+
 	/**
 	 * \brief Implementao do algoritmo de Edmonds-Karp.
 	 *
@@ -32,6 +70,292 @@ public:
 	 *               leva tempo O(V + E).
 	 */
 	static int EdmondKarp(Graph* graph, GraphNode* source, GraphNode* sink);
+
+	/**
+	 * \brief Implementao do algoritmo de Edmonds-Karp sobre uma rede residual compacta.
+	 *
+	 * \details Mesmo algoritmo da verso baseada em 'Graph', mas executado diretamente sobre os
+	 *          vetores de 'ResidualGraph'. O fluxo encontrado fica registrado nas capacidades
+	 *          residuais da rede, que pode ser reutilizada para as anlises posteriores.
+	 *
+	 * \param network A rede residual onde o fluxo ser calculado.
+	 * \param source Identificador denso do n de origem.
+	 * \param sink Identificador denso do n de destino.
+	 * \param strategy A estratgia da BFS.
+	 *
+	 * \return O valor do fluxo mximo encontrado.
+	 */
+	template <typename Capacity>
+	static Capacity EdmondKarp(BasicResidualGraph<Capacity>& network, ResidualGraph::NodeId source, ResidualGraph::NodeId sink,
+		BfsStrategy strategy = BfsStrategy::TopDown);
+
+	/**
+	 * \brief Implementao do mtodo de caminhos aumentantes com escalonamento de capacidade.
+	 *
+	 * \details Variao do Edmonds-Karp para redes com capacidades de ordens de grandeza muito
+	 *          diferentes. A cada fase a BFS s percorre arcos com capacidade residual de ao menos
+	 *          'delta', de modo que cada aumento envia no mnimo 'delta' unidades; quando no h
+	 *          mais caminhos, 'delta'  dividido por dois, at 1. O 'delta' inicial  a maior potncia
+	 *          de dois que no supera a maior capacidade finita: os arcos de capacidade INT_MAX (as
+	 *          arestas da super origem) so tratados como infinitos e no causam estouro.
+	 *
+	 * \param graph Ponteiro para o grafo onde o fluxo ser calculado.
+	 * \param source Ponteiro para o n de origem no grafo.
+	 * \param sink Ponteiro para o n de destino no grafo.
+	 *
+	 * \return O valor do fluxo mximo encontrado.
+	 *
+	 * \complexidade O(E^2 log U), onde U  a maior capacidade finita: h O(E) aumentos em cada
+	 *               uma das O(log U) fases, cada um com uma BFS O(V + E).
+	 */
+	static int CapacityScaling(Graph* graph, GraphNode* source, GraphNode* sink);
+
+	/**
+	 * \brief Implementao do escalonamento de capacidade sobre uma rede residual compacta.
+	 *
+	 * \details O fluxo j presente na rede  mantido, e o valor retornado  o fluxo adicional enviado.
+	 *
+	 * \param network A rede residual onde o fluxo ser calculado.
+	 * \param source Identificador denso do n de origem.
+	 * \param sink Identificador denso do n de destino.
+	 * \param strategy A estratgia da BFS.
+	 *
+	 * \return O valor do fluxo mximo encontrado.
+	 */
+	template <typename Capacity>
+	static Capacity CapacityScaling(BasicResidualGraph<Capacity>& network, ResidualGraph::NodeId source, ResidualGraph::NodeId sink,
+		BfsStrategy strategy = BfsStrategy::TopDown);
+
+	/**
+	 * \brief Implementao do algoritmo push-relabel com seleo do n ativo de maior altura.
+	 *
+	 * \details Em vez de buscar caminhos aumentantes, o algoritmo mantm um pr-fluxo e empurra o
+	 *          excesso de cada n para vizinhos mais baixos, sempre descarregando o n ativo mais alto.
+	 *          A reetiquetagem global (BFS reversa a partir do sumidouro)  refeita periodicamente, e a
+	 *          heurstica de lacuna descarta os ns que deixaram de alcanar o sumidouro. Ao final o
+	 *          excesso restante  devolvido  origem, deixando um fluxo vlido nas arestas.
+	 *
+	 * \param graph Ponteiro para o grafo onde o fluxo ser calculado.
+	 * \param source Ponteiro para o n de origem no grafo.
+	 * \param sink Ponteiro para o n de destino no grafo.
+	 *
+	 * \return O valor do fluxo mximo encontrado.
+	 *
+	 * \complexidade O(V^2 sqrt(E)).
+	 */
+	static int PushRelabel(Graph* graph, GraphNode* source, GraphNode* sink);
+
+	/**
+	 * \brief Implementao do algoritmo push-relabel sobre uma rede residual compacta.
+	 *
+	 * \param network A rede residual onde o fluxo ser calculado.
+	 * \param source Identificador denso do n de origem.
+	 * \param sink Identificador denso do n de destino.
+	 *
+	 * \return O valor do fluxo mximo encontrado.
+	 */
+	template <typename Capacity>
+	static Capacity PushRelabel(BasicResidualGraph<Capacity>& network, ResidualGraph::NodeId source, ResidualGraph::NodeId sink);
+
+	/**
+	 * \brief Implementao do algoritmo de Dinic.
+	 *
+	 * \details A cada fase uma BFS constri o grafo de nveis (distncia at a origem no grafo
+	 *          residual) e uma busca em profundidade iterativa envia um fluxo bloqueante apenas por
+	 *          arcos que avanam um nvel. Cada n mantm um arco corrente, e nenhum arco 
+	 *          examinado duas vezes na mesma fase.
+	 *
+	 * \param graph Ponteiro para o grafo onde o fluxo ser calculado.
+	 * \param source Ponteiro para o n de origem no grafo.
+	 * \param sink Ponteiro para o n de destino no grafo.
+	 *
+	 * \return O valor do fluxo mximo encontrado.
+	 *
+	 * \complexidade O(V^2 E) no caso geral e O(E sqrt(V)) em redes de capacidade unitria.
+	 */
+	static int Dinic(Graph* graph, GraphNode* source, GraphNode* sink);
+
+	/**
+	 * \brief Implementao do algoritmo de Dinic sobre uma rede residual compacta.
+	 *
+	 * \details O fluxo j presente na rede  mantido: o algoritmo parte das capacidades residuais
+	 *          atuais, e o valor retornado  o fluxo adicional enviado ('IncrementalMaxFlow').
+	 *
+	 * \param network A rede residual onde o fluxo ser calculado.
+	 * \param source Identificador denso do n de origem.
+	 * \param sink Identificador denso do n de destino.
+	 *
+	 * \return O valor do fluxo mximo encontrado.
+	 */
+	template <typename Capacity>
+	static Capacity Dinic(BasicResidualGraph<Capacity>& network, ResidualGraph::NodeId source, ResidualGraph::NodeId sink);
+
+	/**
+	 * \brief Implementao paralela sncrona do algoritmo push-relabel.
+	 *
+	 * \details A cada rodada, todos os ns ativos empurram seu excesso em paralelo usando as alturas
+	 *          do incio da rodada e, em seguida, os que ficaram bloqueados so reetiquetados em
+	 *          paralelo. Um arco s  admissvel em um sentido, ento as threads nunca alteram a mesma
+	 *          capacidade residual; o excesso recebido  acumulado com somas atmicas. A reetiquetagem
+	 *          global  uma BFS paralela por nveis. Ao final o excesso restante  devolvido  origem,
+	 *          deixando um fluxo vlido nas arestas.
+	 *
+	 * \param graph Ponteiro para o grafo onde o fluxo ser calculado.
+	 * \param source Ponteiro para o n de origem no grafo.
+	 * \param sink Ponteiro para o n de destino no grafo.
+	 * \param threadCount Nmero de threads; zero usa todas as disponveis.
+	 *
+	 * \return O valor do fluxo mximo encontrado.
+	 *
+	 * \complexidade O(V^2 E) rodadas no pior caso; cada rodada divide o trabalho entre as threads.
+	 */
+	static int ParallelPushRelabel(Graph* graph, GraphNode* source, GraphNode* sink, std::size_t threadCount = 0);
+
+	/**
+	 * \brief Implementao paralela do push-relabel sobre uma rede residual compacta.
+	 *
+	 * \param network A rede residual onde o fluxo ser calculado.
+	 * \param source Identificador denso do n de origem.
+	 * \param sink Identificador denso do n de destino.
+	 * \param threadCount Nmero de threads; zero usa todas as disponveis.
+	 *
+	 * \return O valor do fluxo mximo encontrado.
+	 */
+	template <typename Capacity>
+	static Capacity ParallelPushRelabel(BasicResidualGraph<Capacity>& network, ResidualGraph::NodeId source, ResidualGraph::NodeId sink, std::size_t threadCount = 0);
+
+	/**
+	 * \brief Implementao paralela do push-relabel usando um conjunto de threads j criado.
+	 *
+	 * \param network A rede residual onde o fluxo ser calculado.
+	 * \param source Identificador denso do n de origem.
+	 * \param sink Identificador denso do n de destino.
+	 * \param pool As threads que executam as rodadas.
+	 *
+	 * \return O valor do fluxo mximo encontrado.
+	 */
+	template <typename Capacity>
+	static Capacity ParallelPushRelabel(BasicResidualGraph<Capacity>& network, ResidualGraph::NodeId source, ResidualGraph::NodeId sink, ThreadPool& pool);
+
+	/**
+	 * \brief Obtm o lado da origem de um corte mnimo a partir de um fluxo mximo j calculado.
+	 *
+	 * \details Pelo teorema do fluxo mximo e corte mnimo, os ns alcanveis a partir da origem
+	 *          pelos arcos de capacidade residual positiva formam o lado da origem de um corte
+	 *          mnimo. Basta uma BFS sobre a rede residual final; nenhum fluxo  recalculado.
+	 *
+	 * \param network A rede residual, com um fluxo mximo.
+	 * \param source Identificador denso do n de origem.
+	 *
+	 * \return Para cada n, 1 se ele est do lado da origem e 0 caso contrrio.
+	 *
+	 * \complexidade O(V + E).
+	 */
+	template <typename Capacity>
+	static std::vector<std::uint8_t> MinCutSourceSide(const BasicResidualGraph<Capacity>& network, ResidualGraph::NodeId source);
+
+	/**
+	 * \brief Obtm as arestas de um corte mnimo a partir de um fluxo mximo j calculado.
+	 *
+	 * \details As arestas do corte so os arcos diretos que saem do lado da origem
+	 *          ('MinCutSourceSide') para o outro lado. Todas esto saturadas, e a soma das suas
+	 *          capacidades  igual ao fluxo mximo: aumentar a capacidade de qualquer outra
+	 *          aresta no aumenta o fluxo.
+	 *
+	 * \param network A rede residual, com um fluxo mximo.
+	 * \param source Identificador denso do n de origem.
+	 *
+	 * \return Os arcos diretos do corte, agrupados pelo n de origem na ordem da rede.
+	 *
+	 * \complexidade O(V + E).
+	 */
+	template <typename Capacity>
+	static std::vector<ResidualGraph::ArcId> MinCut(const BasicResidualGraph<Capacity>& network, ResidualGraph::NodeId source);
+
+	/**
+	 * \brief Fluxo mximo de custo mnimo, usando o custo das arestas ('GraphEdge::getCost').
+	 *
+	 * \param graph Ponteiro para o grafo onde o fluxo ser calculado.
+	 * \param source Ponteiro para o n de origem no grafo.
+	 * \param sink Ponteiro para o n de destino no grafo.
+	 *
+	 * \return O fluxo mximo e o menor custo total com que ele pode ser enviado.
+	 *
+	 * \throws std::runtime_error Se alguma aresta tem custo negativo.
+	 */
+	static MinCostFlow<int> MinCostMaxFlow(Graph* graph, GraphNode* source, GraphNode* sink);
+
+	/**
+	 * \brief Fluxo mximo de custo mnimo sobre uma rede residual compacta (caminhos mnimos sucessivos).
+	 *
+	 * \details Cada n tem um potencial (Johnson) que torna no negativos os custos reduzidos
+	 *          'custo(u, v) + p(u) - p(v)' dos arcos residuais, de modo que os caminhos de menor
+	 *          custo so encontrados com Dijkstra. Aps cada Dijkstra os potenciais somam as
+	 *          distncias, e o fluxo  enviado por todos os caminhos de custo reduzido zero de uma
+	 *          vez, com um fluxo bloqueante no estilo do Dinic (arcos de custo reduzido zero que
+	 *          avanam um nvel da BFS). Assim o nmero de execues do Dijkstra  o nmero de
+	 *          custos distintos de caminho, e no o nmero de caminhos aumentantes.
+	 *
+	 *          A rede  reiniciada ('reset') antes do clculo. O arco reverso de uma aresta tem o
+	 *          custo negado. Os custos so inteiros e o custo total tem 64 bits.
+	 *
+	 * \param network A rede residual onde o fluxo ser calculado.
+	 * \param edgeCosts Custo por unidade de fluxo de cada aresta, pelo nmero da aresta; as
+	 *                  arestas alm do fim do vetor (por exemplo, as da super origem e do super
+	 *                  sumidouro de 'ResidualGraph(const Network&)') tm custo zero.
+	 * \param source Identificador denso do n de origem.
+	 * \param sink Identificador denso do n de destino.
+	 *
+	 * \return O fluxo mximo e o menor custo total com que ele pode ser enviado.
+	 *
+	 * \throws std::runtime_error Se algum custo  negativo.
+	 *
+	 * \complexidade O(K (E log V + V E)), onde K  o nmero de custos distintos de caminho mnimo.
+	 *               Instanciado para 'int' e 'std::int64_t'.
+	 */
+	template <typename Capacity>
+	static MinCostFlow<Capacity> MinCostMaxFlow(BasicResidualGraph<Capacity>& network, std::span<const int> edgeCosts,
+		ResidualGraph::NodeId source, ResidualGraph::NodeId sink);
+
+	/**
+	 * \brief Funo chamada para cada caminho ou ciclo de 'DecomposeFlow': os arcos diretos, na
+	 *        ordem em que so percorridos, e o fluxo que passa por eles.
+	 */
+	template <typename Capacity>
+	using FlowPathVisitor = std::function<void(std::span<const ResidualGraph::ArcId> arcs, Capacity amount)>;
+
+	/**
+	 * \brief Decompe um fluxo j calculado em caminhos da origem ao sumidouro e ciclos.
+	 *
+	 * \details Uma busca em profundidade iterativa, com uma pilha explcita, parte da origem e
+	 *          segue arcos diretos que ainda tm fluxo. Ao chegar ao sumidouro, o caminho da pilha
+	 *          leva o menor fluxo dos seus arcos; ao chegar a um n que j est na pilha, o
+	 *          mesmo vale para o ciclo fechado. O fluxo  descontado, e a busca recua at o
+	 *          primeiro arco que ficou sem fluxo. Cada n guarda o prximo arco a examinar, que s
+	 *          avana. Quando a origem no tem mais fluxo, o que resta  uma circulao, decomposta
+	 *          em ciclos a partir de cada n.
+	 *
+	 *          Cada caminho ou ciclo zera pelo menos um arco, ento so no mximo E. Eles so
+	 *          entregues a 'visit' assim que encontrados, e s o caminho atual fica em memria:
+	 *          alm da rede, a memria  O(V + E), com uma cpia do fluxo de cada arco.
+	 *
+	 * \param network A rede residual, com um fluxo que  conservado em todos os ns exceto a
+	 *                origem e o sumidouro. A rede no  alterada.
+	 * \param source Identificador denso do n de origem.
+	 * \param sink Identificador denso do n de destino.
+	 * \param visit Chamada para cada caminho, que comea na origem e termina no sumidouro, e
+	 *              cada ciclo, que termina no n em que comea.
+	 *
+	 * \return O nmero de caminhos e ciclos.
+	 *
+	 * \throws std::runtime_error Se o fluxo no  conservado em algum n ou volta do sumidouro
+	 *                            para a origem.
+	 *
+	 * \complexidade O(V E). Instanciado para 'int' e 'std::int64_t'.
+	 */
+	template <typename Capacity>
+	static std::size_t DecomposeFlow(const BasicResidualGraph<Capacity>& network, ResidualGraph::NodeId source,
+		ResidualGraph::NodeId sink, const FlowPathVisitor<Capacity>& visit);
 };
 
 #endif // ALGORITHMS_H
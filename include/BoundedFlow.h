@@ -0,0 +1,76 @@
+#ifndef BOUNDEDFLOW_H
+#define BOUNDEDFLOW_H
+
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+#include "Network.h"
+#include "ResidualGraph.h"
+
+/**
+ * \struct BoundedFlowResult
+ * \brief Fluxo máximo que respeita os limites inferiores ou, se não houver, a prova de inviabilidade.
+ */
+struct BoundedFlowResult {
+	bool feasible;
+
+	/**
+	 * \brief O fluxo máximo, se a rede for viável.
+	 */
+	std::int64_t maxFlow;
+
+	/**
+	 * \brief O fluxo de cada aresta da rede de fluxo, na numeração de 'ResidualGraph(const Network&)',
+	 *        pronto para 'ResidualGraph::setEdgeFlows'. Vazio se a rede for inviável.
+	 */
+	std::vector<int> flows;
+
+	/**
+	 * \brief Nós da rede de fluxo (0 é a super origem e V + 1, o super sumidouro) de um conjunto
+	 *        X que viola a condição de Hoffman: os limites inferiores das arestas que entram em X
+	 *        somam 'requiredFlow', mais do que a capacidade 'availableCapacity' das que saem.
+	 *        Vazio se a rede for viável.
+	 */
+	std::vector<std::size_t> infeasibleSet;
+	std::int64_t requiredFlow;
+	std::int64_t availableCapacity;
+};
+
+/**
+ * \class BoundedFlow
+ * \brief Fluxo máximo com limites inferiores: as demandas firmes dos consumidores e os fluxos
+ *        mínimos das conexões.
+ *
+ * A rede de fluxo é a de 'ResidualGraph(const Network&)', com a geração máxima de cada gerador.
+ * Os limites inferiores são retirados pela redução clássica a um fluxo máximo: cada aresta fica
+ * com capacidade c - l, uma aresta infinita do super sumidouro para a super origem fecha a
+ * circulação, e o limite l de uma aresta u -> v vira uma aresta de uma nova origem S' para v e
+ * uma de u para um novo sumidouro T'. A rede é viável se, e somente se, o fluxo máximo de S' a
+ * T' satura todas essas arestas.
+ */
+class BoundedFlow {
+public:
+	using Graph = BasicResidualGraph<std::int64_t>;
+	using MaxFlowAlgorithm = std::function<std::int64_t(Graph&, Graph::NodeId, Graph::NodeId)>;
+
+	/**
+	 * \brief Calcula o fluxo máximo que respeita os limites inferiores.
+	 *
+	 * \details O algoritmo resolve primeiro a rede de S' a T'. Se a rede for viável, o fluxo da
+	 *          aresta de volta é retirado e o algoritmo continua da super origem ao super
+	 *          sumidouro sobre a mesma rede residual, sem desfazer os limites já atendidos. Se
+	 *          for inviável, o conjunto X é o dos nós alcançáveis a partir de S' na rede residual
+	 *          final (o lado de S' de um corte mínimo).
+	 *
+	 * \param network A rede elétrica.
+	 * \param algorithm O algoritmo de fluxo máximo; precisa aceitar uma rede que já tem fluxo.
+	 *
+	 * \return O fluxo máximo e o fluxo de cada aresta, ou o conjunto que prova a inviabilidade.
+	 *
+	 * \complexidade Duas execuções de 'algorithm' sobre V + 4 nós e até 2E + 2V + 1 arestas.
+	 */
+	static BoundedFlowResult solve(const Network& network, const MaxFlowAlgorithm& algorithm);
+};
+
+#endif // BOUNDEDFLOW_H
@@ -0,0 +1,90 @@
+#ifndef CAPACITY_H
+#define CAPACITY_H
+
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <type_traits>
+
+/**
+ * \struct CapacityTraits
+ * \brief Operações que dependem do tipo de capacidade da rede de fluxo.
+ *
+ * São suportados 'int' (32 bits, o padrão: vetores menores e mais densos em cache),
+ * 'std::int64_t' (agregados grandes) e 'double' (capacidades fracionárias).
+ *
+ * Em compilações de depuração (sem 'NDEBUG') as somas de capacidades verificam estouro e
+ * lançam 'std::overflow_error'; com 'NDEBUG' (por exemplo, em 'make bench') a verificação
+ * é removida.
+ */
+template <typename Capacity>
+struct CapacityTraits {
+	static_assert(std::is_same_v<Capacity, int> || std::is_same_v<Capacity, std::int64_t> || std::is_same_v<Capacity, double>,
+		"tipo de capacidade não suportado");
+
+	/**
+	 * \brief Tipo usado para acumular capacidades (excessos e totais): 64 bits para os tipos inteiros.
+	 */
+	using Sum = std::conditional_t<std::is_floating_point_v<Capacity>, double, std::int64_t>;
+
+	/**
+	 * \brief Capacidade das arestas sem limite, como as da super origem para os geradores.
+	 *
+	 * Para 'std::int64_t' é metade do maior valor, de modo que o excesso de um gerador (uma
+	 * aresta infinita mais as conexões que chegam a ele) ainda cabe em 'Sum'.
+	 */
+	static constexpr Capacity infinity() {
+		if constexpr (std::is_floating_point_v<Capacity>)
+			return std::numeric_limits<Capacity>::infinity();
+		else if constexpr (std::is_same_v<Capacity, int>)
+			return std::numeric_limits<Capacity>::max();
+		else
+			return std::numeric_limits<Capacity>::max() / 2;
+	}
+
+	/**
+	 * \brief Verifica se uma capacidade residual (ou um excesso, em 'Sum') permite enviar fluxo.
+	 *
+	 * Para 'double', valores de até 1e-9 são considerados nulos, o que absorve os erros de
+	 * arredondamento acumulados nos aumentos.
+	 */
+	template <typename Value>
+	static constexpr bool positive(Value value) {
+		if constexpr (std::is_floating_point_v<Capacity>)
+			return value > 1e-9;
+		else
+			return value > 0;
+	}
+
+	/**
+	 * \brief Soma duas capacidades, verificando estouro em compilações de depuração.
+	 * \throws std::overflow_error Se o resultado não couber em 'Capacity'.
+	 */
+	static Capacity add(Capacity a, Capacity b) {
+#ifndef NDEBUG
+		if constexpr (std::is_integral_v<Capacity>) {
+			Capacity result;
+			if (__builtin_add_overflow(a, b, &result))
+				throw std::overflow_error("estouro na soma de capacidades; use --capacity=int64");
+			return result;
+		}
+#endif
+		return a + b;
+	}
+
+	/**
+	 * \brief Converte um total acumulado em 'Sum' para 'Capacity', verificando estouro em compilações de depuração.
+	 * \throws std::overflow_error Se o valor não couber em 'Capacity'.
+	 */
+	static Capacity fromSum(Sum value) {
+#ifndef NDEBUG
+		if constexpr (std::is_integral_v<Capacity>) {
+			if (value > std::numeric_limits<Capacity>::max() || value < std::numeric_limits<Capacity>::min())
+				throw std::overflow_error("estouro no valor do fluxo; use --capacity=int64");
+		}
+#endif
+		return static_cast<Capacity>(value);
+	}
+};
+
+#endif // CAPACITY_H
@@ -0,0 +1,84 @@
+#ifndef CONTINGENCYANALYSIS_H
+#define CONTINGENCYANALYSIS_H
+
+#include <cstdint>
+#include <vector>
+
+#include "Network.h"
+#include "ThreadPool.h"
+
+/**
+ * \struct ContingencyResult
+ * \brief Efeito da perda de uma conexão sobre a rede.
+ */
+struct ContingencyResult {
+	/**
+	 * \brief Número da conexão desligada.
+	 */
+	std::size_t edge;
+
+	/**
+	 * \brief Fluxo da conexão na solução base.
+	 */
+	int baseFlow;
+
+	/**
+	 * \brief Redução do fluxo máximo quando a conexão é desligada.
+	 */
+	int lostFlow;
+
+	/**
+	 * \brief Demanda não atendida com a conexão desligada.
+	 */
+	std::int64_t unmetDemand;
+
+	/**
+	 * \brief Verdadeiro se o cenário não precisou ser resolvido (conexão sem fluxo na base).
+	 */
+	bool skipped;
+};
+
+/**
+ * \struct ContingencyReport
+ * \brief Resultado da análise N-1: a solução base e um cenário por conexão.
+ */
+struct ContingencyReport {
+	int baseMaxFlow;
+	std::int64_t baseUnmetDemand;
+
+	/**
+	 * \brief Um resultado por conexão, na ordem da entrada.
+	 */
+	std::vector<ContingencyResult> edges;
+};
+
+/**
+ * \class ContingencyAnalysis
+ * \brief Análise de contingência N-1: o fluxo máximo da rede sem cada uma das conexões.
+ */
+class ContingencyAnalysis {
+public:
+	/**
+	 * \brief Calcula o efeito do desligamento de cada conexão.
+	 *
+	 * \details A rede é resolvida uma vez. Uma conexão sem fluxo na solução base não reduz o fluxo
+	 *          máximo, pois a mesma solução continua válida sem ela, e o cenário é descartado. Os
+	 *          demais partem de uma cópia da solução base ('IncrementalMaxFlow'): o fluxo da conexão
+	 *          é desviado por outros caminhos e, se parte dele precisar voltar à origem, o algoritmo
+	 *          de Dinic completa o fluxo a partir do que sobrou.
+	 *          Os cenários são distribuídos entre as threads de 'pool'; cada thread reaproveita a
+	 *          memória da sua cópia entre os cenários.
+	 *
+	 * \param network A rede elétrica.
+	 * \param pool As threads que resolvem os cenários.
+	 *
+	 * \return A solução base e o resultado de cada conexão.
+	 *
+	 * \complexidade O(V + E) por cenário para copiar a solução base, mais O(V + E) por caminho de
+	 *               desvio. Quando parte do fluxo volta à origem, soma-se uma execução do algoritmo
+	 *               de Dinic sobre toda a rede residual, O(V² E) no pior caso.
+	 */
+	static ContingencyReport run(const Network& network, ThreadPool& pool);
+};
+
+#endif // CONTINGENCYANALYSIS_H
@@ -0,0 +1,176 @@
+#ifndef DIAGNOSISSERVER_H
+#define DIAGNOSISSERVER_H
+
+#include <atomic>
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "IncrementalMaxFlow.h"
+#include "Network.h"
+
+/**
+ * \struct NetworkVersion
+ * \brief Uma versão resolvida da rede, que não muda depois de publicada.
+ */
+struct NetworkVersion {
+	std::uint64_t number;
+	IncrementalMaxFlow flow;
+};
+
+/**
+ * \class DiagnosisService
+ * \brief Responde consultas sobre uma rede residente, trocando de versão sem bloquear leitores.
+ *
+ * A versão atual fica em um 'std::atomic<std::shared_ptr>'. Cada consulta carrega o ponteiro uma
+ * única vez e responde a partir dele, então vê uma versão inteira mesmo que outra seja publicada
+ * no meio da consulta; a versão antiga é liberada quando a última consulta que a usa termina
+ * (como no RCU). As alterações e recargas são preparadas em uma cópia, fora da vista dos
+ * leitores, e publicadas com uma única troca do ponteiro. Só os escritores se serializam entre
+ * si.
+ *
+ * O protocolo é de texto, uma consulta por linha:
+ *
+ *     estado                   -> "versao fluxo demanda_nao_atendida"
+ *     fluxo                    -> "fluxo"
+ *     deficit                  -> "demanda_nao_atendida"
+ *     criticas                 -> "n", seguido de n linhas "conexao origem destino capacidade"
+ *     simular ALTERAÇÕES       -> "fluxo demanda_nao_atendida", sem alterar a rede
+ *     alterar ALTERAÇÕES       -> "versao fluxo demanda_nao_atendida" da nova versão
+ *     recarregar ARQUIVO       -> "versao fluxo demanda_nao_atendida" da rede lida
+ *
+ * ALTERAÇÕES é uma sequência de 'capacidade CONEXÃO VALOR', 'demanda ÍNDICE VALOR',
+ * 'conexao ORIGEM DESTINO CAPACIDADE' e 'remover CONEXÃO', aplicadas em ordem
+ * ('NetworkEdit'); as conexões são identificadas pelo número. Um erro é respondido com uma linha
+ * "erro MENSAGEM", e uma alteração com erro não publica nada.
+ */
+class DiagnosisService {
+public:
+	/**
+	 * \brief Resolve a rede e publica a versão 1.
+	 * \param network A rede elétrica; os limites inferiores e os custos são ignorados.
+	 */
+	explicit DiagnosisService(const Network& network);
+
+	/**
+	 * \brief A versão atual; continua válida depois que outra for publicada.
+	 */
+	std::shared_ptr<const NetworkVersion> current() const { return m_current.load(); }
+
+	/**
+	 * \brief Responde uma consulta do protocolo.
+	 * \param request A linha da consulta, sem a quebra de linha.
+	 * \param out Recebe a resposta, com uma quebra de linha ao fim de cada linha.
+	 *
+	 * Pode ser chamada de várias threads ao mesmo tempo.
+	 */
+	void handle(const std::string& request, std::ostream& out);
+
+	/**
+	 * \brief Aplica as alterações a uma cópia da versão atual e a publica.
+	 * \return A nova versão.
+	 *
+	 * \throws std::runtime_error Se alguma alteração for inválida; nada é publicado.
+	 *
+	 * \complexidade O(V + E) para copiar a versão, mais o reparo de 'IncrementalMaxFlow::apply'.
+	 */
+	std::shared_ptr<const NetworkVersion> commit(std::span<const NetworkEdit> edits);
+
+	/**
+	 * \brief Resolve uma nova rede e a publica no lugar da atual.
+	 * \return A nova versão.
+	 *
+	 * A rede é resolvida antes de qualquer bloqueio; as consultas continuam respondidas pela
+	 * versão anterior enquanto isso.
+	 */
+	std::shared_ptr<const NetworkVersion> reload(const Network& network);
+
+	/**
+	 * \brief Lê uma sequência de alterações do protocolo.
+	 *
+	 * \throws std::runtime_error Se a sequência estiver malformada.
+	 */
+	static std::vector<NetworkEdit> parseEdits(const std::string& text);
+
+private:
+	/**
+	 * \brief Publica 'flow' como a próxima versão; exige 'm_writer'.
+	 */
+	std::shared_ptr<const NetworkVersion> publish(IncrementalMaxFlow flow);
+
+	std::atomic<std::shared_ptr<const NetworkVersion>> m_current;
+	std::mutex m_writer;
+};
+
+/**
+ * \class DiagnosisServer
+ * \brief Atende as consultas de 'DiagnosisService' em um socket Unix local.
+ *
+ * Cada conexão é atendida pela sua própria thread, então vários clientes são respondidos ao
+ * mesmo tempo; as consultas de uma conexão são respondidas em ordem. A consulta 'desligar'
+ * responde "ok" e encerra o servidor: o socket deixa de aceitar conexões, as conexões abertas
+ * são fechadas e 'run' retorna.
+ */
+class DiagnosisServer {
+public:
+	/**
+	 * \brief Cria o socket e começa a escutar em 'path', substituindo um socket antigo.
+	 *
+	 * \throws std::runtime_error Se o socket não puder ser criado.
+	 */
+	DiagnosisServer(DiagnosisService& service, const std::string& path);
+
+	/**
+	 * \brief Fecha o socket e remove o seu arquivo.
+	 */
+	~DiagnosisServer();
+
+	DiagnosisServer(const DiagnosisServer&) = delete;
+	DiagnosisServer& operator=(const DiagnosisServer&) = delete;
+
+	/**
+	 * \brief Aceita conexões até 'stop' ou a consulta 'desligar'.
+	 */
+	void run();
+
+	/**
+	 * \brief Encerra 'run'; pode ser chamada de qualquer thread.
+	 */
+	void stop();
+
+private:
+	struct Connection {
+		int fd;
+		std::thread thread;
+		std::atomic<bool> done{ false };
+	};
+
+	/**
+	 * \brief Lê e responde as consultas de uma conexão até o cliente fechá-la, e então encerra a
+	 *        conexão.
+	 */
+	void serve(Connection& connection);
+
+	/**
+	 * \brief Espera as threads das conexões já encerradas.
+	 */
+	void reap();
+
+	DiagnosisService& m_service;
+	std::string m_path;
+	int m_listener;
+	std::atomic<bool> m_stopping;
+
+	/**
+	 * \brief Conexões abertas; 'std::list' para que os endereços não mudem.
+	 */
+	std::list<Connection> m_connections;
+	std::mutex m_connectionsMutex;
+};
+
+#endif // DIAGNOSISSERVER_H
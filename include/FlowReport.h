@@ -0,0 +1,87 @@
+#ifndef FLOWREPORT_H
+#define FLOWREPORT_H
+
+#include <ostream>
+
+#include "BoundedFlow.h"
+#include "Network.h"
+#include "ResidualGraph.h"
+
+/**
+ * \class FlowReport
+ * \brief Relatório do programa principal sobre uma rede já resolvida.
+ *
+ * O relatório tem o fluxo máximo, a demanda não atendida, a perda de energia (capacidade
+ * residual das conexões que saem dos geradores) e a lista de conexões críticas (saturadas),
+ * agrupadas pelo nó de origem na ordem da entrada. A perda de energia e as conexões críticas
+ * dependem de qual fluxo máximo foi encontrado; quando ele não é único, algoritmos diferentes
+ * podem dar valores diferentes para elas, e só as duas primeiras linhas coincidem. Os totais
+ * são acumulados em 'CapacityTraits<Capacity>::Sum', então não estouram com capacidades de 32
+ * bits. Com capacidades reais os valores são escritos com 'max_digits10' dígitos
+ * significativos: em uma rede de capacidades inteiras, o relatório é igual ao dos tipos
+ * inteiros.
+ */
+class FlowReport {
+public:
+	/**
+	 * \brief Escreve o relatório.
+	 * \param out Fluxo de saída.
+	 * \param input A rede elétrica.
+	 * \param network A rede de fluxo montada a partir de 'input', com o fluxo calculado.
+	 * \param maxFlow O valor do fluxo máximo.
+	 *
+	 * \complexidade O(V + E).
+	 */
+	template <typename Capacity>
+	static void write(std::ostream& out, const Network& input, const BasicResidualGraph<Capacity>& network, Capacity maxFlow);
+
+	/**
+	 * \brief Escreve o corte mínimo da rede resolvida.
+	 * \param out Fluxo de saída.
+	 * \param input A rede elétrica.
+	 * \param network A rede de fluxo montada a partir de 'input', com um fluxo máximo.
+	 *
+	 * A primeira linha é o valor do corte, igual ao fluxo máximo; a segunda, o número de
+	 * conexões no corte, seguido de uma linha "origem destino capacidade" por conexão. São as
+	 * conexões cuja ampliação pode aumentar o fluxo. O restante do valor do corte é a demanda
+	 * de consumidores já atendidos por completo, que não é limitada por nenhuma conexão.
+	 *
+	 * \complexidade O(V + E), sem resolver a rede novamente ('Algorithms::MinCut').
+	 */
+	template <typename Capacity>
+	static void writeMinCut(std::ostream& out, const Network& input, const BasicResidualGraph<Capacity>& network);
+
+	/**
+	 * \brief Escreve de quais geradores vem a energia de cada consumidor.
+	 * \param out Fluxo de saída.
+	 * \param input A rede elétrica.
+	 * \param network A rede de fluxo montada a partir de 'input', com o fluxo calculado.
+	 *
+	 * O fluxo é decomposto em caminhos e ciclos ('Algorithms::DecomposeFlow'), escritos à medida
+	 * que são encontrados, um por linha: a quantidade de energia seguida dos nós da entrada, do
+	 * gerador ao consumidor, sem a super origem e o super sumidouro. Um ciclo termina no nó em
+	 * que começa. Como a lista não é guardada, o número de linhas não é escrito antes dela; ela
+	 * vai até o fim da saída.
+	 *
+	 * \throws std::runtime_error Se o fluxo não é conservado.
+	 *
+	 * \complexidade O(V E), com no máximo E linhas.
+	 */
+	template <typename Capacity>
+	static void writePaths(std::ostream& out, const Network& input, const BasicResidualGraph<Capacity>& network);
+
+	/**
+	 * \brief Escreve a prova de que os limites inferiores da rede não podem ser atendidos.
+	 * \param out Fluxo de saída.
+	 * \param result O resultado inviável de 'BoundedFlow::solve'.
+	 *
+	 * A primeira linha traz a soma dos limites inferiores que entram no conjunto de nós e a
+	 * capacidade que sai dele; a segunda, o número de nós, seguido de uma linha por nó (0 é a
+	 * super origem e V + 1, o super sumidouro).
+	 *
+	 * \complexidade O(V).
+	 */
+	static void writeInfeasibility(std::ostream& out, const BoundedFlowResult& result);
+};
+
+#endif // FLOWREPORT_H
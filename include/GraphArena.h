@@ -0,0 +1,113 @@
+#ifndef GRAPHARENA_H
+#define GRAPHARENA_H
+
+#include <cstdint>
+#include <memory>
+#include <memory_resource>
+#include <span>
+#include <vector>
+
+#include "Graph.h"
+#include "GraphNode.h"
+#include "Network.h"
+
+/**
+ * \class GraphArena
+ * \brief Grafo de objetos ('Graph', 'GraphNode', 'GraphEdge') cujos nós e arestas ficam em um único bloco de memória.
+ *
+ * A construção é feita em duas passadas: a primeira conta o grau de cada nó (cada conexão
+ * ocupa uma aresta no nó de origem e a reversa no de destino) e calcula o tamanho exato do
+ * bloco; a segunda cria os nós, reserva o vetor de arestas de cada um com o seu grau e
+ * conecta as arestas, sem nenhuma realocação. Os vetores de arestas são alocados do bloco
+ * por um 'std::pmr::monotonic_buffer_resource', cujas liberações não fazem nada, e o bloco
+ * inteiro é liberado de uma vez com a arena.
+ *
+ * Os nós guardam ponteiros uns para os outros, então a arena não pode ser copiada nem movida.
+ */
+class GraphArena {
+public:
+	/**
+	 * \brief Constrói o grafo a partir de uma lista de conexões.
+	 * \param demands A demanda de cada nó; o nó 'i' recebe o índice 'i'.
+	 * \param tails Nó de origem de cada conexão.
+	 * \param heads Nó de destino de cada conexão.
+	 * \param capacities Capacidade de cada conexão.
+	 *
+	 * As conexões são adicionadas na ordem da lista.
+	 *
+	 * \throws std::runtime_error Se as listas de conexões tiverem tamanhos diferentes ou um nó não existir.
+	 *
+	 * \complexidade O(V + E).
+	 */
+	GraphArena(std::span<const int> demands, std::span<const std::uint32_t> tails,
+		std::span<const std::uint32_t> heads, std::span<const int> capacities);
+
+	/**
+	 * \brief Constrói a rede de fluxo de uma descrição de rede elétrica.
+	 * \param network A descrição da rede.
+	 *
+	 * Os nós e as arestas seguem a mesma numeração de 'ResidualGraph(const Network&)': 0 é a
+	 * super origem, V + 1 o super sumidouro, e após as conexões da entrada vêm as arestas da
+	 * super origem para os geradores e as dos consumidores para o super sumidouro.
+	 */
+	GraphArena(const Network& network);
+
+	GraphArena(const GraphArena&) = delete;
+	GraphArena& operator=(const GraphArena&) = delete;
+
+	/**
+	 * \brief Obtém o grafo.
+	 */
+	Graph& getGraph() { return m_graph; }
+
+	/**
+	 * \brief Obtém o nó de índice 'index'.
+	 */
+	GraphNode* getNode(std::size_t index) { return &m_nodes[index]; }
+
+	/**
+	 * \brief Obtém o número de conexões (arestas diretas) do grafo.
+	 */
+	std::size_t getEdgeCount() const { return m_edgeCount; }
+
+	/**
+	 * \brief Obtém a memória ocupada pelo grafo, em bytes.
+	 *
+	 * Como nada é alocado depois da construção, este é também o pico de memória do grafo.
+	 */
+	std::size_t getMemoryUsage() const;
+
+	/**
+	 * \brief Obtém a memória ocupada pelo grafo por conexão, em bytes.
+	 */
+	double getBytesPerEdge() const;
+
+private:
+	/**
+	 * \brief Cria os nós, com os vetores de arestas reservados com os graus dados.
+	 */
+	GraphArena(std::span<const int> demands, const std::vector<std::size_t>& degrees);
+
+	/**
+	 * \brief Tamanho do bloco para os graus dados: os nós e as arestas diretas e reversas.
+	 */
+	static std::size_t blockSize(const std::vector<std::size_t>& degrees);
+
+	std::size_t m_bufferSize;
+
+	/**
+	 * \brief Bloco onde ficam os nós e os vetores de arestas.
+	 */
+	std::unique_ptr<std::byte[]> m_buffer;
+
+	/**
+	 * \brief Alocador sobre 'm_buffer'; um pedido além do bloco lança 'std::bad_alloc'.
+	 */
+	std::pmr::monotonic_buffer_resource m_resource;
+
+	std::pmr::vector<GraphNode> m_nodes;
+	Graph m_graph;
+	std::size_t m_edgeCount;
+};
+
+#endif // GRAPHARENA_H
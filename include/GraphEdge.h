@@ -1,6 +1,8 @@
 #ifndef GRAPHEDGE_H
 #define GRAPHEDGE_H
 
+#include <cstddef>
+
 #include "GraphNode.h"
 
 class GraphNode;
@@ -33,6 +35,18 @@ public:
 	 */
 	GraphEdge(GraphNode* source, GraphNode* target, int weight);
 
+	/**
+	 * \brief Construtor de GraphEdge com a posio da aresta par no grafo residual.
+	 * \param source N de origem da aresta.
+	 * \param target N de destino da aresta.
+	 * \param weight Peso da aresta.
+	 * \param reverseIndex Posio da aresta par em 'target->getEdges()'.
+	 * \param isReverse Verdadeiro se esta  a aresta reversa (residual) de uma conexo.
+	 *
+	 * Usado por 'GraphNode::connect', que cria a aresta direta e a reversa ao mesmo tempo.
+	 */
+	GraphEdge(GraphNode* source, GraphNode* target, int weight, std::size_t reverseIndex, bool isReverse);
+
 	/**
 	 * \brief Obtm o n de origem da aresta.
 	 * \return Ponteiro para o n de origem.
@@ -54,10 +68,20 @@ public:
 	 * \return Ponteiro para a aresta reversa.
 	 *
 	 * Retorna a aresta reversa associada no grafo residual, permitindo
-	 * manipulao do fluxo em algoritmos de fluxo mximo.
+	 * manipulao do fluxo em algoritmos de fluxo mximo. A aresta reversa  criada
+	 * junto com a direta em 'GraphNode::connect' e fica em 'getTarget()->getEdges()';
+	 * nenhuma alocao  feita aqui. Retorna nullptr se a aresta no foi criada por 'connect'.
+	 *
+	 * O ponteiro deixa de ser vlido se novas arestas forem adicionadas ao n de destino.
 	 */
 	GraphEdge* getReverse();
 
+	/**
+	 * \brief Verifica se esta  a aresta reversa (residual) de uma conexo.
+	 * \return Verdadeiro para arestas reversas, falso para as conexes da rede.
+	 */
+	bool isReverse() const { return m_isReverse; };
+
 	/**
 	 * \brief Define o fluxo da aresta.
 	 * \param flow Valor do fluxo a ser definido.
@@ -82,6 +106,18 @@ public:
 	 */
 	int getCapacity() const { return m_capacity; };
 
+	/**
+	 * \brief Define o custo por unidade de fluxo da aresta.
+	 * \param cost O custo, por exemplo a perda da linha; a aresta reversa tem o custo negado.
+	 */
+	void setCost(int cost) { m_cost = cost; };
+
+	/**
+	 * \brief Obtm o custo por unidade de fluxo da aresta, usado por 'Algorithms::MinCostMaxFlow'.
+	 * \return O custo da aresta (zero se no foi definido).
+	 */
+	int getCost() const { return m_cost; };
+
 	/**
 	 * \brief Operador de igualdade para comparar duas arestas.
 	 * \param other A outra aresta a ser comparada.
@@ -119,11 +155,22 @@ private:
 	int m_capacity;
 
 	/**
-	 * \brief A aresta reversa no grafo residual.
+	 * \brief O custo por unidade de fluxo da aresta.
+	 */
+	int m_cost;
+
+	/**
+	 * \brief A posio da aresta reversa no grafo residual.
 	 *
-	 * Aponta para a aresta reversa correspondente no grafo residual.
+	 * ndice da aresta reversa correspondente no vetor de arestas do n de destino.
+	 * Um ndice  usado no lugar de um ponteiro porque o vetor pode ser realocado.
+	 */
+	std::size_t m_reverse;
+
+	/**
+	 * \brief Indica se esta  a aresta reversa de uma conexo.
 	 */
-	GraphEdge* m_reverse;
+	bool m_isReverse;
 };
 
 #endif // GRAPHEDGE_H
@@ -1,6 +1,7 @@
 #ifndef GRAPHNODE_H
 #define GRAPHNODE_H
 
+#include <memory_resource>
 #include <vector>
 #include <unordered_map>
 #include "GraphEdge.h"
@@ -61,6 +62,14 @@ public:
 	 */
 	GraphNode(std::size_t index, int demand);
 
+	/**
+	 * \brief Construtor que inicializa um GraphNode cujas arestas so alocadas em 'resource'.
+	 * \param index O ndice associado ao n.
+	 * \param demand A demanda associada ao n.
+	 * \param resource A memria de onde o vetor de arestas  alocado ('GraphArena').
+	 */
+	GraphNode(std::size_t index, int demand, std::pmr::memory_resource* resource);
+
 	/**
 	 * \brief Obtm o ndice do n.
 	 * \return O ndice do n como um tamanho (std::size_t).
@@ -77,9 +86,26 @@ public:
 	 * \brief Conecta este n a outro n com um peso associado.
 	 * \param node Ponteiro para o n a ser conectado.
 	 * \param weight O peso da aresta que conecta os ns.
+	 *
+	 * Alm da aresta direta, adiciona a 'node' a aresta reversa (residual) de capacidade
+	 * zero, de modo que as duas arestas so alocadas juntas e a reversa  alcanvel
+	 * pela adjacncia do n de destino.
 	 */
 	void connect(GraphNode* node, int weight);
 
+	/**
+	 * \brief Conecta este n a outro n com um peso e um custo por unidade de fluxo.
+	 * \param node Ponteiro para o n a ser conectado.
+	 * \param weight O peso da aresta que conecta os ns.
+	 * \param cost O custo da aresta direta; a aresta reversa recebe o custo negado.
+	 */
+	void connect(GraphNode* node, int weight, int cost);
+
+	/**
+	 * \brief Reserva espao para 'count' arestas, diretas e reversas, evitando realocaes em 'connect'.
+	 */
+	void reserveEdges(std::size_t count);
+
 	/**
 	 * \brief Verifica se este n est conectado a outro n.
 	 * \param node Ponteiro para o n a ser verificado.
@@ -98,13 +124,16 @@ public:
 	 * \return Um vetor de ponteiros para GraphEdges conectadas a este n.
 	 *
 	 * Retorna todas as arestas que esto conectadas ao n atual, permitindo que
-	 * o chamador interaja com as conexes do n.
+	 * o chamador interaja com as conexes do n. O vetor inclui as arestas reversas
+	 * das conexes que chegam ao n ('GraphEdge::isReverse()').
 	 */
-	std::vector<GraphEdge>& getEdges();
+	std::pmr::vector<GraphEdge>& getEdges();
 
 	/**
 	 * \brief Define as arestas conectadas ao n.
 	 * \param edges Um vetor de arestas para substituir as conexes atuais.
+	 *
+	 * As posies das arestas reversas ('GraphEdge::getReverse()') devem ser preservadas.
 	 */
 	void setEdges(std::vector<GraphEdge> edges);
 
@@ -163,9 +192,10 @@ private:
 	 * \brief Armazena as arestas conectadas ao n.
 	 *
 	 * Um vetor que contm ponteiros para as arestas (GraphEdges) que conectam este n
-	 * a outros ns. Cada aresta aponta para outro n no grafo.
+	 * a outros ns. Cada aresta aponta para outro n no grafo. Por padro o vetor usa o
+	 * heap; os ns de um 'GraphArena' usam a memria da arena.
 	 */
-	std::vector<GraphEdge> m_edges;
+	std::pmr::vector<GraphEdge> m_edges;
 
 	/**
 	 * \brief ndice nico associado ao n.
@@ -0,0 +1,193 @@
+#ifndef INCREMENTALMAXFLOW_H
+#define INCREMENTALMAXFLOW_H
+
+#include <cstdint>
+#include <span>
+#include <vector>
+
+#include "Network.h"
+#include "ResidualGraph.h"
+
+/**
+ * \struct NetworkEdit
+ * \brief Uma alteração na rede elétrica, aplicada por 'IncrementalMaxFlow::apply'.
+ *
+ * As alterações são criadas pelas funções estáticas; as conexões são identificadas pelo
+ * seu número (a posição na entrada, seguida das conexões adicionadas) e os nós pelo índice.
+ */
+struct NetworkEdit {
+	enum class Type { Capacity, Demand, AddEdge, RemoveEdge };
+
+	Type type;
+	std::size_t first;
+	std::size_t second;
+	int value;
+
+	/**
+	 * \brief Altera a capacidade da conexão 'edge'.
+	 */
+	static NetworkEdit setCapacity(std::size_t edge, int capacity) { return { Type::Capacity, edge, 0, capacity }; }
+
+	/**
+	 * \brief Altera a demanda do consumidor 'index'.
+	 */
+	static NetworkEdit setDemand(std::size_t index, int demand) { return { Type::Demand, index, 0, demand }; }
+
+	/**
+	 * \brief Adiciona uma conexão, que recebe o próximo número livre.
+	 */
+	static NetworkEdit addEdge(std::size_t source, std::size_t target, int capacity) { return { Type::AddEdge, source, target, capacity }; }
+
+	/**
+	 * \brief Remove a conexão 'edge'; os números das demais conexões não mudam.
+	 */
+	static NetworkEdit removeEdge(std::size_t edge) { return { Type::RemoveEdge, edge, 0, 0 }; }
+};
+
+/**
+ * \class IncrementalMaxFlow
+ * \brief Mantém o fluxo máximo de uma rede elétrica e o repara após cada lote de alterações.
+ *
+ * O fluxo nunca é recalculado do zero. Aumentar uma capacidade apenas aumenta a capacidade
+ * residual do arco. Reduzi-la abaixo do fluxo atual cancela o excedente: o fluxo é primeiro
+ * desviado por outro caminho entre os extremos da conexão e, se não houver, devolvido à super
+ * origem e retirado do super sumidouro. Ao final do lote, o algoritmo de Dinic procura os
+ * caminhos aumentantes que as alterações abriram, partindo do fluxo que sobrou. Um lote que só
+ * reduz capacidades e desvia todo o fluxo cancelado mantém o fluxo máximo, e o algoritmo de
+ * Dinic não é executado: o reparo custa uma BFS por caminho de desvio.
+ *
+ * Uma conexão removida fica com capacidade zero e mantém o seu número. Conexões adicionadas
+ * exigem remontar os vetores da rede residual, uma única vez por lote e em tempo O(V + E),
+ * preservando o fluxo de todas as arestas.
+ */
+class IncrementalMaxFlow {
+public:
+	/**
+	 * \brief Calcula o fluxo máximo inicial da rede.
+	 * \param network A rede elétrica; seus vetores são copiados.
+	 */
+	IncrementalMaxFlow(const Network& network);
+
+	/**
+	 * \brief Aplica um lote de alterações e repara o fluxo.
+	 * \param edits As alterações, aplicadas em ordem.
+	 * \return O novo valor do fluxo máximo.
+	 *
+	 * \throws std::runtime_error Se uma alteração se referir a uma conexão ou nó inexistente,
+	 *         tiver capacidade negativa ou tentar mudar a demanda de um gerador ou zerar a de um
+	 *         consumidor. As alterações anteriores do lote permanecem aplicadas e o fluxo é
+	 *         reparado antes da exceção ser lançada.
+	 */
+	int apply(std::span<const NetworkEdit> edits);
+
+	/**
+	 * \brief Valor do fluxo máximo atual.
+	 */
+	int getMaxFlow() const { return m_maxFlow; }
+
+	/**
+	 * \brief Demanda não atendida: a soma das demandas menos o fluxo máximo.
+	 */
+	std::int64_t getUnmetDemand() const { return m_totalDemand - m_maxFlow; }
+
+	/**
+	 * \brief Número de conexões, incluindo as removidas.
+	 */
+	std::size_t getEdgeCount() const { return m_edgeSources.size(); }
+
+	/**
+	 * \brief Verifica se a conexão foi removida.
+	 */
+	bool isRemoved(std::size_t edge) const { return m_removed[edge]; }
+
+	/**
+	 * \brief Nó de origem da conexão.
+	 */
+	std::size_t getEdgeSource(std::size_t edge) const { return m_edgeSources[edge]; }
+
+	/**
+	 * \brief Nó de destino da conexão.
+	 */
+	std::size_t getEdgeTarget(std::size_t edge) const { return m_edgeTargets[edge]; }
+
+	/**
+	 * \brief Capacidade atual da conexão.
+	 */
+	int getEdgeCapacity(std::size_t edge) const { return m_edgeCapacities[edge]; }
+
+	/**
+	 * \brief Fluxo atual da conexão.
+	 */
+	int getEdgeFlow(std::size_t edge) const { return m_graph.getEdgeFlow(edge); }
+
+	/**
+	 * \brief Conexões críticas (saturadas), na mesma ordem do relatório do programa principal.
+	 * \return Os números das conexões, agrupadas pelo nó de origem; as removidas são ignoradas.
+	 */
+	std::vector<std::size_t> getCriticalEdges() const;
+
+	/**
+	 * \brief A rede residual com o fluxo atual.
+	 */
+	const ResidualGraph& getResidualGraph() const { return m_graph; }
+
+private:
+	/**
+	 * \brief A rede descrita pelos vetores atuais, vista sem cópia.
+	 */
+	Network view() const;
+
+	/**
+	 * \brief Altera a capacidade da aresta 'edge' da rede residual, cancelando o fluxo excedente.
+	 * \return Verdadeiro se o fluxo pode ter deixado de ser máximo: a capacidade aumentou ou parte
+	 *         do fluxo cancelado voltou à origem.
+	 */
+	bool changeCapacity(std::size_t edge, int capacity);
+
+	/**
+	 * \brief Envia até 'limit' unidades de 'from' para 'to' por caminhos aumentantes.
+	 * \return A quantidade enviada.
+	 */
+	int augment(ResidualGraph::NodeId from, ResidualGraph::NodeId to, int limit);
+
+	/**
+	 * \brief Remonta a rede residual com as conexões adicionadas, preservando o fluxo.
+	 */
+	void rebuild();
+
+	std::vector<int> m_demands;
+	std::vector<std::uint32_t> m_generators;
+	std::vector<std::uint32_t> m_edgeSources;
+	std::vector<std::uint32_t> m_edgeTargets;
+	std::vector<int> m_edgeCapacities;
+	std::vector<int> m_supplies;
+	std::vector<bool> m_removed;
+
+	/**
+	 * \brief Posição de cada consumidor entre as arestas para o super sumidouro ('NO_SINK_EDGE' para geradores).
+	 *
+	 * Na rede residual, essas arestas vêm depois das conexões e das arestas da super origem.
+	 */
+	std::vector<std::size_t> m_sinkEdges;
+	static constexpr std::size_t NO_SINK_EDGE = static_cast<std::size_t>(-1);
+
+	ResidualGraph m_graph;
+
+	/**
+	 * \brief Número de conexões presentes em 'm_graph'; as seguintes aguardam 'rebuild'.
+	 */
+	std::size_t m_builtEdges;
+
+	int m_maxFlow;
+	std::int64_t m_totalDemand;
+
+	/**
+	 * \brief Vetores da BFS de 'augment', reaproveitados entre as chamadas.
+	 */
+	std::vector<ResidualGraph::ArcId> m_parentArc;
+	std::vector<std::uint32_t> m_visited;
+	std::uint32_t m_stamp;
+	std::vector<ResidualGraph::NodeId> m_queue;
+};
+
+#endif // INCREMENTALMAXFLOW_H
@@ -0,0 +1,281 @@
+#ifndef NETWORK_H
+#define NETWORK_H
+
+#include <climits>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <ostream>
+#include <span>
+#include <vector>
+
+/**
+ * \class Network
+ * \brief Descrição plana de uma rede elétrica: nós, demandas e conexões.
+ *
+ * Os nós são identificados pelos índices 1..V da entrada; a demanda de cada nó fica em
+ * um vetor indexado pelo próprio índice, e um nó com demanda zero é um gerador. As
+ * conexões ficam em três vetores paralelos (origem, destino e capacidade), na ordem da
+ * entrada, e num quarto vetor opcional com o custo por unidade de fluxo de cada conexão
+ * (vazio quando a entrada não traz custos). Nenhum objeto é alocado por nó ou por conexão.
+ *
+ * Três vetores opcionais trazem limites, e ficam vazios quando a entrada não os usa: a geração
+ * máxima de cada gerador, a demanda firme de cada consumidor (a parte da demanda que precisa ser
+ * atendida) e o fluxo mínimo de cada conexão. Os dois últimos são limites inferiores de fluxo,
+ * tratados por 'BoundedFlow'.
+ *
+ * A rede é imutável e apenas enxerga os vetores ('std::span'); quem os armazena é o
+ * objeto compartilhado 'm_storage', que pode vir de um 'NetworkBuilder' ou ser um
+ * arquivo mapeado em memória ('NetworkSnapshot'). Copiar uma rede não copia os vetores.
+ *
+ * Ao montar a rede de fluxo ('ResidualGraph(const Network&)'), o índice 0 é a super
+ * origem, ligada a todos os geradores com capacidade igual à sua geração máxima, e o índice
+ * V + 1 é o super sumidouro, ligado a todos os consumidores com capacidade igual à sua demanda.
+ */
+class Network {
+public:
+	/**
+	 * \brief Cria uma rede vazia.
+	 */
+	Network() {}
+
+	/**
+	 * \brief Cria uma rede sobre vetores já preenchidos.
+	 * \param storage Objeto que mantém os vetores válidos enquanto a rede existir.
+	 * \param demands Demanda de cada nó, indexada pelo índice (V + 2 entradas, incluindo 0 e V + 1).
+	 * \param generators Índices dos geradores.
+	 * \param edgeSources Índice do nó de origem de cada conexão.
+	 * \param edgeTargets Índice do nó de destino de cada conexão.
+	 * \param edgeCapacities Capacidade de cada conexão.
+	 * \param edgeCosts Custo de cada conexão, ou vazio se todos os custos são zero.
+	 * \param supplies Geração máxima de cada nó, indexada como 'demands' (INT_MAX para geradores
+	 *                 sem limite), ou vazio se nenhum gerador tem limite.
+	 * \param firmDemands Demanda firme de cada nó, indexada como 'demands', ou vazio se não há.
+	 * \param edgeLowerBounds Fluxo mínimo de cada conexão, ou vazio se todos são zero.
+	 */
+	Network(std::shared_ptr<const void> storage,
+		std::span<const int> demands,
+		std::span<const std::uint32_t> generators,
+		std::span<const std::uint32_t> edgeSources,
+		std::span<const std::uint32_t> edgeTargets,
+		std::span<const int> edgeCapacities,
+		std::span<const int> edgeCosts = {},
+		std::span<const int> supplies = {},
+		std::span<const int> firmDemands = {},
+		std::span<const int> edgeLowerBounds = {}) :
+		m_storage(std::move(storage)), m_demands(demands), m_generators(generators),
+		m_edgeSources(edgeSources), m_edgeTargets(edgeTargets), m_edgeCapacities(edgeCapacities),
+		m_edgeCosts(edgeCosts), m_supplies(supplies), m_firmDemands(firmDemands),
+		m_edgeLowerBounds(edgeLowerBounds) {}
+
+	/**
+	 * \brief Obtém o número de nós (V), sem contar a super origem e o super sumidouro.
+	 */
+	std::size_t getNodeCount() const { return m_demands.empty() ? 0 : m_demands.size() - 2; }
+
+	/**
+	 * \brief Obtém o número de conexões (E).
+	 */
+	std::size_t getEdgeCount() const { return m_edgeSources.size(); }
+
+	/**
+	 * \brief Índice da super origem na rede de fluxo.
+	 */
+	std::size_t getSourceIndex() const { return 0; }
+
+	/**
+	 * \brief Índice do super sumidouro na rede de fluxo.
+	 */
+	std::size_t getSinkIndex() const { return getNodeCount() + 1; }
+
+	/**
+	 * \brief Obtém a demanda de um nó (zero para geradores).
+	 */
+	int getDemand(std::size_t index) const { return m_demands[index]; }
+
+	/**
+	 * \brief Obtém a geração máxima de um gerador (INT_MAX se não tem limite).
+	 */
+	int getSupplyLimit(std::size_t index) const { return m_supplies.empty() ? INT_MAX : m_supplies[index]; }
+
+	/**
+	 * \brief Obtém a demanda firme de um consumidor, que não pode deixar de ser atendida.
+	 */
+	int getFirmDemand(std::size_t index) const { return m_firmDemands.empty() ? 0 : m_firmDemands[index]; }
+
+	/**
+	 * \brief Obtém os índices dos geradores, na ordem em que foram definidos.
+	 */
+	std::span<const std::uint32_t> getGenerators() const { return m_generators; }
+
+	/**
+	 * \brief Índice do nó de origem da conexão 'edge'.
+	 */
+	std::size_t getEdgeSource(std::size_t edge) const { return m_edgeSources[edge]; }
+
+	/**
+	 * \brief Índice do nó de destino da conexão 'edge'.
+	 */
+	std::size_t getEdgeTarget(std::size_t edge) const { return m_edgeTargets[edge]; }
+
+	/**
+	 * \brief Capacidade da conexão 'edge'.
+	 */
+	int getEdgeCapacity(std::size_t edge) const { return m_edgeCapacities[edge]; }
+
+	/**
+	 * \brief Custo por unidade de fluxo da conexão 'edge' (zero se a entrada não traz custos).
+	 */
+	int getEdgeCost(std::size_t edge) const { return m_edgeCosts.empty() ? 0 : m_edgeCosts[edge]; }
+
+	/**
+	 * \brief Verifica se a entrada traz o custo das conexões.
+	 */
+	bool hasEdgeCosts() const { return !m_edgeCosts.empty(); }
+
+	/**
+	 * \brief Fluxo mínimo da conexão 'edge'.
+	 */
+	int getEdgeLowerBound(std::size_t edge) const { return m_edgeLowerBounds.empty() ? 0 : m_edgeLowerBounds[edge]; }
+
+	/**
+	 * \brief Verifica se algum gerador tem geração máxima.
+	 */
+	bool hasSupplyLimits() const { return !m_supplies.empty(); }
+
+	/**
+	 * \brief Verifica se a rede tem limites inferiores: demandas firmes ou fluxos mínimos.
+	 */
+	bool hasLowerBounds() const { return !m_firmDemands.empty() || !m_edgeLowerBounds.empty(); }
+
+	/**
+	 * \brief Vetores da rede, na forma em que são gravados por 'NetworkSnapshot'.
+	 */
+	std::span<const int> getDemands() const { return m_demands; }
+	std::span<const std::uint32_t> getEdgeSources() const { return m_edgeSources; }
+	std::span<const std::uint32_t> getEdgeTargets() const { return m_edgeTargets; }
+	std::span<const int> getEdgeCapacities() const { return m_edgeCapacities; }
+	std::span<const int> getEdgeCosts() const { return m_edgeCosts; }
+	std::span<const int> getSupplyLimits() const { return m_supplies; }
+	std::span<const int> getFirmDemands() const { return m_firmDemands; }
+	std::span<const int> getEdgeLowerBounds() const { return m_edgeLowerBounds; }
+
+	/**
+	 * \brief Escreve a rede no formato texto lido por 'NetworkParser'.
+	 * \param out Fluxo de saída.
+	 *
+	 * Os geradores são escritos primeiro, na ordem de 'getGenerators()', de modo que a
+	 * rede lida de volta monte a mesma rede de fluxo. A geração máxima e a demanda firme, se
+	 * houver, são a terceira coluna dos nós; os custos e os fluxos mínimos, a quarta e a quinta
+	 * coluna das conexões.
+	 */
+	void print(std::ostream& out) const;
+
+private:
+	std::shared_ptr<const void> m_storage;
+	std::span<const int> m_demands;
+	std::span<const std::uint32_t> m_generators;
+	std::span<const std::uint32_t> m_edgeSources;
+	std::span<const std::uint32_t> m_edgeTargets;
+	std::span<const int> m_edgeCapacities;
+	std::span<const int> m_edgeCosts;
+	std::span<const int> m_supplies;
+	std::span<const int> m_firmDemands;
+	std::span<const int> m_edgeLowerBounds;
+};
+
+/**
+ * \class NetworkBuilder
+ * \brief Monta os vetores de uma 'Network' nó a nó e conexão a conexão.
+ */
+class NetworkBuilder {
+public:
+	/**
+	 * \brief Prepara uma rede com os nós 1..nodeCount ainda não definidos.
+	 * \param nodeCount O número de nós (V).
+	 * \param edgeCount O número de conexões esperado (E), usado para reservar memória.
+	 */
+	NetworkBuilder(std::size_t nodeCount, std::size_t edgeCount);
+
+	/**
+	 * \brief Define o nó 'index'; demanda zero torna o nó um gerador.
+	 * \param index O índice do nó, entre 1 e V. Cada nó é definido uma única vez.
+	 * \param demand A demanda do nó.
+	 */
+	void defineNode(std::size_t index, int demand) {
+		if (demand == 0)
+			m_generators.push_back(static_cast<std::uint32_t>(index));
+		m_demands[index] = demand;
+		m_defined[index] = true;
+	}
+
+	/**
+	 * \brief Verifica se o nó já foi definido.
+	 */
+	bool isDefined(std::size_t index) const { return m_defined[index]; }
+
+	/**
+	 * \brief Limita a geração de um gerador. O vetor de limites só é criado no primeiro limite.
+	 */
+	void setSupplyLimit(std::size_t index, int supply) {
+		if (m_supplies.empty())
+			m_supplies.resize(m_demands.size(), INT_MAX);
+		m_supplies[index] = supply;
+	}
+
+	/**
+	 * \brief Define a demanda firme de um consumidor, entre zero e a sua demanda.
+	 */
+	void setFirmDemand(std::size_t index, int firmDemand) {
+		if (m_firmDemands.empty())
+			m_firmDemands.resize(m_demands.size(), 0);
+		m_firmDemands[index] = firmDemand;
+	}
+
+	/**
+	 * \brief Verifica se algum gerador já foi definido.
+	 */
+	bool hasGenerators() const { return !m_generators.empty(); }
+
+	/**
+	 * \brief Adiciona uma conexão entre dois nós.
+	 * \param source Índice do nó de origem.
+	 * \param target Índice do nó de destino.
+	 * \param capacity Capacidade da conexão.
+	 * \param cost Custo por unidade de fluxo. O vetor de custos só é criado quando aparece o
+	 *             primeiro custo diferente de zero.
+	 * \param lowerBound Fluxo mínimo, entre zero e a capacidade; o vetor é criado do mesmo modo.
+	 */
+	void addEdge(std::size_t source, std::size_t target, int capacity, int cost = 0, int lowerBound = 0) {
+		if (cost != 0 || !m_edgeCosts.empty()) {
+			m_edgeCosts.resize(m_edgeSources.size(), 0);
+			m_edgeCosts.push_back(cost);
+		}
+		if (lowerBound != 0 || !m_edgeLowerBounds.empty()) {
+			m_edgeLowerBounds.resize(m_edgeSources.size(), 0);
+			m_edgeLowerBounds.push_back(lowerBound);
+		}
+		m_edgeSources.push_back(static_cast<std::uint32_t>(source));
+		m_edgeTargets.push_back(static_cast<std::uint32_t>(target));
+		m_edgeCapacities.push_back(capacity);
+	}
+
+	/**
+	 * \brief Entrega os vetores montados a uma nova rede; o construtor fica vazio.
+	 */
+	Network build();
+
+private:
+	std::vector<int> m_demands;
+	std::vector<bool> m_defined;
+	std::vector<std::uint32_t> m_generators;
+	std::vector<std::uint32_t> m_edgeSources;
+	std::vector<std::uint32_t> m_edgeTargets;
+	std::vector<int> m_edgeCapacities;
+	std::vector<int> m_edgeCosts;
+	std::vector<int> m_supplies;
+	std::vector<int> m_firmDemands;
+	std::vector<int> m_edgeLowerBounds;
+};
+
+#endif // NETWORK_H
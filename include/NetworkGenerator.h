@@ -0,0 +1,66 @@
+#ifndef NETWORKGENERATOR_H
+#define NETWORKGENERATOR_H
+
+#include <cstdint>
+#include <string>
+
+#include "Network.h"
+
+/**
+ * \class NetworkGenerator
+ * \brief Gerador de redes sintéticas grandes para testes de desempenho.
+ *
+ * Todas as topologias são determinísticas para uma mesma semente. O número de conexões é
+ * um alvo: a estrutura de cada topologia é gerada em ordem de prioridade e a geração para
+ * quando o alvo é atingido, de modo que um alvo pequeno demais corta a estrutura e um alvo
+ * grande demais pode não ser alcançado (por exemplo, em uma grade sem cordas).
+ */
+class NetworkGenerator {
+public:
+	/**
+	 * \brief Topologias disponíveis.
+	 *
+	 * - Layered: geração -> transmissão -> distribuição. Os geradores alimentam um anel de
+	 *   subestações de transmissão, que alimentam alimentadores radiais de distribuição com
+	 *   algumas interligações locais.
+	 * - Geometric: pontos aleatórios no quadrado unitário, ligados aos vizinhos dentro de um raio.
+	 * - Grid: grade quadrada com conexões nos dois sentidos entre vizinhos; geradores na primeira coluna.
+	 * - Mesh: a grade acrescida de cordas aleatórias de longa distância.
+	 * - Adversarial: corredor longo e estreito com um único gerador e consumidores de demanda 1,
+	 *   em que cada aumento do Edmonds-Karp envia uma unidade após uma BFS sobre todo o trecho já
+	 *   atendido; todas as conexões recebem a capacidade máxima da faixa.
+	 */
+	enum class Topology { Layered, Geometric, Grid, Mesh, Adversarial };
+
+	/**
+	 * \struct Options
+	 * \brief Parâmetros da geração.
+	 */
+	struct Options {
+		Topology topology = Topology::Layered;
+		std::size_t nodeCount = 1000;
+		std::size_t edgeCount = 4000;
+		int minCapacity = 1;
+		int maxCapacity = 1000;
+		std::uint64_t seed = 1;
+	};
+
+	/**
+	 * \brief Obtém a topologia a partir do seu nome ("layered", "geometric", "grid", "mesh" ou "adversarial").
+	 * \throws std::runtime_error Se o nome não for conhecido.
+	 */
+	static Topology parseTopology(const std::string& name);
+
+	/**
+	 * \brief Gera uma rede.
+	 * \param options Os parâmetros da geração.
+	 * \return A rede, com ao menos um gerador e um consumidor.
+	 *
+	 * \throws std::runtime_error Se a rede tiver menos de dois nós ou a faixa de capacidades for inválida.
+	 *
+	 * \complexidade O(V + E) esperado.
+	 */
+	static Network generate(const Options& options);
+};
+
+#endif // NETWORKGENERATOR_H
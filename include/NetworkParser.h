@@ -0,0 +1,63 @@
+#ifndef NETWORKPARSER_H
+#define NETWORKPARSER_H
+
+#include <string>
+
+#include "Network.h"
+
+/**
+ * \class NetworkParser
+ * \brief Leitor do formato texto de descrição da rede.
+ *
+ * O formato tem uma linha "V E", V linhas "índice tipo [limite]" e E linhas
+ * "origem destino capacidade [custo [mínimo]]". O tipo é 0 para geradores ou a demanda do
+ * consumidor. As colunas entre colchetes são opcionais:
+ *
+ * - limite: para um gerador, a geração máxima (sem ela, ilimitada); para um consumidor, a
+ *   demanda firme, que precisa ser atendida e não pode passar da demanda.
+ * - custo: o custo por unidade de fluxo da conexão (sem ele, 0).
+ * - mínimo: o fluxo mínimo da conexão, até a capacidade (sem ele, 0); só é lido depois do
+ *   custo.
+ *
+ * Os inteiros são lidos byte a byte diretamente para os vetores de 'Network', sem
+ * 'std::istream' e sem alocar objetos por linha. Linhas em branco são ignoradas. Uma coluna
+ * opcional é lida quando o próximo campo começa com um dígito; o restante da linha é ignorado
+ * a partir do primeiro campo que não começa com um dígito ou depois da última coluna opcional.
+ * Um comentário no fim de uma linha, como "1 2 4 3 # linha norte", é ignorado, desde que não
+ * comece com um dígito.
+ *
+ * Erros de formato lançam 'std::runtime_error' com o número da linha, por exemplo
+ * "linha 7: esperado 'origem destino capacidade'".
+ */
+class NetworkParser {
+public:
+	/**
+	 * \brief Lê uma rede de um arquivo, mapeando-o em memória.
+	 * \param path Caminho do arquivo.
+	 * \return A rede lida.
+	 *
+	 * \throws std::runtime_error Se o arquivo não puder ser aberto ou estiver malformado.
+	 */
+	static Network parseFile(const std::string& path);
+
+	/**
+	 * \brief Lê uma rede de um descritor de arquivo (por exemplo, a entrada padrão).
+	 * \param fd O descritor, lido em blocos grandes com 'read'.
+	 * \return A rede lida.
+	 *
+	 * \throws std::runtime_error Se a leitura falhar ou a entrada estiver malformada.
+	 */
+	static Network parseDescriptor(int fd);
+
+	/**
+	 * \brief Lê uma rede de um bloco de memória.
+	 * \param data Início do texto.
+	 * \param size Tamanho do texto em bytes.
+	 * \return A rede lida.
+	 *
+	 * \throws std::runtime_error Se o texto estiver malformado.
+	 */
+	static Network parseBuffer(const char* data, std::size_t size);
+};
+
+#endif // NETWORKPARSER_H
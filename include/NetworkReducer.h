@@ -0,0 +1,112 @@
+#ifndef NETWORKREDUCER_H
+#define NETWORKREDUCER_H
+
+#include <cstdint>
+#include <vector>
+
+#include "Network.h"
+#include "ResidualGraph.h"
+
+/**
+ * \class NetworkReducer
+ * \brief Reduz a rede de fluxo antes de resolvê-la e devolve a solução às arestas originais.
+ *
+ * A rede de fluxo é a mesma de 'ResidualGraph(const Network&)', com a super origem, o super
+ * sumidouro e as suas arestas. A redução tem três passos:
+ *
+ * 1. Poda: são removidos os nós que não são alcançados a partir da super origem (BFS direta) ou
+ *    que não alcançam o super sumidouro (BFS reversa), além das arestas de capacidade zero e dos
+ *    laços. Nenhuma dessas arestas pode levar fluxo.
+ * 2. Arestas paralelas: as arestas com a mesma origem e o mesmo destino viram uma só, com a soma
+ *    das capacidades.
+ * 3. Cadeias em série: um nó com uma única aresta de entrada e uma única de saída é removido, e as
+ *    duas arestas viram uma só, com a menor capacidade. Um consumidor folha, por exemplo, tem
+ *    apenas a aresta que o alimenta e a do super sumidouro. Os passos 2 e 3 são repetidos até que
+ *    nenhum se aplique.
+ *
+ * As capacidades da rede reduzida têm 64 bits, pois a soma de arestas paralelas pode passar de
+ * INT_MAX. O fluxo de cada aresta reduzida é distribuído entre as arestas que ela substituiu:
+ * igual em todas as de uma cadeia e, entre arestas paralelas, preenchendo uma de cada vez.
+ */
+class NetworkReducer {
+public:
+	using Graph = BasicResidualGraph<std::int64_t>;
+
+	/**
+	 * \brief Reduz a rede.
+	 * \param network A rede elétrica.
+	 *
+	 * \complexidade O(V + E) esperado (tabela hash dos pares de nós).
+	 */
+	NetworkReducer(const Network& network);
+
+	/**
+	 * \brief A rede reduzida, pronta para os algoritmos de fluxo.
+	 */
+	Graph& getGraph() { return m_graph; }
+	const Graph& getGraph() const { return m_graph; }
+
+	/**
+	 * \brief Identificadores da super origem e do super sumidouro na rede reduzida.
+	 */
+	Graph::NodeId getSource() const { return m_source; }
+	Graph::NodeId getSink() const { return m_sink; }
+
+	/**
+	 * \brief Número de nós e de arestas da rede de fluxo original, com a super origem, o super
+	 *        sumidouro e as suas arestas.
+	 */
+	std::size_t getOriginalNodeCount() const { return m_originalNodeCount; }
+	std::size_t getOriginalEdgeCount() const { return m_originalEdgeCount; }
+
+	/**
+	 * \brief Distribui o fluxo da rede reduzida entre as arestas originais.
+	 * \return O fluxo de cada aresta da rede de fluxo original, na numeração de
+	 *         'ResidualGraph(const Network&)', pronto para 'ResidualGraph::setEdgeFlows'.
+	 *
+	 * \complexidade O(E).
+	 */
+	std::vector<int> expandFlows() const;
+
+private:
+	/**
+	 * \struct Item
+	 * \brief Aresta da rede reduzida: uma aresta original, uma cadeia em série ou um grupo paralelo.
+	 */
+	struct Item {
+		enum class Kind { Edge, Series, Parallel };
+
+		Kind kind;
+		std::uint32_t tail;
+		std::uint32_t head;
+		std::int64_t capacity;
+
+		/**
+		 * \brief Número da aresta original ('Edge') ou dos itens substituídos (as demais).
+		 */
+		std::size_t edge;
+		std::vector<std::size_t> children;
+	};
+
+	std::vector<Item> m_items;
+
+	/**
+	 * \brief Item de cada aresta da rede reduzida.
+	 */
+	std::vector<std::size_t> m_reducedItems;
+
+	std::size_t m_originalNodeCount;
+	std::size_t m_originalEdgeCount;
+	Graph::NodeId m_source;
+	Graph::NodeId m_sink;
+
+	Graph m_graph;
+
+	/**
+	 * \brief Aplica a poda, a fusão de paralelas e a contração de cadeias, preenchendo
+	 *        'm_items' e 'm_reducedItems' e retornando a rede reduzida.
+	 */
+	Graph reduce(const Network& network);
+};
+
+#endif // NETWORKREDUCER_H
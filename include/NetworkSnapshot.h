@@ -0,0 +1,111 @@
+#ifndef NETWORKSNAPSHOT_H
+#define NETWORKSNAPSHOT_H
+
+#include <cstdint>
+#include <span>
+#include <string>
+
+#include "Network.h"
+#include "ResidualGraph.h"
+
+/**
+ * \class NetworkSnapshot
+ * \brief Formato binário versionado de uma rede e, opcionalmente, do fluxo calculado sobre ela.
+ *
+ * O arquivo começa com um cabeçalho de tamanho fixo ('Header') seguido das seções
+ * demandas (int32[V + 2]), geradores (uint32[G]), origens, destinos e capacidades das
+ * conexões (uint32[E], uint32[E], int32[E]) e, se houver fluxo, o fluxo de cada aresta
+ * da rede de fluxo (int32[F]). Cada seção começa em um deslocamento múltiplo de 8 bytes.
+ *
+ * A carga mapeia o arquivo em memória e a 'Network' resultante enxerga as seções
+ * diretamente, sem cópia nem conversão: apenas o cabeçalho e os tamanhos das seções são
+ * verificados, em tempo O(1). O conteúdo dos vetores é conferido por 'validate', que precisa
+ * ser chamada antes de montar a rede de fluxo de um arquivo que pode estar adulterado.
+ *
+ * Os inteiros são gravados na ordem de bytes da máquina; um arquivo gravado em uma
+ * máquina com a ordem oposta é recusado.
+ */
+class NetworkSnapshot {
+public:
+	/**
+	 * \brief Versão do formato gravada por 'write'.
+	 */
+	static constexpr std::uint32_t VERSION = 1;
+
+	/**
+	 * \brief Grava uma rede e, opcionalmente, o fluxo calculado sobre ela.
+	 * \param path Caminho do arquivo.
+	 * \param network A rede.
+	 * \param flow A rede de fluxo montada a partir de 'network', ou nulo para gravar só a rede.
+	 * \param maxFlow O valor do fluxo máximo de 'flow'.
+	 *
+	 * \throws std::runtime_error Se o arquivo não puder ser gravado ou se a rede tem o custo
+	 *                            das conexões, limites de geração ou limites mínimos, que o
+	 *                            formato não guarda.
+	 */
+	static void write(const std::string& path, const Network& network, const ResidualGraph* flow = nullptr, int maxFlow = 0);
+
+	/**
+	 * \brief Verifica se o arquivo começa com a assinatura do formato.
+	 * \param path Caminho do arquivo.
+	 * \return Falso se o arquivo não puder ser lido ou não for um snapshot.
+	 */
+	static bool isSnapshot(const std::string& path);
+
+	/**
+	 * \brief Carrega um snapshot, mapeando-o em memória.
+	 * \param path Caminho do arquivo.
+	 * \return O snapshot; o mapeamento é mantido enquanto o snapshot ou a rede existirem.
+	 *
+	 * \throws std::runtime_error Se o arquivo não puder ser aberto, tiver outra versão ou
+	 *         ordem de bytes, ou se as seções não couberem no arquivo.
+	 *
+	 * \complexidade O(1), além do custo do mapeamento.
+	 */
+	static NetworkSnapshot load(const std::string& path);
+
+	/**
+	 * \brief Confere o conteúdo das seções com as mesmas regras do formato texto: nós e geradores
+	 *        entre 1 e V, geradores com demanda zero, demandas e capacidades não negativas.
+	 *
+	 * Se houver fluxo, confere também que há um fluxo por aresta da rede de fluxo, entre zero e
+	 * a capacidade, que ele se conserva em cada nó da entrada e que o fluxo máximo do cabeçalho
+	 * é o que chega ao super sumidouro.
+	 *
+	 * \throws std::runtime_error Se algum valor estiver fora do intervalo ou o fluxo for
+	 *                            inconsistente.
+	 *
+	 * \complexidade O(V + E).
+	 */
+	void validate() const;
+
+	/**
+	 * \brief A rede gravada.
+	 */
+	const Network& getNetwork() const { return m_network; }
+
+	/**
+	 * \brief Verifica se o snapshot contém um fluxo.
+	 */
+	bool hasFlow() const { return m_hasFlow; }
+
+	/**
+	 * \brief Fluxo de cada aresta da rede de fluxo, na numeração de 'ResidualGraph(const Network&)'.
+	 */
+	std::span<const int> getFlows() const { return m_flows; }
+
+	/**
+	 * \brief Valor do fluxo máximo gravado (zero se não houver fluxo).
+	 */
+	int getMaxFlow() const { return m_maxFlow; }
+
+private:
+	NetworkSnapshot() {}
+
+	Network m_network;
+	std::span<const int> m_flows;
+	bool m_hasFlow = false;
+	int m_maxFlow = 0;
+};
+
+#endif // NETWORKSNAPSHOT_H
@@ -0,0 +1,186 @@
+#ifndef PARAMETRICMAXFLOW_H
+#define PARAMETRICMAXFLOW_H
+
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+#include "Network.h"
+#include "ResidualGraph.h"
+
+/**
+ * \struct ParametricPoint
+ * \brief Fluxo máximo da rede com as demandas multiplicadas por 'lambda'.
+ */
+struct ParametricPoint {
+	double lambda;
+	std::int64_t maxFlow;
+
+	/**
+	 * \brief Demanda total com o fator aplicado.
+	 */
+	std::int64_t demand;
+
+	/**
+	 * \brief Reta do corte mínimo encontrado, 'cutConstant + cutSlope * lambda': a soma das
+	 *        capacidades das conexões e arestas de geradores no corte, e a soma das demandas
+	 *        originais dos consumidores cuja aresta do sumidouro está no corte. 'cutSlope' é o
+	 *        ganho de fluxo por unidade de 'lambda' a partir deste ponto.
+	 */
+	std::int64_t cutConstant;
+	std::int64_t cutSlope;
+};
+
+/**
+ * \struct ParametricBreakpoint
+ * \brief Ponto em que o corte mínimo muda e a curva do fluxo máximo, sem o arredondamento das
+ *        demandas, muda de inclinação.
+ */
+struct ParametricBreakpoint {
+	double lambda;
+	double maxFlow;
+};
+
+/**
+ * \class ParametricMaxFlow
+ * \brief Fluxo máximo em função de um fator 'lambda' aplicado a todas as demandas.
+ *
+ * A aresta de cada consumidor para o super sumidouro tem capacidade floor(lambda * demanda),
+ * que só cresce com 'lambda'. Os fatores são resolvidos em ordem crescente sobre a mesma rede
+ * residual: o fluxo do fator anterior continua válido, e o algoritmo só envia o que as novas
+ * capacidades permitem, sem voltar ao fluxo zero.
+ *
+ * Sem o arredondamento, o fluxo máximo é o mínimo das retas de todos os cortes, uma função
+ * côncava e linear por partes de 'lambda'. 'breakpoints' encontra as suas mudanças de
+ * inclinação de forma exata, independentemente dos fatores da varredura (Eisner e Severance):
+ * entre dois cortes mínimos, resolve a rede no fator em que as suas retas se cruzam; se o
+ * corte mínimo desse fator passa pelo cruzamento, ele é uma mudança de inclinação, e senão a
+ * sua reta divide o intervalo em dois. O fator do cruzamento é uma fração p/q, e a rede é
+ * resolvida com as conexões multiplicadas por q e as demandas por p, em inteiros.
+ *
+ * Os lados da origem dos cortes mínimos encontrados diminuem quando 'lambda' cresce (Gallo,
+ * Grigoriadis e Tarjan), então cada intervalo só resolve os nós que mudam de lado entre os seus
+ * dois cortes, com os que ficam do lado da origem nos dois contraídos na origem e os demais no
+ * sumidouro.
+ */
+class ParametricMaxFlow {
+public:
+	using Graph = BasicResidualGraph<std::int64_t>;
+	using MaxFlowAlgorithm = std::function<std::int64_t(Graph&, Graph::NodeId, Graph::NodeId)>;
+
+	/**
+	 * \brief Maior fator aceito; com ele, as capacidades ainda cabem em 64 bits.
+	 */
+	static constexpr double MAX_LAMBDA = 1e6;
+
+	/**
+	 * \brief Maior número de fatores de uma lista.
+	 */
+	static constexpr std::size_t MAX_POINTS = 1 << 20;
+
+	/**
+	 * \brief Monta a rede de fluxo de 'network', ainda sem demanda ('lambda' = 0).
+	 * \param network A rede elétrica.
+	 * \param algorithm O algoritmo de fluxo máximo; precisa aceitar uma rede que já tem fluxo.
+	 */
+	ParametricMaxFlow(const Network& network, MaxFlowAlgorithm algorithm);
+
+	/**
+	 * \brief Resolve a rede com as demandas multiplicadas por 'lambda'.
+	 * \param lambda O fator, entre o do ponto anterior e 'MAX_LAMBDA'.
+	 *
+	 * \throws std::runtime_error Se 'lambda' for menor que o do ponto anterior ou estiver fora
+	 *                            do intervalo.
+	 *
+	 * \complexidade O(V + E) para ajustar as capacidades e achar o corte, mais o custo do
+	 *               algoritmo para enviar o fluxo que falta.
+	 */
+	ParametricPoint solve(double lambda);
+
+	/**
+	 * \brief Resolve todos os fatores, em ordem crescente.
+	 * \return Um ponto por fator, em ordem crescente de 'lambda'.
+	 */
+	std::vector<ParametricPoint> sweep(std::vector<double> lambdas);
+
+	/**
+	 * \brief Mudanças de inclinação da curva sem arredondamento entre 'first' e 'last'.
+	 * \return As mudanças, em ordem crescente de 'lambda'.
+	 *
+	 * Não altera a rede residual de 'solve'; cada fator é resolvido do zero, em outra rede.
+	 *
+	 * \throws std::runtime_error Se as capacidades multiplicadas de algum fator não couberem em
+	 *                            64 bits.
+	 *
+	 * \complexidade Duas execuções do algoritmo na rede inteira e no máximo 2k - 1 em redes
+	 *               contraídas, onde k é o número de mudanças da curva; as redes de uma mesma
+	 *               profundidade da divisão somam no máximo V nós e E arestas.
+	 */
+	std::vector<ParametricBreakpoint> breakpoints(double first, double last) const;
+
+	/**
+	 * \brief Lê uma lista de fatores: valores separados por vírgula ("0.5,1,1.5") ou um intervalo
+	 *        "início:fim:passo", que inclui o fim quando ele cai na sequência.
+	 *
+	 * \throws std::runtime_error Se a lista estiver malformada ou tiver mais de 'MAX_POINTS' fatores.
+	 */
+	static std::vector<double> parseLambdas(const std::string& text);
+
+	/**
+	 * \brief A rede residual com o fluxo do último ponto.
+	 */
+	const Graph& getGraph() const { return m_graph; }
+
+private:
+	/**
+	 * \struct CutLine
+	 * \brief Reta 'constant + slope * lambda' de um corte, como em 'ParametricPoint'.
+	 */
+	struct CutLine {
+		std::int64_t constant;
+		std::int64_t slope;
+	};
+
+	/**
+	 * \brief Reta do corte cujo lado da origem é 'sourceSide'.
+	 */
+	CutLine cutLine(const std::vector<std::uint8_t>& sourceSide) const;
+
+	/**
+	 * \brief Lado da origem do corte mínimo com capacidade 'sinkCapacity' em todas as arestas do
+	 *        super sumidouro, calculado do zero em uma cópia da rede.
+	 */
+	std::vector<std::uint8_t> minCutSide(std::int64_t sinkCapacity) const;
+
+	/**
+	 * \brief Lado da origem do corte mínimo no fator 'numerator / denominator', entre os nós
+	 *        'order[begin..end)'.
+	 * \return Um valor por nó da região, na ordem de 'order'.
+	 *
+	 * Os nós depois de 'end' em 'order' são contraídos na origem e os antes de 'begin', no
+	 * sumidouro. As conexões são multiplicadas por 'denominator' e as demandas por 'numerator'.
+	 *
+	 * \throws std::runtime_error Se as capacidades multiplicadas não couberem em 64 bits.
+	 */
+	std::vector<std::uint8_t> regionMinCut(const std::vector<Graph::NodeId>& order,
+		const std::vector<std::size_t>& positions, std::size_t begin, std::size_t end,
+		std::int64_t numerator, std::int64_t denominator) const;
+
+	Graph m_graph;
+	MaxFlowAlgorithm m_algorithm;
+	Graph::NodeId m_source;
+	Graph::NodeId m_sink;
+
+	/**
+	 * \brief Aresta de cada consumidor para o super sumidouro e a sua demanda original.
+	 */
+	std::vector<std::size_t> m_sinkEdges;
+	std::vector<int> m_demands;
+	std::vector<int> m_nodeDemands;
+
+	double m_lambda;
+	std::int64_t m_maxFlow;
+};
+
+#endif // PARAMETRICMAXFLOW_H
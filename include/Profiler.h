@@ -0,0 +1,142 @@
+#ifndef PROFILER_H
+#define PROFILER_H
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <limits>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+/**
+ * \class Profiler
+ * \brief Contadores dos laços críticos dos algoritmos de fluxo e tempo de cada fase do programa.
+ *
+ * Os contadores ('count' e 'sample') só existem quando o programa é compilado com
+ * 'METALMAX_PROFILE' ('make PROFILE=1'). Sem ela, 'enabled' é falso e as funções são vazias e
+ * 'inline', de modo que o compilador as remove dos laços. Os tempos das fases ('ScopedPhase')
+ * custam duas leituras do relógio por fase e estão sempre disponíveis.
+ *
+ * Os contadores são atômicos e podem ser usados por várias threads ao mesmo tempo (lote de
+ * cenários, push-relabel paralelo).
+ */
+class Profiler {
+public:
+#ifdef METALMAX_PROFILE
+	static constexpr bool enabled = true;
+#else
+	static constexpr bool enabled = false;
+#endif
+
+	/**
+	 * \brief Eventos contados.
+	 */
+	enum class Counter {
+		BfsCalls,        ///< Buscas em largura (caminhos aumentantes e grafos de níveis).
+		EdgesScanned,    ///< Arcos examinados nas buscas em largura.
+		AugmentingPaths, ///< Caminhos aumentantes (Edmonds-Karp, escalonamento, Dinic).
+		Pushes,          ///< Envios do push-relabel.
+		Relabels,        ///< Reetiquetagens do push-relabel.
+		GlobalRelabels,  ///< Reetiquetagens globais do push-relabel.
+		Count
+	};
+
+	/**
+	 * \brief Valores acompanhados por quantidade, soma, mínimo e máximo.
+	 */
+	enum class Distribution {
+		PathLength, ///< Arcos de cada caminho aumentante.
+		Bottleneck, ///< Capacidade residual mínima (fluxo enviado) de cada caminho aumentante.
+		Count
+	};
+
+	/**
+	 * \brief Soma 'amount' ao contador.
+	 */
+	static void count([[maybe_unused]] Counter counter, [[maybe_unused]] std::uint64_t amount = 1) {
+		if constexpr (enabled)
+			s_counters[static_cast<std::size_t>(counter)].fetch_add(amount, std::memory_order_relaxed);
+	}
+
+	/**
+	 * \brief Registra um valor da distribuição.
+	 */
+	static void sample([[maybe_unused]] Distribution distribution, [[maybe_unused]] double value) {
+		if constexpr (enabled)
+			s_distributions[static_cast<std::size_t>(distribution)].add(value);
+	}
+
+	/**
+	 * \brief Obtém o valor atual de um contador (zero sem 'METALMAX_PROFILE').
+	 */
+	static std::uint64_t get(Counter counter) {
+		return s_counters[static_cast<std::size_t>(counter)].load(std::memory_order_relaxed);
+	}
+
+	/**
+	 * \brief Soma o tempo de uma fase; fases com o mesmo nome são acumuladas.
+	 * \param name O nome da fase, por exemplo "parse".
+	 * \param milliseconds A duração.
+	 */
+	static void addPhase(const std::string& name, double milliseconds);
+
+	/**
+	 * \brief Zera os contadores e as fases.
+	 */
+	static void reset();
+
+	/**
+	 * \brief Escreve o resumo em JSON.
+	 *
+	 * \details O objeto tem "instrumented" (se os contadores foram compilados), "phases_ms"
+	 *          (as fases na ordem em que apareceram) e, com 'METALMAX_PROFILE', "counters" e
+	 *          "distributions" (com "count", "sum", "min", "max" e "mean" de cada uma).
+	 */
+	static void writeJson(std::ostream& out);
+
+	/**
+	 * \class ScopedPhase
+	 * \brief Mede o tempo entre a construção e a destruição e o soma à fase.
+	 */
+	class ScopedPhase {
+	public:
+		explicit ScopedPhase(std::string name) : m_name(std::move(name)), m_start(std::chrono::steady_clock::now()) {}
+		~ScopedPhase() {
+			std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - m_start;
+			addPhase(m_name, elapsed.count());
+		}
+
+		ScopedPhase(const ScopedPhase&) = delete;
+		ScopedPhase& operator=(const ScopedPhase&) = delete;
+
+	private:
+		std::string m_name;
+		std::chrono::steady_clock::time_point m_start;
+	};
+
+private:
+	/**
+	 * \struct Statistic
+	 * \brief Quantidade, soma, mínimo e máximo de uma distribuição, atualizados atomicamente.
+	 */
+	struct Statistic {
+		std::atomic<std::uint64_t> count{ 0 };
+		std::atomic<double> sum{ 0 };
+		std::atomic<double> min{ std::numeric_limits<double>::infinity() };
+		std::atomic<double> max{ -std::numeric_limits<double>::infinity() };
+
+		void add(double value);
+	};
+
+	static std::array<std::atomic<std::uint64_t>, static_cast<std::size_t>(Counter::Count)> s_counters;
+	static std::array<Statistic, static_cast<std::size_t>(Distribution::Count)> s_distributions;
+
+	static std::mutex s_phaseMutex;
+	static std::vector<std::pair<std::string, double>> s_phases;
+};
+
+#endif // PROFILER_H
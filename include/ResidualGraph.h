@@ -0,0 +1,341 @@
+#ifndef RESIDUALGRAPH_H
+#define RESIDUALGRAPH_H
+
+#include <cstdint>
+#include <span>
+#include <unordered_map>
+#include <vector>
+
+#include "Capacity.h"
+#include "Graph.h"
+#include "Network.h"
+
+/**
+ * \brief Numeração dos nós da rede residual, que define a disposição dos vetores em memória.
+ *
+ * 'Input' mantém a ordem da entrada. 'Bfs' numera os nós na ordem de uma BFS (sem direção) a
+ * partir do primeiro nó (a super origem nas redes de 'Network'), e 'ReverseCuthillMcKee' usa a
+ * ordem de Cuthill-McKee invertida, que reduz a distância entre os números de nós vizinhos.
+ * Em ambos os casos os vizinhos de um nó tendem a ficar próximos em memória, e as buscas dos
+ * algoritmos de fluxo acessam menos linhas de cache distintas.
+ */
+enum class NodeOrder { Input, Bfs, ReverseCuthillMcKee };
+
+/**
+ * \class BasicResidualGraph
+ * \brief Rede residual compacta no formato CSR (Compressed Sparse Row).
+ * \tparam Capacity O tipo das capacidades ('CapacityTraits'); 'ResidualGraph' usa 'int'.
+ *
+ * Cada aresta do grafo original gera dois arcos: o arco direto, com a capacidade
+ * da aresta, e o arco reverso, com capacidade zero. Os arcos de um mesmo nó ficam
+ * contíguos nos vetores de destino, capacidade, capacidade residual e arco par,
+ * delimitados por 'm_offsets'. Os nós são identificados por um índice denso
+ * (a posição do nó em 'Graph::getNodes()'), o que permite que os algoritmos de
+ * fluxo usem vetores simples no lugar de tabelas hash.
+ *
+ * Como em 'GraphEdge', a capacidade residual de um arco direto começa igual à sua
+ * capacidade e diminui à medida que o fluxo passa por ele.
+ */
+template <typename Capacity>
+class BasicResidualGraph {
+public:
+	/**
+	 * \brief Identificador denso de um nó da rede residual.
+	 */
+	using NodeId = std::uint32_t;
+
+	/**
+	 * \brief Identificador de um arco da rede residual.
+	 */
+	using ArcId = std::uint32_t;
+
+	/**
+	 * \brief Valor usado em 'getEdgeId' para indicar um arco reverso.
+	 */
+	static constexpr std::size_t NO_EDGE = static_cast<std::size_t>(-1);
+
+	/**
+	 * \brief Constrói a rede residual a partir de um grafo.
+	 * \param graph Grafo de origem. Os nós recebem o identificador denso igual à sua
+	 *              posição em 'graph->getNodes()'.
+	 * \param order A numeração dos nós; com outra ordem que não 'NodeOrder::Input' o
+	 *              identificador denso é a posição do nó nessa ordem.
+	 *
+	 * As arestas são numeradas na ordem em que aparecem ao percorrer os nós e, para cada
+	 * nó, o vetor 'GraphNode::getEdges()', ignorando as arestas reversas, que são
+	 * recriadas como arcos da rede.
+	 */
+	BasicResidualGraph(Graph* graph, NodeOrder order = NodeOrder::Input);
+
+	/**
+	 * \brief Constrói a rede de fluxo de uma descrição de rede elétrica.
+	 * \param network A descrição da rede.
+	 * \param order A numeração dos nós.
+	 *
+	 * O identificador denso de cada nó é o seu próprio índice: 0 para a super origem,
+	 * 1..V para os nós da entrada e V + 1 para o super sumidouro. As arestas 0..E-1 são
+	 * as conexões da entrada, na mesma ordem; em seguida vêm as arestas da super origem
+	 * para cada gerador (capacidade igual à geração máxima ou, sem limite,
+	 * 'CapacityTraits<Capacity>::infinity()', INT_MAX para 'int') e as de cada consumidor para o
+	 * super sumidouro (capacidade igual à demanda). Os limites inferiores são ignorados.
+	 * Nenhum objeto 'GraphNode' é criado. Com outra ordem que não 'NodeOrder::Input' os nós são
+	 * renumerados ('getNodeId' e 'getNodeIndex' convertem os números), mas a numeração das
+	 * arestas não muda.
+	 */
+	BasicResidualGraph(const Network& network, NodeOrder order = NodeOrder::Input);
+
+	/**
+	 * \brief Constrói a rede a partir de uma lista de arestas.
+	 * \param nodeCount O número de nós; o identificador denso de cada nó é o seu índice.
+	 * \param tails Nó de origem de cada aresta.
+	 * \param heads Nó de destino de cada aresta.
+	 * \param capacities Capacidade de cada aresta, por exemplo fracionária com 'double'.
+	 *
+	 * A aresta 'e' recebe o número 'e'.
+	 *
+	 * \throws std::runtime_error Se as listas tiverem tamanhos diferentes ou um nó não existir.
+	 */
+	BasicResidualGraph(std::size_t nodeCount, std::span<const NodeId> tails, std::span<const NodeId> heads,
+		std::span<const Capacity> capacities);
+
+	/**
+	 * \brief Obtém o número de nós da rede.
+	 */
+	std::size_t getNodeCount() const { return m_nodeIndices.size(); }
+
+	/**
+	 * \brief Obtém o número de arcos (diretos e reversos) da rede.
+	 */
+	std::size_t getArcCount() const { return m_heads.size(); }
+
+	/**
+	 * \brief Obtém o número de arestas do grafo original (arcos diretos).
+	 */
+	std::size_t getEdgeCount() const { return m_edgeArcs.size(); }
+
+	/**
+	 * \brief Obtém o identificador denso de um nó a partir de seu índice.
+	 * \param index O índice do nó ('GraphNode::getIndex()').
+	 * \return O identificador denso do nó.
+	 */
+	NodeId getNodeId(std::size_t index) const {
+		if (!m_nodeIds.empty())
+			return m_nodeIds.at(index);
+		return m_denseIds.empty() ? static_cast<NodeId>(index) : m_denseIds[index];
+	}
+
+	/**
+	 * \brief Obtém o índice original ('GraphNode::getIndex()') de um nó.
+	 */
+	std::size_t getNodeIndex(NodeId node) const { return m_nodeIndices[node]; }
+
+	/**
+	 * \brief Primeiro arco do nó.
+	 */
+	ArcId begin(NodeId node) const { return m_offsets[node]; }
+
+	/**
+	 * \brief Arco seguinte ao último arco do nó.
+	 */
+	ArcId end(NodeId node) const { return m_offsets[node + 1]; }
+
+	/**
+	 * \brief Nó de destino do arco.
+	 */
+	NodeId getHead(ArcId arc) const { return m_heads[arc]; }
+
+	/**
+	 * \brief Arco par (reverso) do arco.
+	 */
+	ArcId getReverse(ArcId arc) const { return m_reverse[arc]; }
+
+	/**
+	 * \brief Capacidade original do arco (zero para arcos reversos).
+	 */
+	Capacity getCapacity(ArcId arc) const { return m_capacities[arc]; }
+
+	/**
+	 * \brief Capacidade residual do arco.
+	 */
+	Capacity getResidual(ArcId arc) const { return m_residuals[arc]; }
+
+	/**
+	 * \brief Quanto fluxo saturar o arco envia, como na pré-carga do push-relabel.
+	 *
+	 * É a capacidade residual, exceto em arcos infinitos com 'double': como 'inf - inf' não é
+	 * um número, o envio fica limitado à soma das capacidades que saem do nó de destino,
+	 * que é tudo o que ele pode repassar.
+	 */
+	Capacity getSaturatingAmount(ArcId arc) const {
+		if constexpr (std::is_floating_point_v<Capacity>) {
+			if (m_residuals[arc] == CapacityTraits<Capacity>::infinity()) {
+				Capacity total = 0;
+				for (ArcId next = begin(m_heads[arc]); next < end(m_heads[arc]); next++)
+					total += m_capacities[next];
+				return total;
+			}
+		}
+		return m_residuals[arc];
+	}
+
+	/**
+	 * \brief Fluxo que passa pelo arco, igual à capacidade residual do arco par.
+	 */
+	Capacity getFlow(ArcId arc) const { return m_residuals[m_reverse[arc]]; }
+
+	/**
+	 * \brief Número da aresta original do arco, ou 'NO_EDGE' para arcos reversos.
+	 */
+	std::size_t getEdgeId(ArcId arc) const { return m_edgeIds[arc]; }
+
+	/**
+	 * \brief Fluxo que passa pela aresta original 'edge'.
+	 */
+	Capacity getEdgeFlow(std::size_t edge) const { return getFlow(m_edgeArcs[edge]); }
+
+	/**
+	 * \brief Envia 'amount' unidades de fluxo pelo arco, atualizando o arco par.
+	 */
+	void push(ArcId arc, Capacity amount) {
+		m_residuals[arc] -= amount;
+		m_residuals[m_reverse[arc]] += amount;
+	}
+
+	/**
+	 * \brief Altera a capacidade de um arco direto, mantendo o fluxo que passa por ele.
+	 * \param arc O arco direto.
+	 * \param capacity A nova capacidade, que não pode ser menor que 'getFlow(arc)'.
+	 */
+	void setCapacity(ArcId arc, Capacity capacity) {
+		m_residuals[arc] += capacity - m_capacities[arc];
+		m_capacities[arc] = capacity;
+	}
+
+	/**
+	 * \brief Arco direto da aresta original 'edge'.
+	 */
+	ArcId getEdgeArc(std::size_t edge) const { return m_edgeArcs[edge]; }
+
+	/**
+	 * \brief Restaura as capacidades residuais para a rede sem fluxo.
+	 */
+	void reset();
+
+	/**
+	 * \brief Restaura um fluxo já calculado, por exemplo lido de um 'NetworkSnapshot'.
+	 * \param flows O fluxo de cada aresta, na ordem de numeração ('getEdgeCount()' entradas).
+	 *
+	 * \throws std::runtime_error Se o número de fluxos não corresponder ao de arestas ou se
+	 *         algum fluxo for negativo ou maior que a capacidade da aresta.
+	 */
+	void setEdgeFlows(std::span<const Capacity> flows);
+
+	/**
+	 * \brief Copia as capacidades residuais de volta para as arestas do grafo original.
+	 *
+	 * Após a chamada, 'GraphEdge::getFlow()' de cada aresta retorna a capacidade
+	 * residual do arco direto correspondente, e o da sua aresta reversa retorna o
+	 * fluxo que passa pela aresta. As arestas de 'Graph' usam 'int', então os valores
+	 * são convertidos.
+	 */
+	void writeBack();
+
+	/**
+	 * \brief Estima a memória ocupada pela rede, em bytes.
+	 *
+	 * A rede não aloca memória depois de construída: os algoritmos de fluxo apenas
+	 * alteram as capacidades residuais, e o custo de memória de cada aumento é zero.
+	 */
+	std::size_t getMemoryUsage() const;
+
+private:
+	/**
+	 * \brief Posição do primeiro arco de cada nó; possui 'getNodeCount() + 1' entradas.
+	 */
+	std::vector<ArcId> m_offsets;
+
+	/**
+	 * \brief Nó de destino de cada arco.
+	 */
+	std::vector<NodeId> m_heads;
+
+	/**
+	 * \brief Arco par de cada arco.
+	 */
+	std::vector<ArcId> m_reverse;
+
+	/**
+	 * \brief Capacidade original de cada arco.
+	 */
+	std::vector<Capacity> m_capacities;
+
+	/**
+	 * \brief Capacidade residual de cada arco.
+	 */
+	std::vector<Capacity> m_residuals;
+
+	/**
+	 * \brief Número da aresta original de cada arco ('NO_EDGE' para arcos reversos).
+	 */
+	std::vector<std::size_t> m_edgeIds;
+
+	/**
+	 * \brief Arestas do grafo original, na ordem de numeração.
+	 */
+	std::vector<GraphEdge*> m_edges;
+
+	/**
+	 * \brief Arco direto de cada aresta.
+	 */
+	std::vector<ArcId> m_edgeArcs;
+
+	/**
+	 * \brief Índice original de cada nó.
+	 */
+	std::vector<std::size_t> m_nodeIndices;
+
+	/**
+	 * \brief Identificador denso de cada índice original de nó; vazio quando os dois coincidem.
+	 */
+	std::unordered_map<std::size_t, NodeId> m_nodeIds;
+
+	/**
+	 * \brief Identificador denso de cada índice de nó de uma 'Network' renumerada; vazio sem renumeração.
+	 */
+	std::vector<NodeId> m_denseIds;
+
+	/**
+	 * \brief Renumera os nós conforme 'order', reescrevendo as listas de arestas.
+	 * \param order A numeração desejada.
+	 * \param tails Nó de origem de cada aresta, com os identificadores atuais.
+	 * \param heads Nó de destino de cada aresta, com os identificadores atuais.
+	 *
+	 * Atualiza 'm_nodeIndices' e o mapa de identificadores ('m_nodeIds' ou 'm_denseIds').
+	 *
+	 * \complexidade O(V + E), mais O(E log E) para ordenar os vizinhos por grau no Cuthill-McKee.
+	 */
+	void reorder(NodeOrder order, std::vector<NodeId>& tails, std::vector<NodeId>& heads);
+
+	/**
+	 * \brief Preenche os vetores da rede a partir da lista de arestas.
+	 * \param tails Nó de origem de cada aresta.
+	 * \param heads Nó de destino de cada aresta.
+	 * \param capacities Capacidade de cada aresta.
+	 *
+	 * A aresta 'e' recebe o número 'e'. Os arcos de cada nó seguem a ordem das arestas
+	 * agrupadas pelo nó de origem. A construção é feita em duas passadas (contagem de
+	 * graus e preenchimento), em tempo O(V + E).
+	 */
+	void build(std::span<const NodeId> tails, std::span<const NodeId> heads, std::span<const Capacity> capacities);
+};
+
+/**
+ * \brief Rede residual com capacidades de 32 bits, usada pelo programa principal e pelas análises.
+ */
+using ResidualGraph = BasicResidualGraph<int>;
+
+extern template class BasicResidualGraph<int>;
+extern template class BasicResidualGraph<std::int64_t>;
+extern template class BasicResidualGraph<double>;
+
+#endif // RESIDUALGRAPH_H
@@ -0,0 +1,162 @@
+#ifndef SCENARIOBATCH_H
+#define SCENARIOBATCH_H
+
+#include <cstdint>
+#include <functional>
+#include <istream>
+#include <optional>
+#include <ostream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "IncrementalMaxFlow.h"
+#include "Network.h"
+#include "ResidualGraph.h"
+#include "ThreadPool.h"
+
+/**
+ * \struct Scenario
+ * \brief Um cenário de demanda: alterações de demandas e capacidades sobre a rede base.
+ *
+ * Apenas 'NetworkEdit::setDemand' e 'NetworkEdit::setCapacity' são usados; as alterações
+ * valem só para o cenário e são aplicadas na ordem, de modo que a última prevalece.
+ */
+struct Scenario {
+	std::string name;
+	std::vector<NetworkEdit> edits;
+};
+
+/**
+ * \struct ScenarioResult
+ * \brief Resultado de um cenário.
+ */
+struct ScenarioResult {
+	std::string name;
+	int maxFlow;
+	std::int64_t unmetDemand;
+};
+
+/**
+ * \class ScenarioReader
+ * \brief Lê uma sequência de cenários de um fluxo de texto, um por vez.
+ *
+ * O formato tem um bloco por cenário:
+ *
+ *     cenario NOME
+ *     demanda ÍNDICE VALOR
+ *     capacidade ORIGEM DESTINO VALOR
+ *
+ * com qualquer número de linhas 'demanda' e 'capacidade'. O cenário termina no próximo
+ * 'cenario' ou no fim da entrada. Uma linha 'capacidade' altera todas as conexões de ORIGEM
+ * para DESTINO. Linhas em branco e linhas iniciadas por '#' são ignoradas.
+ *
+ * Erros lançam 'std::runtime_error' com o número da linha, como em 'NetworkParser'.
+ */
+class ScenarioReader {
+public:
+	/**
+	 * \brief Prepara a leitura.
+	 * \param in O fluxo com os cenários; deve existir enquanto o leitor for usado.
+	 * \param network A rede base, usada para validar os índices e localizar as conexões.
+	 */
+	ScenarioReader(std::istream& in, const Network& network);
+
+	/**
+	 * \brief Lê o próximo cenário.
+	 * \param scenario Recebe o cenário lido.
+	 * \return Falso se a entrada terminou.
+	 *
+	 * \throws std::runtime_error Se o cenário estiver malformado ou se referir a um nó ou
+	 *         conexão inexistente, ou alterar a demanda de um gerador.
+	 */
+	bool next(Scenario& scenario);
+
+private:
+	/**
+	 * \brief Lê a próxima linha não vazia; retorna falso no fim da entrada.
+	 */
+	bool readLine(std::string& line);
+
+	[[noreturn]] void fail(const std::string& message) const;
+
+	std::istream& m_in;
+	const Network& m_network;
+	std::size_t m_line;
+
+	/**
+	 * \brief Nome do cenário cuja linha 'cenario' já foi lida.
+	 */
+	std::optional<std::string> m_pending;
+
+	/**
+	 * \brief Conexões de cada par (origem, destino), com a chave 'origem * (V + 2) + destino'.
+	 */
+	std::unordered_map<std::uint64_t, std::vector<std::size_t>> m_edgesByEndpoints;
+};
+
+/**
+ * \class ScenarioBatch
+ * \brief Resolve uma sequência de cenários sobre uma única rede base, em um único processo.
+ *
+ * A rede base é lida e montada uma vez. Cada thread de 'pool' mantém a sua cópia da rede
+ * residual: para cada cenário as capacidades alteradas são gravadas em 'setCapacity', a rede é
+ * restaurada com 'ResidualGraph::reset' e resolvida do zero, e as capacidades voltam aos
+ * valores da base. Nenhuma memória é alocada por cenário além das próprias alterações.
+ */
+class ScenarioBatch {
+public:
+	using MaxFlowAlgorithm = std::function<int(ResidualGraph&, ResidualGraph::NodeId, ResidualGraph::NodeId)>;
+
+	/**
+	 * \brief Monta a rede base.
+	 * \param network A rede elétrica.
+	 * \param algorithm O algoritmo de fluxo máximo usado em cada cenário.
+	 * \param pool As threads que resolvem os cenários.
+	 */
+	ScenarioBatch(const Network& network, MaxFlowAlgorithm algorithm, ThreadPool& pool);
+
+	/**
+	 * \brief Resolve um cenário na cópia da rede da thread 'thread'.
+	 */
+	ScenarioResult solve(const Scenario& scenario, std::size_t thread);
+
+	/**
+	 * \brief Lê e resolve cenários até o fim da entrada, escrevendo uma linha
+	 *        "nome fluxo demanda_nao_atendida" por cenário.
+	 *
+	 * \details Os cenários são lidos em lotes de algumas vezes o número de threads e resolvidos
+	 *          em paralelo; os resultados de cada lote são escritos, na ordem da entrada, assim
+	 *          que o lote termina, antes de o próximo ser lido.
+	 *
+	 * \return O número de cenários resolvidos.
+	 *
+	 * \throws std::runtime_error Se a entrada estiver malformada; os lotes anteriores já foram escritos.
+	 */
+	std::size_t run(ScenarioReader& reader, std::ostream& out);
+
+private:
+	const Network& m_network;
+	MaxFlowAlgorithm m_algorithm;
+	ThreadPool& m_pool;
+
+	ResidualGraph m_base;
+	std::int64_t m_totalDemand;
+
+	/**
+	 * \brief Aresta do consumidor para o super sumidouro, indexada pelo índice do nó.
+	 */
+	std::vector<std::size_t> m_demandEdges;
+
+	/**
+	 * \brief Cópia da rede residual de cada thread, criada no seu primeiro cenário.
+	 */
+	std::vector<std::optional<ResidualGraph>> m_graphs;
+
+	/**
+	 * \brief Arcos alterados pelo cenário atual de cada thread, restaurados ao seu fim.
+	 */
+	std::vector<std::vector<ResidualGraph::ArcId>> m_changed;
+};
+
+#endif // SCENARIOBATCH_H
@@ -0,0 +1,84 @@
+#ifndef THREADPOOL_H
+#define THREADPOOL_H
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/**
+ * \class ThreadPool
+ * \brief Conjunto fixo de threads que executa laços paralelos ('parallelFor').
+ *
+ * As threads são criadas uma única vez e ficam bloqueadas entre os laços. Os índices de um
+ * laço são distribuídos dinamicamente por um contador atômico, de modo que tarefas de custo
+ * desigual (por exemplo, cenários de contingência) não deixam threads ociosas. A thread que
+ * chama 'parallelFor' também executa tarefas, como a de número 0.
+ */
+class ThreadPool {
+public:
+	/**
+	 * \brief Cria o conjunto de threads.
+	 * \param threadCount Número total de threads, incluindo a que chama 'parallelFor';
+	 *                    zero usa 'std::thread::hardware_concurrency()'.
+	 */
+	explicit ThreadPool(std::size_t threadCount = 0);
+
+	/**
+	 * \brief Encerra as threads.
+	 */
+	~ThreadPool();
+
+	ThreadPool(const ThreadPool&) = delete;
+	ThreadPool& operator=(const ThreadPool&) = delete;
+
+	/**
+	 * \brief Número total de threads, incluindo a que chama 'parallelFor'.
+	 */
+	std::size_t getThreadCount() const { return m_workers.size() + 1; }
+
+	/**
+	 * \brief Executa 'task(index, thread)' para cada índice em [0, count) e aguarda o término.
+	 * \param count Número de índices.
+	 * \param task A tarefa; 'thread' (entre 0 e getThreadCount() - 1) identifica a thread que a
+	 *             executa, para que cada uma use seus próprios vetores de trabalho.
+	 *
+	 * Se alguma tarefa lançar uma exceção, os índices restantes são descartados e a primeira
+	 * exceção é relançada depois que todas as threads terminarem.
+	 */
+	void parallelFor(std::size_t count, const std::function<void(std::size_t index, std::size_t thread)>& task);
+
+private:
+	/**
+	 * \brief Executa índices do laço atual até que acabem.
+	 */
+	void runTasks(std::size_t thread);
+
+	/**
+	 * \brief Laço de cada thread criada: espera um novo laço e executa suas tarefas.
+	 */
+	void workerLoop(std::size_t thread);
+
+	std::vector<std::thread> m_workers;
+	std::mutex m_mutex;
+	std::condition_variable m_start;
+	std::condition_variable m_done;
+
+	/**
+	 * \brief Incrementado a cada laço; as threads comparam com o último laço que executaram.
+	 */
+	std::size_t m_generation = 0;
+	std::size_t m_running = 0;
+	bool m_stop = false;
+
+	const std::function<void(std::size_t, std::size_t)>* m_task = nullptr;
+	std::size_t m_count = 0;
+	std::atomic<std::size_t> m_next{ 0 };
+	std::exception_ptr m_error;
+};
+
+#endif // THREADPOOL_H
@@ -1,61 +1,143 @@
-#include <cassert>
-#include <queue>
+#include <algorithm>
+#include <bit>
+#include <cstdint>
 #include <limits>
+#include <vector>
 
 #include "Algorithms.h"
+#include "Profiler.h"
 
-using GraphNodeHash = GraphNode::GraphNodeHash;
-using GraphNodeEqual = GraphNode::GraphNodeEqual;
+using NodeId = ResidualGraph::NodeId;
+using ArcId = ResidualGraph::ArcId;
 
 namespace {
+	/**
+	 * \struct BfsWorkspace
+	 * \brief Vetores da BFS reaproveitados entre as chamadas, indexados pelo identificador denso do nó.
+	 *
+	 * \details Em vez de limpar a marcação de visitados a cada busca, cada BFS usa um novo valor de
+	 *          'stamp': um nó foi visitado na busca atual se 'visited[nó] == stamp'. Assim uma busca
+	 *          que encontra o sumidouro cedo não paga O(V) para reinicializar os vetores.
+	 */
+	struct BfsWorkspace {
+		BfsWorkspace(std::size_t nodeCount) : parentArc(nodeCount), visited(nodeCount, 0), stamp(0) {
+			queue.reserve(nodeCount);
+		}
+
+		/**
+		 * \brief Arco de entrada de cada nó no caminho encontrado.
+		 */
+		std::vector<ArcId> parentArc;
+
+		/**
+		 * \brief Valor de 'stamp' da última busca que visitou cada nó.
+		 */
+		std::vector<std::uint32_t> visited;
+
+		/**
+		 * \brief Identificador da busca atual.
+		 */
+		std::uint32_t stamp;
+
+		/**
+		 * \brief Vetor usado como fila da BFS.
+		 */
+		std::vector<NodeId> queue;
+
+		/**
+		 * \brief Próxima fronteira e mapas de bits dos visitados e da fronteira atual, usados só
+		 *        pela BFS que otimiza a direção ('bfsDirectionOptimizing').
+		 */
+		std::vector<NodeId> next;
+		std::vector<std::uint64_t> visitedBits;
+		std::vector<std::uint64_t> frontierBits;
+
+		/**
+		 * \brief Estado da busca a partir do sumidouro, usado só pela BFS bidirecional
+		 *        ('bfsBidirectional'): a marcação com 'stamp', o arco de saída de cada nó rumo ao
+		 *        sumidouro e a fronteira.
+		 */
+		std::vector<std::uint32_t> backwardVisited;
+		std::vector<ArcId> childArc;
+		std::vector<NodeId> backwardQueue;
+	};
+
+	/**
+	 * \brief Limites para trocar a direção da BFS.
+	 *
+	 * \details A busca passa a ser de baixo para cima quando os arcos da fronteira superam
+	 *          1/'TOP_DOWN_LIMIT' dos arcos dos nós ainda não visitados, e volta a ser de cima
+	 *          para baixo quando a fronteira tem menos de 1/'BOTTOM_UP_LIMIT' dos nós. Beamer et al.
+	 *          sugerem 14 e 24 para uma BFS completa; aqui a busca para no sumidouro, e os nós que
+	 *          ela nunca alcança (atrás de arcos saturados) são varridos de novo a cada nível de
+	 *          baixo para cima.
+	 *
+	 *          Nenhum limite dá ganho nas redes do 'make bench'. Com 1, a troca praticamente não
+	 *          acontece e a busca é uma BFS de cima para baixo com o custo extra dos mapas de bits;
+	 *          com 4, 8 ou 14 os níveis de baixo para cima pagam as novas varreduras e a busca fica
+	 *          até 2 vezes mais lenta. O valor 1 é o que menos perde, e 'BfsStrategy::TopDown'
+	 *          continua sendo o padrão.
+	 */
+	constexpr std::size_t TOP_DOWN_LIMIT = 1;
+	constexpr std::size_t BOTTOM_UP_LIMIT = 24;
+
 	/**
 	 * \brief Realiza uma BFS no grafo residual para encontrar um caminho de source até sink.
 	 *
 	 * \details Este método utiliza a busca em largura (BFS) para explorar o grafo residual
 	 *          e verificar se existe um caminho entre o nó de origem (`source`) e o nó de destino (`sink`).
-	 *          O grafo residual é representado por `graph`, onde as capacidades residuais indicam
-	 *          a quantidade de fluxo que ainda pode ser enviada pelas arestas.
+	 *          Apenas arcos com capacidade residual positiva são percorridos. Como os arcos de cada nó
+	 *          são contíguos na rede, cada expansão é uma varredura linear sobre vetores.
 	 *
-	 * \param graph Ponteiro para o grafo residual.
-	 * \param source Ponteiro para o nó de origem do caminho.
-	 * \param sink Ponteiro para o nó de destino do caminho.
-	 * \param parentEdge Ponteiro para uma tabela hash que armazena a aresta de entrada para cada nó
-	 *                   no caminho encontrado. É usada para reconstruir o caminho ao término da BFS.
+	 * \param network A rede residual.
+	 * \param source O nó de origem do caminho.
+	 * \param sink O nó de destino do caminho.
+	 * \param workspace Vetores da busca. Ao final, 'workspace.parentArc' guarda o arco de entrada de
+	 *                  cada nó do caminho encontrado, usado para reconstruí-lo.
+	 * \param threshold Menor capacidade residual de um arco percorrido (o 'delta' de 'CapacityScaling');
+	 *                  com zero, basta que a capacidade residual seja positiva.
 	 *
 	 * \return Retorna `true` se um caminho de `source` até `sink` for encontrado, e `false` caso contrário.
 	 *
 	 * \complexidade O(V + E), onde V é o número de nós e E é o número de arestas no grafo.
 	 *               A BFS percorre todas as arestas adjacentes a cada nó uma vez durante a execução.
 	 */
-	bool bfsEdmondKarp(Graph* graph,
-		GraphNode* source,
-		GraphNode* sink,
-		std::unordered_map<GraphNode*, GraphEdge*, GraphNodeHash, GraphNodeEqual>* parentEdge)
+	template <typename Capacity>
+	bool bfsEdmondKarp(const BasicResidualGraph<Capacity>& network,
+		NodeId source,
+		NodeId sink,
+		BfsWorkspace& workspace,
+		Capacity threshold)
 	{
-		parentEdge->clear();
+		std::vector<ArcId>& parentArc = workspace.parentArc;
+		std::vector<std::uint32_t>& visited = workspace.visited;
+		std::vector<NodeId>& queue = workspace.queue;
 
-		std::unordered_map<GraphNode*, bool, GraphNodeHash, GraphNodeEqual> visited;
-		for (auto* node : graph->getNodes()) {
-			visited[node] = false;
+		if (++workspace.stamp == 0) {
+			std::fill(visited.begin(), visited.end(), 0);
+			workspace.stamp = 1;
 		}
+		const std::uint32_t stamp = workspace.stamp;
+		queue.clear();
 
-		std::queue<GraphNode*> queue;
-		queue.push(source);
-		visited[source] = true;
+		queue.push_back(source);
+		visited[source] = stamp;
+		Profiler::count(Profiler::Counter::BfsCalls);
 
-		while (!queue.empty()) {
-			GraphNode* u = queue.front();
-			queue.pop();
+		for (std::size_t head = 0; head < queue.size(); head++) {
+			NodeId u = queue[head];
+			Profiler::count(Profiler::Counter::EdgesScanned, network.end(u) - network.begin(u));
 
-			for (GraphEdge& edge : u->getEdges()) {
-				GraphNode* v = edge.getTarget();
+			for (ArcId arc = network.begin(u); arc < network.end(u); arc++) {
+				NodeId v = network.getHead(arc);
 
-				if (!visited[v] && edge.getFlow() > 0) {
-					(*parentEdge)[v] = &edge;
-					visited[v] = true;
-					queue.push(v);
+				Capacity residual = network.getResidual(arc);
+				if (visited[v] != stamp && CapacityTraits<Capacity>::positive(residual) && residual >= threshold) {
+					parentArc[v] = arc;
+					visited[v] = stamp;
+					queue.push_back(v);
 
-					if (*v == *sink) {
+					if (v == sink) {
 						return true;
 					}
 				}
@@ -65,35 +147,337 @@ namespace {
 		return false;
 	}
 
-}
+	/**
+	 * \brief BFS que otimiza a direção (de cima para baixo ou de baixo para cima) a cada nível.
+	 *
+	 * \details Os níveis pequenos são expandidos como em 'bfsEdmondKarp'. Nos níveis grandes, a
+	 *          fronteira é marcada em um mapa de bits e cada nó não visitado percorre os seus arcos:
+	 *          o reverso de um arco de 'v' para 'u' é um arco de 'u' para 'v', e basta um deles com
+	 *          capacidade residual suficiente e 'u' na fronteira para visitar 'v'. Os parâmetros e o
+	 *          resultado são os de 'bfsEdmondKarp'.
+	 *
+	 * \complexidade O(V + E) por busca; os mapas de bits custam O(V / 64) por nível de baixo para cima.
+	 */
+	template <typename Capacity>
+	bool bfsDirectionOptimizing(const BasicResidualGraph<Capacity>& network,
+		NodeId source,
+		NodeId sink,
+		BfsWorkspace& workspace,
+		Capacity threshold)
+	{
+		std::vector<ArcId>& parentArc = workspace.parentArc;
+		std::vector<NodeId>& frontier = workspace.queue;
+		std::vector<NodeId>& next = workspace.next;
+		std::vector<std::uint64_t>& visited = workspace.visitedBits;
+		std::vector<std::uint64_t>& frontierBits = workspace.frontierBits;
 
-int Algorithms::EdmondKarp(Graph* graph, GraphNode* source, GraphNode* sink)
-{
-	int maxFlow = 0;
+		const std::size_t nodeCount = network.getNodeCount();
+		const std::size_t words = (nodeCount + 63) / 64;
+		visited.assign(words, 0);
+		frontierBits.resize(words);
+		auto isSet = [](const std::vector<std::uint64_t>& bits, NodeId v) { return (bits[v / 64] >> (v % 64)) & 1; };
+		auto set = [](std::vector<std::uint64_t>& bits, NodeId v) { bits[v / 64] |= std::uint64_t(1) << (v % 64); };
+		auto usable = [&](ArcId arc) {
+			Capacity residual = network.getResidual(arc);
+			return CapacityTraits<Capacity>::positive(residual) && residual >= threshold;
+		};
+
+		frontier.clear();
+		frontier.push_back(source);
+		set(visited, source);
+		Profiler::count(Profiler::Counter::BfsCalls);
+
+		std::size_t frontierArcs = network.end(source) - network.begin(source);
+		std::size_t unexploredArcs = network.getArcCount() - frontierArcs;
+		bool bottomUp = false;
+
+		while (!frontier.empty()) {
+			if (!bottomUp)
+				bottomUp = frontierArcs > unexploredArcs / TOP_DOWN_LIMIT;
+			else
+				bottomUp = frontier.size() >= nodeCount / BOTTOM_UP_LIMIT;
+
+			next.clear();
+			std::size_t nextArcs = 0;
+			if (!bottomUp) {
+				for (NodeId u : frontier) {
+					Profiler::count(Profiler::Counter::EdgesScanned, network.end(u) - network.begin(u));
+					for (ArcId arc = network.begin(u); arc < network.end(u); arc++) {
+						NodeId v = network.getHead(arc);
+						if (!isSet(visited, v) && usable(arc)) {
+							parentArc[v] = arc;
+							set(visited, v);
+							if (v == sink)
+								return true;
+							next.push_back(v);
+							nextArcs += network.end(v) - network.begin(v);
+						}
+					}
+				}
+			}
+			else {
+				std::fill(frontierBits.begin(), frontierBits.end(), 0);
+				for (NodeId u : frontier)
+					set(frontierBits, u);
+
+				// Procura um arco da fronteira para 'v'; o arco reverso de um arco de 'v' para 'u' é um arco de 'u' para 'v'.
+				auto findParent = [&](NodeId v) {
+					for (ArcId arc = network.begin(v); arc < network.end(v); arc++) {
+						Profiler::count(Profiler::Counter::EdgesScanned);
+						ArcId incoming = network.getReverse(arc);
+						if (isSet(frontierBits, network.getHead(arc)) && usable(incoming)) {
+							parentArc[v] = incoming;
+							set(visited, v);
+							return true;
+						}
+					}
+					return false;
+				};
+
+				// O sumidouro é testado antes dos demais nós: se ele está no próximo nível, a busca
+				// termina sem varrer o restante da rede.
+				if (findParent(sink))
+					return true;
 
-	std::unordered_map<GraphNode*, GraphEdge*, GraphNodeHash, GraphNodeEqual> parentEdge;
+				// Percorre apenas os nós não visitados, palavra a palavra do mapa de bits.
+				for (std::size_t word = 0; word < words; word++) {
+					std::uint64_t pending = ~visited[word];
+					while (pending) {
+						NodeId v = static_cast<NodeId>(word * 64 + static_cast<std::size_t>(std::countr_zero(pending)));
+						pending &= pending - 1;
+						if (v >= nodeCount)
+							break;
+						if (v != sink && findParent(v)) {
+							next.push_back(v);
+							nextArcs += network.end(v) - network.begin(v);
+						}
+					}
+				}
+			}
 
-	while (bfsEdmondKarp(graph, source, sink, &parentEdge))
+			unexploredArcs -= nextArcs;
+			frontierArcs = nextArcs;
+			frontier.swap(next);
+		}
+
+		return false;
+	}
+
+	/**
+	 * \brief BFS bidirecional: uma busca a partir da origem e outra a partir do sumidouro.
+	 *
+	 * \details A cada passo o lado cuja fronteira tem menos arcos expande um nível inteiro; o lado
+	 *          do sumidouro anda pelos arcos de entrada (o reverso de cada arco do nó). A busca para
+	 *          no primeiro nó visitado pelos dois lados. Como os níveis são expandidos inteiros,
+	 *          esse nó está em um caminho aumentante mínimo: se a origem já expandiu as distâncias
+	 *          até 'a' e o sumidouro até 'b' sem encontro, nenhum caminho tem menos de 'a + b'
+	 *          arcos, e o primeiro nó comum fecha um caminho de exatamente 'a + b' arcos. Os
+	 *          parâmetros e o resultado são os de 'bfsEdmondKarp'; ao final 'workspace.parentArc'
+	 *          descreve o caminho inteiro, do sumidouro até a origem.
+	 *
+	 * \complexidade O(V + E) por busca.
+	 */
+	template <typename Capacity>
+	bool bfsBidirectional(const BasicResidualGraph<Capacity>& network,
+		NodeId source,
+		NodeId sink,
+		BfsWorkspace& workspace,
+		Capacity threshold)
 	{
-		int pathFlow = std::numeric_limits<int>::max();
+		std::vector<ArcId>& parentArc = workspace.parentArc;
+		std::vector<std::uint32_t>& forwardVisited = workspace.visited;
+		std::vector<std::uint32_t>& backwardVisited = workspace.backwardVisited;
+		std::vector<ArcId>& childArc = workspace.childArc;
+		std::vector<NodeId>& forward = workspace.queue;
+		std::vector<NodeId>& backward = workspace.backwardQueue;
+		std::vector<NodeId>& next = workspace.next;
 
-		GraphNode* curr = sink;
-		while (*curr != *source) {
-			GraphEdge* edge = parentEdge[curr];
-			pathFlow = std::min(pathFlow, edge->getFlow());
-			curr = edge->getSource();
+		if (backwardVisited.size() != network.getNodeCount()) {
+			backwardVisited.assign(network.getNodeCount(), 0);
+			childArc.resize(network.getNodeCount());
+		}
+		if (++workspace.stamp == 0) {
+			std::fill(forwardVisited.begin(), forwardVisited.end(), 0);
+			std::fill(backwardVisited.begin(), backwardVisited.end(), 0);
+			workspace.stamp = 1;
 		}
+		const std::uint32_t stamp = workspace.stamp;
+		auto usable = [&](ArcId arc) {
+			Capacity residual = network.getResidual(arc);
+			return CapacityTraits<Capacity>::positive(residual) && residual >= threshold;
+		};
+
+		forward.assign(1, source);
+		forwardVisited[source] = stamp;
+		backward.assign(1, sink);
+		backwardVisited[sink] = stamp;
+		std::size_t forwardArcs = network.end(source) - network.begin(source);
+		std::size_t backwardArcs = network.end(sink) - network.begin(sink);
+		Profiler::count(Profiler::Counter::BfsCalls);
 
-		curr = sink;
-		while (*curr != *source) {
-			GraphEdge* edge = parentEdge[curr];
-			edge->setFlow(edge->getFlow() - pathFlow);
-			edge->getReverse()->setFlow(edge->getReverse()->getFlow() + pathFlow);
-			curr = edge->getSource();
+		// Completa 'parentArc' do nó de encontro até o sumidouro, seguindo os arcos da busca reversa.
+		auto join = [&](NodeId meeting) {
+			for (NodeId v = meeting; v != sink;) {
+				ArcId arc = childArc[v];
+				v = network.getHead(arc);
+				parentArc[v] = arc;
+			}
+			return true;
+		};
+
+		while (!forward.empty() && !backward.empty()) {
+			next.clear();
+			std::size_t nextArcs = 0;
+			if (forwardArcs <= backwardArcs) {
+				for (NodeId u : forward) {
+					Profiler::count(Profiler::Counter::EdgesScanned, network.end(u) - network.begin(u));
+					for (ArcId arc = network.begin(u); arc < network.end(u); arc++) {
+						NodeId v = network.getHead(arc);
+						if (forwardVisited[v] != stamp && usable(arc)) {
+							forwardVisited[v] = stamp;
+							parentArc[v] = arc;
+							if (backwardVisited[v] == stamp)
+								return join(v);
+							next.push_back(v);
+							nextArcs += network.end(v) - network.begin(v);
+						}
+					}
+				}
+				forward.swap(next);
+				forwardArcs = nextArcs;
+			}
+			else {
+				for (NodeId w : backward) {
+					Profiler::count(Profiler::Counter::EdgesScanned, network.end(w) - network.begin(w));
+					for (ArcId arc = network.begin(w); arc < network.end(w); arc++) {
+						NodeId u = network.getHead(arc);
+						ArcId incoming = network.getReverse(arc);
+						if (backwardVisited[u] != stamp && usable(incoming)) {
+							backwardVisited[u] = stamp;
+							childArc[u] = incoming;
+							if (forwardVisited[u] == stamp)
+								return join(u);
+							next.push_back(u);
+							nextArcs += network.end(u) - network.begin(u);
+						}
+					}
+				}
+				backward.swap(next);
+				backwardArcs = nextArcs;
+			}
 		}
 
-		maxFlow += pathFlow;
+		return false;
 	}
 
+	/**
+	 * \brief Envia fluxo por caminhos aumentantes até que não haja caminho com arcos de capacidade
+	 *        residual de ao menos 'threshold'.
+	 *
+	 * \return O fluxo enviado.
+	 */
+	template <typename Capacity>
+	Capacity augmentPaths(BasicResidualGraph<Capacity>& network,
+		NodeId source,
+		NodeId sink,
+		BfsWorkspace& workspace,
+		Capacity threshold,
+		Algorithms::BfsStrategy strategy)
+	{
+		Capacity flow = 0;
+		std::vector<ArcId>& parentArc = workspace.parentArc;
+		auto search = strategy == Algorithms::BfsStrategy::DirectionOptimizing ? bfsDirectionOptimizing<Capacity>
+			: strategy == Algorithms::BfsStrategy::Bidirectional ? bfsBidirectional<Capacity> : bfsEdmondKarp<Capacity>;
+
+		while (search(network, source, sink, workspace, threshold))
+		{
+			Capacity pathFlow = std::numeric_limits<Capacity>::max();
+			std::size_t pathLength = 0;
+
+			NodeId curr = sink;
+			while (curr != source) {
+				ArcId arc = parentArc[curr];
+				pathFlow = std::min(pathFlow, network.getResidual(arc));
+				curr = network.getHead(network.getReverse(arc));
+				pathLength++;
+			}
+			Profiler::count(Profiler::Counter::AugmentingPaths);
+			Profiler::sample(Profiler::Distribution::PathLength, static_cast<double>(pathLength));
+			Profiler::sample(Profiler::Distribution::Bottleneck, static_cast<double>(pathFlow));
+
+			curr = sink;
+			while (curr != source) {
+				ArcId arc = parentArc[curr];
+				network.push(arc, pathFlow);
+				curr = network.getHead(network.getReverse(arc));
+			}
+
+			flow = CapacityTraits<Capacity>::add(flow, pathFlow);
+		}
+
+		return flow;
+	}
+}
+
+int Algorithms::EdmondKarp(Graph* graph, GraphNode* source, GraphNode* sink)
+{
+	ResidualGraph network(graph);
+	int maxFlow = EdmondKarp(network,
+		network.getNodeId(source->getIndex()),
+		network.getNodeId(sink->getIndex()));
+	network.writeBack();
+	return maxFlow;
+}
+
+template <typename Capacity>
+Capacity Algorithms::EdmondKarp(BasicResidualGraph<Capacity>& network, NodeId source, NodeId sink, BfsStrategy strategy)
+{
+	BfsWorkspace workspace(network.getNodeCount());
+	return augmentPaths<Capacity>(network, source, sink, workspace, 0, strategy);
+}
+
+int Algorithms::CapacityScaling(Graph* graph, GraphNode* source, GraphNode* sink)
+{
+	ResidualGraph network(graph);
+	int maxFlow = CapacityScaling(network,
+		network.getNodeId(source->getIndex()),
+		network.getNodeId(sink->getIndex()));
+	network.writeBack();
 	return maxFlow;
 }
+
+template <typename Capacity>
+Capacity Algorithms::CapacityScaling(BasicResidualGraph<Capacity>& network, NodeId source, NodeId sink, BfsStrategy strategy)
+{
+	// Os arcos infinitos (as arestas da super origem, 'CapacityTraits::infinity()') não definem o
+	// 'delta' inicial, que fica limitado pela maior capacidade finita e nunca é dobrado além
+	// da metade do maior valor do tipo.
+	Capacity largest = 0;
+	for (ArcId arc = 0; arc < network.getArcCount(); arc++)
+		if (network.getResidual(arc) < CapacityTraits<Capacity>::infinity())
+			largest = std::max(largest, network.getResidual(arc));
+	Capacity threshold = 1;
+	while (threshold <= largest / 2)
+		threshold *= 2;
+
+	Capacity maxFlow = 0;
+	BfsWorkspace workspace(network.getNodeCount());
+	for (;; threshold /= 2) {
+		maxFlow = CapacityTraits<Capacity>::add(maxFlow, augmentPaths(network, source, sink, workspace, threshold, strategy));
+		if (threshold <= 1)
+			break;
+	}
+	// Com capacidades fracionárias, uma última fase usa os arcos com menos de uma unidade.
+	if constexpr (std::is_floating_point_v<Capacity>)
+		maxFlow += augmentPaths<Capacity>(network, source, sink, workspace, 0, strategy);
+
+	return maxFlow;
+}
+
+template int Algorithms::EdmondKarp<int>(BasicResidualGraph<int>&, NodeId, NodeId, BfsStrategy);
+template std::int64_t Algorithms::EdmondKarp<std::int64_t>(BasicResidualGraph<std::int64_t>&, NodeId, NodeId, BfsStrategy);
+template double Algorithms::EdmondKarp<double>(BasicResidualGraph<double>&, NodeId, NodeId, BfsStrategy);
+
+template int Algorithms::CapacityScaling<int>(BasicResidualGraph<int>&, NodeId, NodeId, BfsStrategy);
+template std::int64_t Algorithms::CapacityScaling<std::int64_t>(BasicResidualGraph<std::int64_t>&, NodeId, NodeId, BfsStrategy);
+template double Algorithms::CapacityScaling<double>(BasicResidualGraph<double>&, NodeId, NodeId, BfsStrategy);
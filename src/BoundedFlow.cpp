@@ -0,0 +1,101 @@
+#include <climits>
+
+#include "BoundedFlow.h"
+
+BoundedFlowResult BoundedFlow::solve(const Network& network, const MaxFlowAlgorithm& algorithm)
+{
+	using NodeId = Graph::NodeId;
+	using ArcId = Graph::ArcId;
+	using Traits = CapacityTraits<std::int64_t>;
+
+	// Rede de fluxo na numeração de 'ResidualGraph(const Network&)', com o limite inferior de
+	// cada aresta. Os dois últimos nós são a nova origem S' e o novo sumidouro T'.
+	const NodeId source = static_cast<NodeId>(network.getSourceIndex());
+	const NodeId sink = static_cast<NodeId>(network.getSinkIndex());
+	const NodeId lowerSource = sink + 1;
+	const NodeId lowerSink = sink + 2;
+	std::vector<NodeId> tails;
+	std::vector<NodeId> heads;
+	std::vector<std::int64_t> capacities;
+	std::vector<int> lowerBounds;
+	auto addEdge = [&](std::size_t tail, std::size_t head, std::int64_t capacity, int lowerBound) {
+		tails.push_back(static_cast<NodeId>(tail));
+		heads.push_back(static_cast<NodeId>(head));
+		capacities.push_back(capacity);
+		lowerBounds.push_back(lowerBound);
+	};
+
+	for (std::size_t e = 0; e < network.getEdgeCount(); e++)
+		addEdge(network.getEdgeSource(e), network.getEdgeTarget(e), network.getEdgeCapacity(e), network.getEdgeLowerBound(e));
+	for (std::size_t generator : network.getGenerators()) {
+		int supply = network.getSupplyLimit(generator);
+		addEdge(source, generator, supply == INT_MAX ? Traits::infinity() : supply, 0);
+	}
+	for (std::size_t index = 1; index <= network.getNodeCount(); index++)
+		if (network.getDemand(index) > 0)
+			addEdge(index, sink, network.getDemand(index), network.getFirmDemand(index));
+	const std::size_t flowEdgeCount = tails.size();
+
+	// Redução: capacidade c - l, a aresta de volta e o saldo dos limites de cada nó.
+	std::vector<std::int64_t> balance(sink + 1, 0);
+	for (std::size_t e = 0; e < flowEdgeCount; e++) {
+		capacities[e] -= lowerBounds[e];
+		balance[heads[e]] += lowerBounds[e];
+		balance[tails[e]] -= lowerBounds[e];
+	}
+	const std::size_t backEdge = tails.size();
+	addEdge(sink, source, Traits::infinity(), 0);
+	std::int64_t required = 0;
+	for (NodeId v = 0; v <= sink; v++) {
+		if (balance[v] > 0) {
+			addEdge(lowerSource, v, balance[v], 0);
+			required += balance[v];
+		}
+		else if (balance[v] < 0) {
+			addEdge(v, lowerSink, -balance[v], 0);
+		}
+	}
+
+	Graph graph(static_cast<std::size_t>(lowerSink) + 1, tails, heads, capacities);
+	BoundedFlowResult result{ false, 0, {}, {}, 0, 0 };
+	if (algorithm(graph, lowerSource, lowerSink) < required) {
+		// Lado de S' de um corte mínimo: os nós alcançáveis na rede residual.
+		std::vector<std::uint8_t> reached(graph.getNodeCount(), 0);
+		std::vector<NodeId> queue{ lowerSource };
+		reached[lowerSource] = 1;
+		for (std::size_t head = 0; head < queue.size(); head++) {
+			NodeId u = queue[head];
+			for (ArcId arc = graph.begin(u); arc < graph.end(u); arc++) {
+				if (!reached[graph.getHead(arc)] && graph.getResidual(arc) > 0) {
+					reached[graph.getHead(arc)] = 1;
+					queue.push_back(graph.getHead(arc));
+				}
+			}
+		}
+
+		for (NodeId v = 0; v <= sink; v++)
+			if (reached[v])
+				result.infeasibleSet.push_back(v);
+		for (std::size_t e = 0; e < flowEdgeCount; e++) {
+			if (!reached[tails[e]] && reached[heads[e]])
+				result.requiredFlow += lowerBounds[e];
+			else if (reached[tails[e]] && !reached[heads[e]])
+				result.availableCapacity = Traits::add(result.availableCapacity, capacities[e] + lowerBounds[e]);
+		}
+		return result;
+	}
+
+	// Os limites estão atendidos. O fluxo da aresta de volta é o que já vai da super origem ao
+	// super sumidouro; sem ela, o algoritmo continua a partir desse fluxo.
+	ArcId back = graph.getEdgeArc(backEdge);
+	std::int64_t feasibleFlow = graph.getFlow(back);
+	graph.push(back, -feasibleFlow);
+	graph.setCapacity(back, 0);
+
+	result.feasible = true;
+	result.maxFlow = Traits::add(feasibleFlow, algorithm(graph, source, sink));
+	result.flows.resize(flowEdgeCount);
+	for (std::size_t e = 0; e < flowEdgeCount; e++)
+		result.flows[e] = static_cast<int>(graph.getEdgeFlow(e) + lowerBounds[e]);
+	return result;
+}
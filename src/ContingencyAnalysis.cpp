@@ -0,0 +1,40 @@
+#include <optional>
+
+#include "ContingencyAnalysis.h"
+#include "IncrementalMaxFlow.h"
+
+ContingencyReport ContingencyAnalysis::run(const Network& network, ThreadPool& pool)
+{
+	IncrementalMaxFlow base(network);
+
+	ContingencyReport report;
+	report.baseMaxFlow = base.getMaxFlow();
+	report.baseUnmetDemand = base.getUnmetDemand();
+	report.edges.resize(network.getEdgeCount());
+
+	// Apenas as conexões com fluxo na solução base geram cenários a resolver.
+	std::vector<std::size_t> scenarios;
+	for (std::size_t edge = 0; edge < network.getEdgeCount(); edge++) {
+		int flow = base.getEdgeFlow(edge);
+		report.edges[edge] = { edge, flow, 0, report.baseUnmetDemand, flow == 0 };
+		if (flow > 0)
+			scenarios.push_back(edge);
+	}
+
+	std::vector<std::optional<IncrementalMaxFlow>> states(pool.getThreadCount());
+	pool.parallelFor(scenarios.size(), [&](std::size_t index, std::size_t thread) {
+		// A atribuição reaproveita os vetores da cópia anterior da mesma thread.
+		if (states[thread])
+			*states[thread] = base;
+		else
+			states[thread].emplace(base);
+		IncrementalMaxFlow& state = *states[thread];
+
+		ContingencyResult& result = report.edges[scenarios[index]];
+		NetworkEdit outage = NetworkEdit::removeEdge(result.edge);
+		result.lostFlow = report.baseMaxFlow - state.apply({ &outage, 1 });
+		result.unmetDemand = state.getUnmetDemand();
+	});
+
+	return report;
+}
@@ -0,0 +1,321 @@
+#include <cerrno>
+#include <charconv>
+#include <climits>
+#include <cstring>
+#include <sstream>
+#include <stdexcept>
+#include <utility>
+
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+#include "DiagnosisServer.h"
+#include "NetworkParser.h"
+
+namespace {
+	/**
+	 * \brief Maior consulta aceita, em bytes; uma linha maior encerra a conexão.
+	 */
+	constexpr std::size_t MAX_REQUEST = 1 << 20;
+
+	/**
+	 * \brief Lê um inteiro entre 'min' e 'max' que ocupa toda a palavra.
+	 */
+	long long parseInteger(const std::string& word, long long min, long long max) {
+		long long value = 0;
+		auto [last, error] = std::from_chars(word.data(), word.data() + word.size(), value);
+		if (word.empty() || error != std::errc() || last != word.data() + word.size() || value < min || value > max)
+			throw std::runtime_error("número inválido: '" + word + "'");
+		return value;
+	}
+
+	/**
+	 * \brief Lança um erro se a consulta tiver argumentos além do comando.
+	 */
+	void requireNoArguments(const std::string& command, const std::string& arguments) {
+		if (!arguments.empty())
+			throw std::runtime_error("'" + command + "' não tem argumentos");
+	}
+
+	/**
+	 * \brief Escreve todo o texto no socket; retorna falso se o cliente fechou a conexão.
+	 */
+	bool sendAll(int fd, const std::string& text) {
+		std::size_t sent = 0;
+		while (sent < text.size()) {
+			ssize_t count = ::send(fd, text.data() + sent, text.size() - sent, MSG_NOSIGNAL);
+			if (count < 0 && errno == EINTR)
+				continue;
+			if (count <= 0)
+				return false;
+			sent += static_cast<std::size_t>(count);
+		}
+		return true;
+	}
+}
+
+DiagnosisService::DiagnosisService(const Network& network) :
+	m_current(std::make_shared<const NetworkVersion>(NetworkVersion{ 1, IncrementalMaxFlow(network) }))
+{
+}
+
+void DiagnosisService::handle(const std::string& request, std::ostream& out)
+{
+	std::istringstream in(request);
+	std::string command;
+	std::string arguments;
+	in >> command;
+	std::getline(in >> std::ws, arguments);
+	while (!arguments.empty() && (arguments.back() == ' ' || arguments.back() == '\t'))
+		arguments.pop_back();
+
+	try {
+		if (command == "estado") {
+			requireNoArguments(command, arguments);
+			std::shared_ptr<const NetworkVersion> version = current();
+			out << version->number << " " << version->flow.getMaxFlow() << " " << version->flow.getUnmetDemand() << '\n';
+		}
+		else if (command == "fluxo") {
+			requireNoArguments(command, arguments);
+			out << current()->flow.getMaxFlow() << '\n';
+		}
+		else if (command == "deficit") {
+			requireNoArguments(command, arguments);
+			out << current()->flow.getUnmetDemand() << '\n';
+		}
+		else if (command == "criticas") {
+			requireNoArguments(command, arguments);
+			std::shared_ptr<const NetworkVersion> version = current();
+			std::vector<std::size_t> edges = version->flow.getCriticalEdges();
+			out << edges.size() << '\n';
+			for (std::size_t edge : edges)
+				out << edge << " " << version->flow.getEdgeSource(edge) << " " << version->flow.getEdgeTarget(edge) << " "
+					<< version->flow.getEdgeCapacity(edge) << '\n';
+		}
+		else if (command == "simular") {
+			std::vector<NetworkEdit> edits = parseEdits(arguments);
+			IncrementalMaxFlow flow = current()->flow;
+			flow.apply(edits);
+			out << flow.getMaxFlow() << " " << flow.getUnmetDemand() << '\n';
+		}
+		else if (command == "alterar") {
+			std::shared_ptr<const NetworkVersion> version = commit(parseEdits(arguments));
+			out << version->number << " " << version->flow.getMaxFlow() << " " << version->flow.getUnmetDemand() << '\n';
+		}
+		else if (command == "recarregar") {
+			if (arguments.empty())
+				throw std::runtime_error("'recarregar' precisa de um arquivo");
+			std::shared_ptr<const NetworkVersion> version = reload(NetworkParser::parseFile(arguments));
+			out << version->number << " " << version->flow.getMaxFlow() << " " << version->flow.getUnmetDemand() << '\n';
+		}
+		else {
+			throw std::runtime_error("consulta desconhecida: '" + command + "'");
+		}
+	}
+	catch (const std::exception& error) {
+		out << "erro " << error.what() << '\n';
+	}
+}
+
+std::shared_ptr<const NetworkVersion> DiagnosisService::commit(std::span<const NetworkEdit> edits)
+{
+	std::lock_guard<std::mutex> lock(m_writer);
+	// Uma alteração com erro deixa a cópia pela metade; ela é descartada sem ser publicada.
+	IncrementalMaxFlow flow = m_current.load()->flow;
+	flow.apply(edits);
+	return publish(std::move(flow));
+}
+
+std::shared_ptr<const NetworkVersion> DiagnosisService::reload(const Network& network)
+{
+	IncrementalMaxFlow flow(network);
+	std::lock_guard<std::mutex> lock(m_writer);
+	return publish(std::move(flow));
+}
+
+std::shared_ptr<const NetworkVersion> DiagnosisService::publish(IncrementalMaxFlow flow)
+{
+	auto version = std::make_shared<const NetworkVersion>(NetworkVersion{ m_current.load()->number + 1, std::move(flow) });
+	m_current.store(version);
+	return version;
+}
+
+std::vector<NetworkEdit> DiagnosisService::parseEdits(const std::string& text)
+{
+	std::istringstream in(text);
+	std::vector<NetworkEdit> edits;
+	std::string word;
+	auto next = [&](long long min, long long max) {
+		std::string number;
+		if (!(in >> number))
+			throw std::runtime_error("alteração incompleta: '" + word + "'");
+		return parseInteger(number, min, max);
+	};
+	const long long maxIndex = UINT32_MAX;
+
+	while (in >> word) {
+		if (word == "capacidade") {
+			std::size_t edge = static_cast<std::size_t>(next(0, maxIndex));
+			edits.push_back(NetworkEdit::setCapacity(edge, static_cast<int>(next(INT_MIN, INT_MAX))));
+		}
+		else if (word == "demanda") {
+			std::size_t index = static_cast<std::size_t>(next(0, maxIndex));
+			edits.push_back(NetworkEdit::setDemand(index, static_cast<int>(next(INT_MIN, INT_MAX))));
+		}
+		else if (word == "conexao") {
+			std::size_t source = static_cast<std::size_t>(next(0, maxIndex));
+			std::size_t target = static_cast<std::size_t>(next(0, maxIndex));
+			edits.push_back(NetworkEdit::addEdge(source, target, static_cast<int>(next(INT_MIN, INT_MAX))));
+		}
+		else if (word == "remover") {
+			edits.push_back(NetworkEdit::removeEdge(static_cast<std::size_t>(next(0, maxIndex))));
+		}
+		else {
+			throw std::runtime_error("alteração desconhecida: '" + word + "'");
+		}
+	}
+	if (edits.empty())
+		throw std::runtime_error("nenhuma alteração");
+	return edits;
+}
+
+DiagnosisServer::DiagnosisServer(DiagnosisService& service, const std::string& path) :
+	m_service(service), m_path(path), m_listener(-1), m_stopping(false)
+{
+	sockaddr_un address{};
+	address.sun_family = AF_UNIX;
+	if (path.empty() || path.size() >= sizeof(address.sun_path))
+		throw std::runtime_error("caminho de socket inválido: '" + path + "'");
+	std::memcpy(address.sun_path, path.c_str(), path.size() + 1);
+
+	// Um socket deixado por um servidor anterior é substituído; outro tipo de arquivo, não.
+	struct stat status;
+	if (::stat(path.c_str(), &status) == 0) {
+		if (!S_ISSOCK(status.st_mode))
+			throw std::runtime_error(path + " já existe e não é um socket");
+		::unlink(path.c_str());
+	}
+
+	m_listener = ::socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+	if (m_listener < 0)
+		throw std::runtime_error(std::string("socket: ") + std::strerror(errno));
+	if (::bind(m_listener, reinterpret_cast<const sockaddr*>(&address), sizeof(address)) < 0
+		|| ::listen(m_listener, SOMAXCONN) < 0) {
+		std::string message = std::strerror(errno);
+		::close(m_listener);
+		throw std::runtime_error(path + ": " + message);
+	}
+}
+
+DiagnosisServer::~DiagnosisServer()
+{
+	stop();
+	std::lock_guard<std::mutex> lock(m_connectionsMutex);
+	for (Connection& connection : m_connections) {
+		::shutdown(connection.fd, SHUT_RDWR);
+		connection.thread.join();
+		::close(connection.fd);
+	}
+	::close(m_listener);
+	::unlink(m_path.c_str());
+}
+
+void DiagnosisServer::run()
+{
+	while (!m_stopping) {
+		int fd = ::accept4(m_listener, nullptr, nullptr, SOCK_CLOEXEC);
+		if (fd < 0) {
+			if (m_stopping)
+				break;
+			if (errno == EINTR || errno == ECONNABORTED)
+				continue;
+			throw std::runtime_error(std::string("accept: ") + std::strerror(errno));
+		}
+
+		reap();
+		std::lock_guard<std::mutex> lock(m_connectionsMutex);
+		Connection& connection = m_connections.emplace_back();
+		connection.fd = fd;
+		connection.thread = std::thread([this, &connection] { serve(connection); });
+	}
+
+	// As leituras bloqueadas das conexões abertas retornam com o 'shutdown'.
+	std::lock_guard<std::mutex> lock(m_connectionsMutex);
+	for (Connection& connection : m_connections) {
+		::shutdown(connection.fd, SHUT_RDWR);
+		connection.thread.join();
+		::close(connection.fd);
+	}
+	m_connections.clear();
+}
+
+void DiagnosisServer::stop()
+{
+	// No Linux, 'shutdown' no socket que escuta faz o 'accept' bloqueado retornar.
+	m_stopping = true;
+	::shutdown(m_listener, SHUT_RDWR);
+}
+
+void DiagnosisServer::serve(Connection& connection)
+{
+	std::string buffer;
+	char chunk[4096];
+	while (true) {
+		ssize_t count = ::read(connection.fd, chunk, sizeof(chunk));
+		if (count < 0 && errno == EINTR)
+			continue;
+		if (count <= 0)
+			break;
+		buffer.append(chunk, static_cast<std::size_t>(count));
+
+		std::size_t begin = 0;
+		std::size_t end;
+		bool open = true;
+		while (open && (end = buffer.find('\n', begin)) != std::string::npos) {
+			std::string request = buffer.substr(begin, end - begin);
+			begin = end + 1;
+			if (!request.empty() && request.back() == '\r')
+				request.pop_back();
+			if (request.empty())
+				continue;
+
+			if (request == "desligar") {
+				sendAll(connection.fd, "ok\n");
+				stop();
+				open = false;
+				break;
+			}
+			std::ostringstream out;
+			m_service.handle(request, out);
+			open = sendAll(connection.fd, out.str());
+		}
+		buffer.erase(0, begin);
+		if (open && buffer.size() > MAX_REQUEST) {
+			sendAll(connection.fd, "erro consulta maior que " + std::to_string(MAX_REQUEST) + " bytes\n");
+			open = false;
+		}
+		if (!open)
+			break;
+	}
+	// O descritor só é fechado em 'reap', depois do próximo 'accept'; o 'shutdown' entrega o fim do
+	// arquivo ao cliente agora.
+	::shutdown(connection.fd, SHUT_RDWR);
+	connection.done = true;
+}
+
+void DiagnosisServer::reap()
+{
+	std::lock_guard<std::mutex> lock(m_connectionsMutex);
+	for (auto it = m_connections.begin(); it != m_connections.end(); ) {
+		if (it->done) {
+			it->thread.join();
+			::close(it->fd);
+			it = m_connections.erase(it);
+		}
+		else {
+			it++;
+		}
+	}
+}
@@ -0,0 +1,165 @@
+#include <algorithm>
+#include <limits>
+#include <vector>
+
+#include "Algorithms.h"
+#include "Profiler.h"
+
+using NodeId = ResidualGraph::NodeId;
+using ArcId = ResidualGraph::ArcId;
+
+namespace {
+	/**
+	 * \brief Nível usado para nós fora do grafo de níveis.
+	 */
+	constexpr NodeId UNREACHED = std::numeric_limits<NodeId>::max();
+
+	/**
+	 * \brief Constrói o grafo de níveis: a distância em arcos residuais de cada nó até a origem.
+	 *
+	 * \param network A rede residual.
+	 * \param source O nó de origem.
+	 * \param sink O nó de destino.
+	 * \param level Vetor com o nível de cada nó, indexado pelo nó.
+	 * \param queue Vetor usado como fila da BFS; reaproveitado entre as fases.
+	 *
+	 * \return Retorna `true` se o sumidouro for alcançável a partir da origem.
+	 *
+	 * \complexidade O(V + E).
+	 */
+	template <typename Capacity>
+	bool bfsLevels(const BasicResidualGraph<Capacity>& network,
+		NodeId source,
+		NodeId sink,
+		std::vector<NodeId>& level,
+		std::vector<NodeId>& queue)
+	{
+		std::fill(level.begin(), level.end(), UNREACHED);
+		queue.clear();
+
+		queue.push_back(source);
+		level[source] = 0;
+		Profiler::count(Profiler::Counter::BfsCalls);
+
+		for (std::size_t head = 0; head < queue.size(); head++) {
+			NodeId u = queue[head];
+			if (level[u] >= level[sink])
+				break;
+			Profiler::count(Profiler::Counter::EdgesScanned, network.end(u) - network.begin(u));
+
+			for (ArcId arc = network.begin(u); arc < network.end(u); arc++) {
+				NodeId v = network.getHead(arc);
+				if (level[v] == UNREACHED && CapacityTraits<Capacity>::positive(network.getResidual(arc))) {
+					level[v] = level[u] + 1;
+					queue.push_back(v);
+				}
+			}
+		}
+
+		return level[sink] != UNREACHED;
+	}
+
+	/**
+	 * \brief Envia um fluxo bloqueante pelo grafo de níveis.
+	 *
+	 * \details A busca em profundidade é iterativa, mantendo o caminho atual em 'path'. Cada nó
+	 *          guarda em 'current' o próximo arco a examinar, de modo que um arco descartado
+	 *          (saturado ou sem saída) nunca é visto novamente na mesma fase.
+	 *
+	 * \return O fluxo enviado nesta fase.
+	 *
+	 * \complexidade O(VE) por fase.
+	 */
+	template <typename Capacity>
+	Capacity blockingFlow(BasicResidualGraph<Capacity>& network,
+		NodeId source,
+		NodeId sink,
+		std::vector<NodeId>& level,
+		std::vector<ArcId>& current,
+		std::vector<ArcId>& path)
+	{
+		Capacity flow = 0;
+		for (NodeId u = 0; u < network.getNodeCount(); u++)
+			current[u] = network.begin(u);
+		path.clear();
+
+		NodeId u = source;
+		while (true) {
+			if (u == sink) {
+				Capacity pathFlow = std::numeric_limits<Capacity>::max();
+				for (ArcId arc : path)
+					pathFlow = std::min(pathFlow, network.getResidual(arc));
+
+				std::size_t firstSaturated = path.size();
+				for (std::size_t i = 0; i < path.size(); i++) {
+					network.push(path[i], pathFlow);
+					if (firstSaturated == path.size() && !CapacityTraits<Capacity>::positive(network.getResidual(path[i])))
+						firstSaturated = i;
+				}
+				flow = CapacityTraits<Capacity>::add(flow, pathFlow);
+				Profiler::count(Profiler::Counter::AugmentingPaths);
+				Profiler::sample(Profiler::Distribution::PathLength, static_cast<double>(path.size()));
+				Profiler::sample(Profiler::Distribution::Bottleneck, static_cast<double>(pathFlow));
+
+				u = network.getHead(network.getReverse(path[firstSaturated]));
+				path.resize(firstSaturated);
+				continue;
+			}
+
+			ArcId end = network.end(u);
+			ArcId& arc = current[u];
+			while (arc < end && (!CapacityTraits<Capacity>::positive(network.getResidual(arc)) || level[network.getHead(arc)] != level[u] + 1))
+				arc++;
+
+			if (arc < end) {
+				path.push_back(arc);
+				u = network.getHead(arc);
+			}
+			else {
+				// Nó sem saída: sai do grafo de níveis e a busca recua um arco.
+				level[u] = UNREACHED;
+				if (path.empty())
+					break;
+				u = network.getHead(network.getReverse(path.back()));
+				path.pop_back();
+				current[u]++;
+			}
+		}
+
+		return flow;
+	}
+}
+
+int Algorithms::Dinic(Graph* graph, GraphNode* source, GraphNode* sink)
+{
+	ResidualGraph network(graph);
+	int maxFlow = Dinic(network,
+		network.getNodeId(source->getIndex()),
+		network.getNodeId(sink->getIndex()));
+	network.writeBack();
+	return maxFlow;
+}
+
+template <typename Capacity>
+Capacity Algorithms::Dinic(BasicResidualGraph<Capacity>& network, NodeId source, NodeId sink)
+{
+	if (source == sink)
+		return 0;
+
+	Capacity maxFlow = 0;
+
+	std::vector<NodeId> level(network.getNodeCount());
+	std::vector<ArcId> current(network.getNodeCount());
+	std::vector<NodeId> queue;
+	std::vector<ArcId> path;
+	queue.reserve(network.getNodeCount());
+
+	while (bfsLevels(network, source, sink, level, queue))
+		maxFlow = CapacityTraits<Capacity>::add(maxFlow, blockingFlow(network, source, sink, level, current, path));
+
+	return maxFlow;
+}
+
+template int Algorithms::Dinic<int>(BasicResidualGraph<int>&, NodeId, NodeId);
+template std::int64_t Algorithms::Dinic<std::int64_t>(BasicResidualGraph<std::int64_t>&, NodeId, NodeId);
+template double Algorithms::Dinic<double>(BasicResidualGraph<double>&, NodeId, NodeId);
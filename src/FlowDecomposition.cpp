@@ -0,0 +1,99 @@
+#include <algorithm>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "Algorithms.h"
+
+using NodeId = ResidualGraph::NodeId;
+using ArcId = ResidualGraph::ArcId;
+
+template <typename Capacity>
+std::size_t Algorithms::DecomposeFlow(const BasicResidualGraph<Capacity>& network, NodeId source, NodeId sink,
+	const FlowPathVisitor<Capacity>& visit)
+{
+	constexpr std::size_t NOT_ON_PATH = static_cast<std::size_t>(-1);
+
+	// Fluxo ainda não decomposto de cada arco; os arcos reversos ficam com zero.
+	std::vector<Capacity> remaining(network.getArcCount(), 0);
+	for (std::size_t e = 0; e < network.getEdgeCount(); e++) {
+		ArcId arc = network.getEdgeArc(e);
+		remaining[arc] = network.getFlow(arc);
+	}
+	std::vector<ArcId> next(network.getNodeCount());
+	for (NodeId u = 0; u < network.getNodeCount(); u++)
+		next[u] = network.begin(u);
+
+	// A pilha da busca: 'arcs[i]' vai de 'nodes[i]' a 'nodes[i + 1]', e 'position' é a posição de
+	// cada nó em 'nodes'.
+	std::vector<NodeId> nodes;
+	std::vector<ArcId> arcs;
+	std::vector<std::size_t> position(network.getNodeCount(), NOT_ON_PATH);
+	std::size_t count = 0;
+
+	// Entrega 'arcs[first..]', desconta o seu fluxo e recua até o primeiro arco sem fluxo.
+	auto emit = [&](std::size_t first) {
+		std::span<const ArcId> found = std::span<const ArcId>(arcs).subspan(first);
+		Capacity amount = remaining[found.front()];
+		for (ArcId arc : found)
+			amount = std::min(amount, remaining[arc]);
+		for (ArcId arc : found)
+			remaining[arc] -= amount;
+		visit(found, amount);
+		count++;
+
+		std::size_t saturated = first;
+		while (remaining[arcs[saturated]] > 0)
+			saturated++;
+		for (std::size_t i = saturated + 1; i < nodes.size(); i++)
+			position[nodes[i]] = NOT_ON_PATH;
+		nodes.resize(saturated + 1);
+		arcs.resize(saturated);
+	};
+
+	// Segue o fluxo a partir de 'start' até que ele não tenha mais fluxo saindo.
+	auto walk = [&](NodeId start, bool toSink) {
+		nodes.assign(1, start);
+		arcs.clear();
+		position[start] = 0;
+		while (true) {
+			NodeId u = nodes.back();
+			if (toSink && u == sink) {
+				emit(0);
+				continue;
+			}
+			while (next[u] < network.end(u) && !(remaining[next[u]] > 0))
+				next[u]++;
+			if (next[u] == network.end(u)) {
+				if (arcs.empty())
+					break;
+				if (u == source || u == sink)
+					throw std::runtime_error("o fluxo volta do sumidouro para a origem");
+				throw std::runtime_error("o fluxo não é conservado no nó " + std::to_string(network.getNodeIndex(u)));
+			}
+
+			ArcId arc = next[u];
+			NodeId v = network.getHead(arc);
+			arcs.push_back(arc);
+			if (position[v] != NOT_ON_PATH) {
+				emit(position[v]);
+			}
+			else {
+				position[v] = nodes.size();
+				nodes.push_back(v);
+			}
+		}
+		position[start] = NOT_ON_PATH;
+	};
+
+	walk(source, true);
+	// Sem fluxo saindo da origem, o restante é uma circulação.
+	for (NodeId u = 0; u < network.getNodeCount(); u++)
+		walk(u, false);
+
+	return count;
+}
+
+template std::size_t Algorithms::DecomposeFlow<int>(const BasicResidualGraph<int>&, NodeId, NodeId, const FlowPathVisitor<int>&);
+template std::size_t Algorithms::DecomposeFlow<std::int64_t>(const BasicResidualGraph<std::int64_t>&, NodeId, NodeId,
+	const FlowPathVisitor<std::int64_t>&);
@@ -0,0 +1,142 @@
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+#include <vector>
+
+#include "Algorithms.h"
+#include "FlowReport.h"
+
+namespace {
+	/**
+	 * \brief Com capacidades reais, escreve os valores com todos os dígitos significativos
+	 *        ('max_digits10') enquanto existir; valores inteiros saem como nos tipos inteiros.
+	 */
+	template <typename Capacity>
+	class NumberFormat {
+	public:
+		explicit NumberFormat(std::ostream& out) : m_out(out), m_precision(out.precision()) {
+			if constexpr (std::is_floating_point_v<Capacity>)
+				m_out.precision(std::numeric_limits<Capacity>::max_digits10);
+		}
+		NumberFormat(const NumberFormat&) = delete;
+		NumberFormat& operator=(const NumberFormat&) = delete;
+		~NumberFormat() { m_out.precision(m_precision); }
+
+	private:
+		std::ostream& m_out;
+		std::streamsize m_precision;
+	};
+}
+
+template <typename Capacity>
+void FlowReport::write(std::ostream& out, const Network& input, const BasicResidualGraph<Capacity>& network, Capacity maxFlow)
+{
+	using Traits = CapacityTraits<Capacity>;
+	using Graph = BasicResidualGraph<Capacity>;
+
+	NumberFormat<Capacity> format(out);
+	out << maxFlow << '\n';
+
+	typename Traits::Sum totalDemand = 0;
+	for (std::size_t index = 1; index <= input.getNodeCount(); index++)
+		totalDemand += input.getDemand(index);
+	typename Traits::Sum unattendedEnergy = totalDemand - maxFlow;
+	out << unattendedEnergy << '\n';
+
+	typename Traits::Sum totalOutgoingFlow = 0;
+	for (std::size_t gerador : input.getGenerators()) {
+		typename Graph::NodeId u = network.getNodeId(gerador);
+		for (typename Graph::ArcId arc = network.begin(u); arc < network.end(u); arc++)
+			if (network.getEdgeId(arc) != Graph::NO_EDGE)
+				totalOutgoingFlow += network.getResidual(arc);
+	}
+	out << totalOutgoingFlow << '\n';
+
+	std::vector<typename Graph::ArcId> criticalArcs;
+	std::vector<typename Graph::NodeId> criticalTails;
+	// Percorre os nós pelo índice da entrada, e não pelo identificador denso, para que a lista
+	// não dependa da numeração escolhida para a rede residual.
+	for (std::size_t index = 0; index < network.getNodeCount(); index++) {
+		typename Graph::NodeId u = network.getNodeId(index);
+		for (typename Graph::ArcId arc = network.begin(u); arc < network.end(u); arc++) {
+			if (network.getEdgeId(arc) < input.getEdgeCount() && !Traits::positive(network.getResidual(arc))) {
+				criticalTails.push_back(u);
+				criticalArcs.push_back(arc);
+			}
+		}
+	}
+
+	out << criticalArcs.size() << '\n';
+	for (std::size_t i = 0; i < criticalArcs.size(); i++) {
+		out << network.getNodeIndex(criticalTails[i]) << " "
+			<< network.getNodeIndex(network.getHead(criticalArcs[i])) << " "
+			<< network.getCapacity(criticalArcs[i]) << '\n';
+	}
+}
+
+template <typename Capacity>
+void FlowReport::writeMinCut(std::ostream& out, const Network& input, const BasicResidualGraph<Capacity>& network)
+{
+	using ArcId = typename BasicResidualGraph<Capacity>::ArcId;
+
+	NumberFormat<Capacity> format(out);
+	std::vector<ArcId> cut = Algorithms::MinCut(network, network.getNodeId(input.getSourceIndex()));
+
+	typename CapacityTraits<Capacity>::Sum cutValue = 0;
+	std::vector<ArcId> lines;
+	for (ArcId arc : cut) {
+		cutValue += network.getCapacity(arc);
+		if (network.getEdgeId(arc) < input.getEdgeCount())
+			lines.push_back(arc);
+	}
+	std::sort(lines.begin(), lines.end(), [&](ArcId a, ArcId b) {
+		std::size_t tailA = network.getNodeIndex(network.getHead(network.getReverse(a)));
+		std::size_t tailB = network.getNodeIndex(network.getHead(network.getReverse(b)));
+		return tailA != tailB ? tailA < tailB : network.getEdgeId(a) < network.getEdgeId(b);
+	});
+
+	out << cutValue << '\n' << lines.size() << '\n';
+	for (ArcId arc : lines) {
+		std::size_t edge = network.getEdgeId(arc);
+		out << input.getEdgeSource(edge) << " " << input.getEdgeTarget(edge) << " " << network.getCapacity(arc) << '\n';
+	}
+}
+
+template <typename Capacity>
+void FlowReport::writePaths(std::ostream& out, const Network& input, const BasicResidualGraph<Capacity>& network)
+{
+	using ArcId = typename BasicResidualGraph<Capacity>::ArcId;
+
+	NumberFormat<Capacity> format(out);
+	auto source = network.getNodeId(input.getSourceIndex());
+	auto sink = network.getNodeId(input.getSinkIndex());
+	Algorithms::DecomposeFlow<Capacity>(network, source, sink, [&](std::span<const ArcId> arcs, Capacity amount) {
+		out << amount;
+		// Um ciclo é escrito a partir da origem do seu primeiro arco; um caminho, sem a super
+		// origem e o super sumidouro.
+		auto first = network.getHead(network.getReverse(arcs.front()));
+		if (first != source)
+			out << " " << network.getNodeIndex(first);
+		for (ArcId arc : arcs)
+			if (network.getHead(arc) != sink || first != source)
+				out << " " << network.getNodeIndex(network.getHead(arc));
+		out << '\n';
+	});
+}
+
+void FlowReport::writeInfeasibility(std::ostream& out, const BoundedFlowResult& result)
+{
+	out << result.requiredFlow << " " << result.availableCapacity << '\n' << result.infeasibleSet.size() << '\n';
+	for (std::size_t index : result.infeasibleSet)
+		out << index << '\n';
+}
+
+template void FlowReport::write<int>(std::ostream&, const Network&, const BasicResidualGraph<int>&, int);
+template void FlowReport::write<std::int64_t>(std::ostream&, const Network&, const BasicResidualGraph<std::int64_t>&, std::int64_t);
+template void FlowReport::write<double>(std::ostream&, const Network&, const BasicResidualGraph<double>&, double);
+template void FlowReport::writeMinCut<int>(std::ostream&, const Network&, const BasicResidualGraph<int>&);
+template void FlowReport::writeMinCut<std::int64_t>(std::ostream&, const Network&, const BasicResidualGraph<std::int64_t>&);
+template void FlowReport::writeMinCut<double>(std::ostream&, const Network&, const BasicResidualGraph<double>&);
+template void FlowReport::writePaths<int>(std::ostream&, const Network&, const BasicResidualGraph<int>&);
+template void FlowReport::writePaths<std::int64_t>(std::ostream&, const Network&, const BasicResidualGraph<std::int64_t>&);
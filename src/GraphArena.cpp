@@ -0,0 +1,113 @@
+#include <cstddef>
+#include <stdexcept>
+
+#include "GraphArena.h"
+
+namespace {
+	/**
+	 * \brief Primeira passada: conta as arestas (diretas e reversas) de cada nó.
+	 */
+	std::vector<std::size_t> countDegrees(std::size_t nodeCount, std::span<const std::uint32_t> tails,
+		std::span<const std::uint32_t> heads, std::span<const int> capacities)
+	{
+		if (tails.size() != heads.size() || tails.size() != capacities.size())
+			throw std::runtime_error("listas de conexões com tamanhos diferentes");
+
+		std::vector<std::size_t> degrees(nodeCount, 0);
+		for (std::size_t e = 0; e < tails.size(); e++) {
+			if (tails[e] >= nodeCount || heads[e] >= nodeCount)
+				throw std::runtime_error("conexão " + std::to_string(e) + " com nó inexistente");
+			degrees[tails[e]]++;
+			degrees[heads[e]]++;
+		}
+		return degrees;
+	}
+
+	/**
+	 * \brief Primeira passada para a rede de fluxo de uma rede elétrica.
+	 */
+	std::vector<std::size_t> countDegrees(const Network& network)
+	{
+		std::vector<std::size_t> degrees = countDegrees(network.getSinkIndex() + 1,
+			network.getEdgeSources(), network.getEdgeTargets(), network.getEdgeCapacities());
+		degrees[network.getSourceIndex()] += network.getGenerators().size();
+		for (std::size_t generator : network.getGenerators())
+			degrees[generator]++;
+		for (std::size_t index = 1; index <= network.getNodeCount(); index++) {
+			if (network.getDemand(index) > 0) {
+				degrees[index]++;
+				degrees[network.getSinkIndex()]++;
+			}
+		}
+		return degrees;
+	}
+}
+
+GraphArena::GraphArena(std::span<const int> demands, std::span<const std::uint32_t> tails,
+	std::span<const std::uint32_t> heads, std::span<const int> capacities) :
+	GraphArena(demands, countDegrees(demands.size(), tails, heads, capacities))
+{
+	for (std::size_t e = 0; e < tails.size(); e++)
+		m_nodes[tails[e]].connect(&m_nodes[heads[e]], capacities[e]);
+	m_edgeCount = tails.size();
+}
+
+GraphArena::GraphArena(const Network& network) :
+	GraphArena(network.getDemands(), countDegrees(network))
+{
+	for (std::size_t e = 0; e < network.getEdgeCount(); e++)
+		m_nodes[network.getEdgeSource(e)].connect(&m_nodes[network.getEdgeTarget(e)], network.getEdgeCapacity(e));
+	m_edgeCount = network.getEdgeCount();
+
+	GraphNode* source = &m_nodes[network.getSourceIndex()];
+	GraphNode* sink = &m_nodes[network.getSinkIndex()];
+	for (std::size_t generator : network.getGenerators()) {
+		source->connect(&m_nodes[generator], network.getSupplyLimit(generator));
+		m_edgeCount++;
+	}
+	for (std::size_t index = 1; index <= network.getNodeCount(); index++) {
+		if (network.getDemand(index) > 0) {
+			m_nodes[index].connect(sink, network.getDemand(index));
+			m_edgeCount++;
+		}
+	}
+}
+
+GraphArena::GraphArena(std::span<const int> demands, const std::vector<std::size_t>& degrees) :
+	m_bufferSize(blockSize(degrees)),
+	m_buffer(std::make_unique_for_overwrite<std::byte[]>(m_bufferSize)),
+	m_resource(m_buffer.get(), m_bufferSize, std::pmr::null_memory_resource()),
+	m_nodes(&m_resource),
+	m_edgeCount(0)
+{
+	// Segunda passada: os nós e os vetores de arestas são criados com o tamanho final, de modo
+	// que 'connect' nunca realoca e os ponteiros entre nós permanecem válidos.
+	std::vector<GraphNode*> nodes;
+	nodes.reserve(degrees.size());
+	m_nodes.reserve(degrees.size());
+	for (std::size_t index = 0; index < degrees.size(); index++) {
+		m_nodes.emplace_back(index, demands[index], &m_resource);
+		m_nodes.back().reserveEdges(degrees[index]);
+		nodes.push_back(&m_nodes.back());
+	}
+	m_graph = Graph(nodes);
+}
+
+std::size_t GraphArena::blockSize(const std::vector<std::size_t>& degrees)
+{
+	std::size_t arcCount = 0;
+	for (std::size_t degree : degrees)
+		arcCount += degree;
+	// Todas as alocações têm tamanho múltiplo do alinhamento; a folga cobre apenas o início do bloco.
+	return degrees.size() * sizeof(GraphNode) + arcCount * sizeof(GraphEdge) + alignof(std::max_align_t);
+}
+
+std::size_t GraphArena::getMemoryUsage() const
+{
+	return sizeof(GraphArena) + m_bufferSize + m_nodes.size() * sizeof(GraphNode*);
+}
+
+double GraphArena::getBytesPerEdge() const
+{
+	return m_edgeCount == 0 ? 0.0 : static_cast<double>(getMemoryUsage()) / static_cast<double>(m_edgeCount);
+}
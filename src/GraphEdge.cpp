@@ -1,10 +1,20 @@
 #include "GraphEdge.h"
 #include "GraphNode.h"
 
+namespace {
+	/**
+	 * \brief Valor de 'm_reverse' para arestas criadas fora de 'GraphNode::connect'.
+	 */
+	constexpr std::size_t NO_REVERSE = static_cast<std::size_t>(-1);
+}
+
 GraphEdge::GraphEdge(GraphNode* source, GraphNode* target) : GraphEdge(source, target, 0) {}
 
-GraphEdge::GraphEdge(GraphNode* source, GraphNode* target, int weight) : 
-	m_source(source), m_target(target), m_flow(weight), m_capacity(weight), m_reverse(nullptr) {}
+GraphEdge::GraphEdge(GraphNode* source, GraphNode* target, int weight) :
+	GraphEdge(source, target, weight, NO_REVERSE, false) {}
+
+GraphEdge::GraphEdge(GraphNode* source, GraphNode* target, int weight, std::size_t reverseIndex, bool isReverse) :
+	m_source(source), m_target(target), m_flow(weight), m_capacity(weight), m_cost(0), m_reverse(reverseIndex), m_isReverse(isReverse) {}
 
 GraphNode* GraphEdge::getSource() const {
 	return m_source;
@@ -15,11 +25,11 @@ GraphNode* GraphEdge::getTarget() const {
 }
 
 GraphEdge* GraphEdge::getReverse() {
-	if (m_reverse == nullptr)
-		m_reverse = new GraphEdge(m_target, m_source, 0);
-	return m_reverse;
+	if (m_reverse == NO_REVERSE)
+		return nullptr;
+	return &m_target->getEdges()[m_reverse];
 }
 
 bool GraphEdge::operator==(const GraphEdge& other) const {
 	return *m_source == *other.getSource() && *m_target == *other.getTarget();
-}
\ No newline at end of file
+}
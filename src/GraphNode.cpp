@@ -6,17 +6,34 @@ GraphNode::GraphNode(std::size_t index) : GraphNode(index, 0) {}
 
 GraphNode::GraphNode(std::size_t index, int demand) : m_index(index), m_demand(demand) {}
 
+GraphNode::GraphNode(std::size_t index, int demand, std::pmr::memory_resource* resource) :
+	m_edges(resource), m_index(index), m_demand(demand) {}
+
 void GraphNode::connect(GraphNode* node) {
 	connect(node, 0);
 }
 
 void GraphNode::connect(GraphNode* node, int weight) {
-	m_edges.push_back(GraphEdge(this, node, weight));
+	std::size_t forward = m_edges.size();
+	std::size_t backward = node->m_edges.size() + (node == this ? 1 : 0);
+	m_edges.push_back(GraphEdge(this, node, weight, backward, false));
+	node->m_edges.push_back(GraphEdge(node, this, 0, forward, true));
+}
+
+void GraphNode::connect(GraphNode* node, int weight, int cost) {
+	std::size_t forward = m_edges.size();
+	connect(node, weight);
+	m_edges[forward].setCost(cost);
+	m_edges[forward].getReverse()->setCost(-cost);
+}
+
+void GraphNode::reserveEdges(std::size_t count) {
+	m_edges.reserve(count);
 }
 
 bool GraphNode::isConnected(GraphNode* node) {
 	for (GraphEdge& e : m_edges)
-		if (*e.getTarget() == *node)
+		if (!e.isReverse() && *e.getTarget() == *node)
 			return true;
 	return false;
 }
@@ -24,11 +41,11 @@ bool GraphNode::isConnected(GraphNode* node) {
 int GraphNode::getDemand() const {
 	return m_demand;
 }
-std::vector<GraphEdge>& GraphNode::getEdges() {
+std::pmr::vector<GraphEdge>& GraphNode::getEdges() {
 	return m_edges;
 }
 
-void GraphNode::setEdges(std::vector<GraphEdge> edges) { m_edges = edges; }
+void GraphNode::setEdges(std::vector<GraphEdge> edges) { m_edges.assign(edges.begin(), edges.end()); }
 
 bool GraphNode::operator==(const GraphNode& other) const {
 	return (m_index == other.getIndex());
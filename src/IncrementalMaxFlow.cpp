@@ -0,0 +1,227 @@
+#include <algorithm>
+#include <limits>
+#include <stdexcept>
+#include <string>
+
+#include "Algorithms.h"
+#include "IncrementalMaxFlow.h"
+
+using NodeId = ResidualGraph::NodeId;
+using ArcId = ResidualGraph::ArcId;
+
+IncrementalMaxFlow::IncrementalMaxFlow(const Network& network) :
+	m_demands(network.getDemands().begin(), network.getDemands().end()),
+	m_generators(network.getGenerators().begin(), network.getGenerators().end()),
+	m_edgeSources(network.getEdgeSources().begin(), network.getEdgeSources().end()),
+	m_edgeTargets(network.getEdgeTargets().begin(), network.getEdgeTargets().end()),
+	m_edgeCapacities(network.getEdgeCapacities().begin(), network.getEdgeCapacities().end()),
+	m_supplies(network.getSupplyLimits().begin(), network.getSupplyLimits().end()),
+	m_removed(network.getEdgeCount(), false),
+	m_sinkEdges(network.getSinkIndex() + 1, NO_SINK_EDGE),
+	m_graph(network),
+	m_builtEdges(network.getEdgeCount()),
+	m_totalDemand(0),
+	m_parentArc(m_graph.getNodeCount()),
+	m_visited(m_graph.getNodeCount(), 0),
+	m_stamp(0)
+{
+	std::size_t consumers = 0;
+	for (std::size_t index = 1; index <= network.getNodeCount(); index++) {
+		if (m_demands[index] > 0) {
+			m_sinkEdges[index] = consumers++;
+			m_totalDemand += m_demands[index];
+		}
+	}
+	m_queue.reserve(m_graph.getNodeCount());
+
+	m_maxFlow = Algorithms::Dinic(m_graph, 0, static_cast<NodeId>(network.getSinkIndex()));
+}
+
+Network IncrementalMaxFlow::view() const
+{
+	return Network(nullptr, m_demands, m_generators, m_edgeSources, m_edgeTargets, m_edgeCapacities, {}, m_supplies);
+}
+
+int IncrementalMaxFlow::apply(std::span<const NetworkEdit> edits)
+{
+	const std::size_t nodeCount = m_demands.size() - 2;
+	auto checkEdge = [&](std::size_t edge) {
+		if (edge >= m_edgeSources.size() || m_removed[edge])
+			throw std::runtime_error("conexão " + std::to_string(edge) + " inexistente");
+	};
+	auto checkNode = [&](std::size_t index) {
+		if (index < 1 || index > nodeCount)
+			throw std::runtime_error("nó " + std::to_string(index) + " fora do intervalo 1.." + std::to_string(nodeCount));
+	};
+	auto checkCapacity = [&](int capacity) {
+		if (capacity < 0)
+			throw std::runtime_error("capacidade " + std::to_string(capacity) + " negativa");
+	};
+
+	// O fluxo de partida é máximo. Se o lote só reduziu capacidades e todo o fluxo cancelado foi
+	// desviado, o valor do fluxo não mudou e nenhuma capacidade cresceu, então ele continua
+	// máximo e o algoritmo de Dinic não precisa percorrer a rede.
+	bool stale = false;
+
+	// Uma alteração inválida interrompe o lote, mas o fluxo das alterações anteriores é
+	// reparado antes de a exceção ser propagada.
+	auto finish = [&]() {
+		if (m_builtEdges < m_edgeSources.size())
+			rebuild();
+		if (stale)
+			m_maxFlow += Algorithms::Dinic(m_graph, 0, static_cast<NodeId>(nodeCount + 1));
+	};
+
+	try {
+		for (const NetworkEdit& edit : edits) {
+			switch (edit.type) {
+			case NetworkEdit::Type::Capacity:
+				checkEdge(edit.first);
+				checkCapacity(edit.value);
+				m_edgeCapacities[edit.first] = edit.value;
+				if (edit.first < m_builtEdges && changeCapacity(edit.first, edit.value))
+					stale = true;
+				break;
+
+			case NetworkEdit::Type::RemoveEdge:
+				checkEdge(edit.first);
+				m_edgeCapacities[edit.first] = 0;
+				m_removed[edit.first] = true;
+				if (edit.first < m_builtEdges && changeCapacity(edit.first, 0))
+					stale = true;
+				break;
+
+			case NetworkEdit::Type::AddEdge:
+				checkNode(edit.first);
+				checkNode(edit.second);
+				checkCapacity(edit.value);
+				m_edgeSources.push_back(static_cast<std::uint32_t>(edit.first));
+				m_edgeTargets.push_back(static_cast<std::uint32_t>(edit.second));
+				m_edgeCapacities.push_back(edit.value);
+				m_removed.push_back(false);
+				stale = true;
+				break;
+
+			case NetworkEdit::Type::Demand:
+				checkNode(edit.first);
+				if (m_sinkEdges[edit.first] == NO_SINK_EDGE)
+					throw std::runtime_error("nó " + std::to_string(edit.first) + " é um gerador");
+				if (edit.value <= 0)
+					throw std::runtime_error("demanda " + std::to_string(edit.value) + " do consumidor " + std::to_string(edit.first) + " não é positiva");
+				m_totalDemand += edit.value - m_demands[edit.first];
+				m_demands[edit.first] = edit.value;
+				if (changeCapacity(m_builtEdges + m_generators.size() + m_sinkEdges[edit.first], edit.value))
+					stale = true;
+				break;
+			}
+		}
+	}
+	catch (...) {
+		finish();
+		throw;
+	}
+
+	finish();
+	return m_maxFlow;
+}
+
+bool IncrementalMaxFlow::changeCapacity(std::size_t edge, int capacity)
+{
+	ArcId arc = m_graph.getEdgeArc(edge);
+	int excess = m_graph.getFlow(arc) - capacity;
+	if (excess <= 0) {
+		bool increased = capacity > m_graph.getCapacity(arc);
+		m_graph.setCapacity(arc, capacity);
+		return increased;
+	}
+
+	// O excedente é retirado do arco: 'u' passa a receber mais do que envia e 'v', menos.
+	NodeId u = m_graph.getHead(m_graph.getReverse(arc));
+	NodeId v = m_graph.getHead(arc);
+	m_graph.push(arc, -excess);
+	m_graph.setCapacity(arc, capacity);
+
+	// Primeiro tenta desviar o excedente por outro caminho de 'u' até 'v'; o que sobrar é
+	// devolvido à super origem e deixa de chegar ao super sumidouro. Enquanto 'u' tiver
+	// excesso e 'v' não for alcançável, a decomposição do fluxo garante um caminho residual
+	// de 'u' até a origem (e, do mesmo modo, do sumidouro até 'v').
+	const NodeId source = 0;
+	const NodeId sink = static_cast<NodeId>(m_graph.getNodeCount() - 1);
+	if (u != v)
+		excess -= augment(u, v, excess);
+	if (excess > 0) {
+		augment(u, source, excess);
+		augment(sink, v, excess);
+		m_maxFlow -= excess;
+	}
+	return excess > 0;
+}
+
+int IncrementalMaxFlow::augment(NodeId from, NodeId to, int limit)
+{
+	int sent = 0;
+	while (sent < limit && from != to) {
+		if (++m_stamp == 0) {
+			std::fill(m_visited.begin(), m_visited.end(), 0);
+			m_stamp = 1;
+		}
+		m_queue.clear();
+		m_queue.push_back(from);
+		m_visited[from] = m_stamp;
+
+		bool found = false;
+		for (std::size_t head = 0; head < m_queue.size() && !found; head++) {
+			NodeId u = m_queue[head];
+			for (ArcId arc = m_graph.begin(u); arc < m_graph.end(u); arc++) {
+				NodeId w = m_graph.getHead(arc);
+				if (m_visited[w] != m_stamp && m_graph.getResidual(arc) > 0) {
+					m_parentArc[w] = arc;
+					m_visited[w] = m_stamp;
+					m_queue.push_back(w);
+					if (w == to) {
+						found = true;
+						break;
+					}
+				}
+			}
+		}
+		if (!found)
+			break;
+
+		int pathFlow = limit - sent;
+		for (NodeId curr = to; curr != from; curr = m_graph.getHead(m_graph.getReverse(m_parentArc[curr])))
+			pathFlow = std::min(pathFlow, m_graph.getResidual(m_parentArc[curr]));
+		for (NodeId curr = to; curr != from; curr = m_graph.getHead(m_graph.getReverse(m_parentArc[curr])))
+			m_graph.push(m_parentArc[curr], pathFlow);
+		sent += pathFlow;
+	}
+	return sent;
+}
+
+void IncrementalMaxFlow::rebuild()
+{
+	// As arestas da rede residual são as conexões, seguidas das arestas da super origem e
+	// das do super sumidouro; as conexões novas entram sem fluxo antes das arestas auxiliares.
+	std::vector<int> flows(m_edgeSources.size() + m_graph.getEdgeCount() - m_builtEdges, 0);
+	for (std::size_t e = 0; e < m_builtEdges; e++)
+		flows[e] = m_graph.getEdgeFlow(e);
+	for (std::size_t e = m_builtEdges; e < m_graph.getEdgeCount(); e++)
+		flows[e - m_builtEdges + m_edgeSources.size()] = m_graph.getEdgeFlow(e);
+
+	m_graph = ResidualGraph(view());
+	m_graph.setEdgeFlows(flows);
+	m_builtEdges = m_edgeSources.size();
+}
+
+std::vector<std::size_t> IncrementalMaxFlow::getCriticalEdges() const
+{
+	std::vector<std::size_t> critical;
+	for (NodeId u = 0; u < m_graph.getNodeCount(); u++) {
+		for (ArcId arc = m_graph.begin(u); arc < m_graph.end(u); arc++) {
+			std::size_t edge = m_graph.getEdgeId(arc);
+			if (edge < m_builtEdges && !m_removed[edge] && m_graph.getResidual(arc) == 0)
+				critical.push_back(edge);
+		}
+	}
+	return critical;
+}
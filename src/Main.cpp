@@ -1,104 +1,465 @@
+#include <cstdint>
+#include <fstream>
+#include <functional>
 #include <iostream>
-#include <cassert>
-#include <climits>
 #include <limits>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <unordered_map>
 
-#include "Graph.h"
-#include "GraphNode.h"
 #include "Algorithms.h"
+#include "BoundedFlow.h"
+#include "ContingencyAnalysis.h"
+#include "DiagnosisServer.h"
+#include "FlowReport.h"
+#include "Network.h"
+#include "NetworkParser.h"
+#include "NetworkReducer.h"
+#include "NetworkSnapshot.h"
+#include "ParametricMaxFlow.h"
+#include "Profiler.h"
+#include "ResidualGraph.h"
+#include "ScenarioBatch.h"
+#include "ThreadPool.h"
 
-template <typename T>
-bool contains(const std::vector<T*>& v, T& valor) {
-	for (const auto* elem : v) {
-		if (*elem == valor) {
-			return true;
-		}
-	}
-	return false;
+/**
+ * \brief Assinatura comum dos algoritmos de fluxo máximo sobre a rede residual.
+ */
+template <typename Capacity>
+using MaxFlowAlgorithm = std::function<Capacity(BasicResidualGraph<Capacity>&, ResidualGraph::NodeId, ResidualGraph::NodeId)>;
+
+/**
+ * \brief Algoritmos de fluxo máximo que podem ser escolhidos com '--algorithm'.
+ * \param threadCount Número de threads dos algoritmos paralelos ('--threads'); zero usa todas.
+ * \param bfs A estratégia da BFS dos algoritmos de caminhos aumentantes ('--bfs').
+ */
+template <typename Capacity>
+std::unordered_map<std::string, MaxFlowAlgorithm<Capacity>> maxFlowAlgorithms(std::size_t threadCount,
+	Algorithms::BfsStrategy bfs = Algorithms::BfsStrategy::TopDown) {
+	using Graph = BasicResidualGraph<Capacity>;
+	return {
+		{ "edmonds-karp", [bfs](Graph& network, ResidualGraph::NodeId source, ResidualGraph::NodeId sink) {
+			return Algorithms::EdmondKarp(network, source, sink, bfs); } },
+		{ "push-relabel", [](Graph& network, ResidualGraph::NodeId source, ResidualGraph::NodeId sink) {
+			return Algorithms::PushRelabel(network, source, sink); } },
+		{ "dinic", [](Graph& network, ResidualGraph::NodeId source, ResidualGraph::NodeId sink) {
+			return Algorithms::Dinic(network, source, sink); } },
+		{ "capacity-scaling", [bfs](Graph& network, ResidualGraph::NodeId source, ResidualGraph::NodeId sink) {
+			return Algorithms::CapacityScaling(network, source, sink, bfs); } },
+		{ "parallel-push-relabel", [threadCount](Graph& network, ResidualGraph::NodeId source, ResidualGraph::NodeId sink) {
+			return Algorithms::ParallelPushRelabel(network, source, sink, threadCount); } },
+	};
 }
 
-int main() {
-	std::size_t v, e;
-	std::cin >> v >> e;
-	std::cin.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+/**
+ * \brief Escreve o perfil da execução ('--profile') quando o programa termina.
+ */
+struct ProfileWriter {
+	/**
+	 * \brief Arquivo do perfil; vazio escreve na saída de erro.
+	 */
+	std::optional<std::string> path;
 
-	std::vector<GraphNode*> geradores;
-	std::unordered_map<std::size_t, GraphNode*> indexNodes;
+	~ProfileWriter() {
+		if (!path)
+			return;
+		if (path->empty()) {
+			Profiler::writeJson(std::cerr);
+			return;
+		}
+		std::ofstream file(*path);
+		if (file)
+			Profiler::writeJson(file);
+		else
+			std::cerr << "Erro ao criar arquivo: " << *path << std::endl;
+	}
+};
 
-	for (std::size_t i = 0; i < v; i++) {
-		std::size_t index, t;
-		std::cin >> index >> t;
-		std::cin.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
-		assert(index > 0);
+/**
+ * \brief Resolve a rede com capacidades do tipo 'Capacity' e escreve o relatório.
+ * \param snapshot O snapshot lido da entrada, ou nulo. Snapshots guardam fluxos de 32 bits e
+ *                 só são usados com 'int'.
+ * \param snapshotPath Arquivo onde salvar a rede resolvida ('--save-snapshot'), ou vazio.
+ * \param reduce Resolve a rede reduzida por 'NetworkReducer' ('--reduce', só com 'int') e
+ *               devolve o fluxo às arestas originais antes do relatório.
+ * \param order A numeração dos nós da rede residual ('--order'); o relatório usa sempre os
+ *              índices da entrada.
+ * \param bfs A estratégia da BFS dos algoritmos de caminhos aumentantes ('--bfs').
+ * \param minCost Resolve o fluxo máximo de custo mínimo ('--min-cost', só com capacidades
+ *                inteiras) no lugar de 'algorithmName' e acrescenta o custo total ao relatório.
+ * \param paths Acrescenta ao relatório a decomposição do fluxo em caminhos dos geradores aos
+ *              consumidores ('--paths', só com capacidades inteiras).
+ * \return O código de saída do programa.
+ *
+ * Uma rede com limites inferiores (demandas firmes ou fluxos mínimos) é resolvida por
+ * 'BoundedFlow', só com 'int'; se for inviável, a prova de inviabilidade é escrita no lugar do
+ * relatório.
+ */
+template <typename Capacity>
+int solve(const Network& input, const NetworkSnapshot* snapshot, const std::string& inputPath, const std::string& snapshotPath,
+	const std::string& algorithmName, std::size_t threadCount, bool minCut, bool reduce, NodeOrder order,
+	Algorithms::BfsStrategy bfs, bool minCost, bool paths)
+{
+	if (input.hasLowerBounds() && (!std::is_same_v<Capacity, int> || reduce || minCost)) {
+		std::cerr << (inputPath.empty() ? "entrada" : inputPath)
+			<< ": limites mínimos não podem ser usados com --capacity=int64|double, --reduce ou --min-cost" << std::endl;
+		return 1;
+	}
+
+	std::optional<Profiler::ScopedPhase> phase(std::in_place, "build");
+	BasicResidualGraph<Capacity> network(input, order);
+	ResidualGraph::NodeId sourceId = network.getNodeId(input.getSourceIndex());
+	ResidualGraph::NodeId sinkId = network.getNodeId(input.getSinkIndex());
 
-		indexNodes[index] = new GraphNode(index, static_cast<int>(t));
-		if (t == 0)
-			geradores.push_back(indexNodes[index]);
+	// Um snapshot com fluxo já traz a solução; a rede não é resolvida novamente.
+	Capacity maxFlow = 0;
+	std::int64_t totalCost = 0;
+	phase.emplace("solve");
+	try {
+		if (minCost) {
+			if constexpr (!std::is_floating_point_v<Capacity>) {
+				MinCostFlow<Capacity> result = Algorithms::MinCostMaxFlow(network, input.getEdgeCosts(), sourceId, sinkId);
+				maxFlow = result.flow;
+				totalCost = result.cost;
+			}
+		}
+		else if constexpr (std::is_same_v<Capacity, int>) {
+			if (snapshot && snapshot->hasFlow()) {
+				network.setEdgeFlows(snapshot->getFlows());
+				maxFlow = snapshot->getMaxFlow();
+			}
+			else if (input.hasLowerBounds()) {
+				BoundedFlowResult bounded = BoundedFlow::solve(input, maxFlowAlgorithms<std::int64_t>(threadCount, bfs).at(algorithmName));
+				if (!bounded.feasible) {
+					phase.emplace("report");
+					FlowReport::writeInfeasibility(std::cout, bounded);
+					std::cout.flush();
+					std::cerr << (inputPath.empty() ? "entrada" : inputPath) << ": os limites mínimos não podem ser atendidos" << std::endl;
+					return 1;
+				}
+				network.setEdgeFlows(bounded.flows);
+				maxFlow = CapacityTraits<int>::fromSum(bounded.maxFlow);
+			}
+			else if (reduce) {
+				phase.emplace("reduce");
+				NetworkReducer reducer(input);
+				phase.emplace("solve");
+				std::int64_t reducedFlow = maxFlowAlgorithms<std::int64_t>(threadCount, bfs).at(algorithmName)(
+					reducer.getGraph(), reducer.getSource(), reducer.getSink());
+				network.setEdgeFlows(reducer.expandFlows());
+				maxFlow = CapacityTraits<int>::fromSum(reducedFlow);
+			}
+			else {
+				maxFlow = maxFlowAlgorithms<Capacity>(threadCount, bfs).at(algorithmName)(network, sourceId, sinkId);
+			}
+		}
+		else {
+			maxFlow = maxFlowAlgorithms<Capacity>(threadCount, bfs).at(algorithmName)(network, sourceId, sinkId);
+		}
 	}
-	assert(!geradores.empty());
+	catch (const std::exception& error) {
+		std::cerr << (inputPath.empty() ? "entrada" : inputPath) << ": " << error.what() << std::endl;
+		return 1;
+	}
+	// O corte mínimo é lido da rede residual final, sem resolver a rede novamente.
+	phase.emplace("report");
+	if (minCut)
+		FlowReport::writeMinCut(std::cout, input, network);
+	else
+		FlowReport::write(std::cout, input, network, maxFlow);
+	if (minCost && !minCut)
+		std::cout << totalCost << '\n';
+	if constexpr (!std::is_floating_point_v<Capacity>) {
+		if (paths) {
+			phase.emplace("paths");
+			try {
+				FlowReport::writePaths(std::cout, input, network);
+			}
+			catch (const std::runtime_error& error) {
+				std::cout.flush();
+				std::cerr << (inputPath.empty() ? "entrada" : inputPath) << ": " << error.what() << std::endl;
+				return 1;
+			}
+		}
+	}
+	std::cout.flush();
 
-	for (std::size_t i = 0; i < e; i++) {
-		std::size_t src, trg, capacity;
-		std::cin >> src >> trg >> capacity;
-		std::cin.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
-		indexNodes[src]->connect(indexNodes[trg], static_cast<int>(capacity));
+	if constexpr (std::is_same_v<Capacity, int>) {
+		if (!snapshotPath.empty()) {
+			try {
+				NetworkSnapshot::write(snapshotPath, input, &network, maxFlow);
+			}
+			catch (const std::runtime_error& error) {
+				std::cerr << error.what() << std::endl;
+				return 1;
+			}
+		}
 	}
 
-	GraphNode* source = new GraphNode(0);
-	for (auto* gerador : geradores)
-		source->connect(gerador, INT_MAX);
+	return 0;
+}
+
+/**
+ * \brief Mostra as opções do programa.
+ * \return O código de saída para argumentos inválidos.
+ */
+int usage(const char* program) {
+	std::cerr << "Uso: " << program << " [--algorithm=edmonds-karp|push-relabel|dinic|capacity-scaling|parallel-push-relabel] [--threads=N]"
+		<< " [--capacity=int32|int64|double] [--order=input|bfs|rcm] [--bfs=top-down|direction-optimizing|bidirectional] [--reduce] [--min-cost] [--paths] [--profile[=ARQ]]"
+		<< " [--save-snapshot=ARQ] [--convert-to-snapshot=ARQ | --convert-to-text | --contingency | --min-cut | --scenarios=ARQ|- | --sweep=L1,L2,...|INICIO:FIM:PASSO | --serve=SOCKET] [entrada]" << std::endl;
+	return 1;
+}
 
-	GraphNode* sink = new GraphNode(v + 1);
-	for (auto& pair : indexNodes)
-		if (!contains(geradores, *pair.second))
-			pair.second->connect(sink, pair.second->getDemand());
+int main(int argc, char* argv[]) {
+	std::string algorithmName = "edmonds-karp";
+	std::string inputPath;
+	std::string snapshotPath;
+	std::string convertPath;
+	std::string capacityType = "int32";
+	std::string scenariosPath;
+	std::vector<double> lambdas;
+	std::string servePath;
+	NodeOrder order = NodeOrder::Input;
+	Algorithms::BfsStrategy bfs = Algorithms::BfsStrategy::TopDown;
+	ProfileWriter profile;
+	bool convertToText = false;
+	bool contingency = false;
+	bool minCut = false;
+	bool reduce = false;
+	bool minCost = false;
+	bool paths = false;
+	std::size_t threadCount = 0;
+	for (int i = 1; i < argc; i++) {
+		std::string arg = argv[i];
+		const std::string algorithmFlag = "--algorithm=";
+		const std::string saveSnapshotFlag = "--save-snapshot=";
+		const std::string convertFlag = "--convert-to-snapshot=";
+		const std::string threadsFlag = "--threads=";
+		const std::string capacityFlag = "--capacity=";
+		const std::string scenariosFlag = "--scenarios=";
+		const std::string sweepFlag = "--sweep=";
+		const std::string serveFlag = "--serve=";
+		if (arg.rfind(algorithmFlag, 0) == 0) {
+			algorithmName = arg.substr(algorithmFlag.size());
+		}
+		else if (arg.rfind(saveSnapshotFlag, 0) == 0 && arg.size() > saveSnapshotFlag.size()) {
+			snapshotPath = arg.substr(saveSnapshotFlag.size());
+		}
+		else if (arg.rfind(convertFlag, 0) == 0 && arg.size() > convertFlag.size()) {
+			convertPath = arg.substr(convertFlag.size());
+		}
+		else if (arg.rfind(capacityFlag, 0) == 0) {
+			capacityType = arg.substr(capacityFlag.size());
+		}
+		else if (arg.rfind(scenariosFlag, 0) == 0 && arg.size() > scenariosFlag.size()) {
+			scenariosPath = arg.substr(scenariosFlag.size());
+		}
+		else if (arg.rfind(sweepFlag, 0) == 0) {
+			try {
+				lambdas = ParametricMaxFlow::parseLambdas(arg.substr(sweepFlag.size()));
+			}
+			catch (const std::runtime_error& error) {
+				std::cerr << "--sweep: " << error.what() << std::endl;
+				return usage(argv[0]);
+			}
+		}
+		else if (arg.rfind(serveFlag, 0) == 0 && arg.size() > serveFlag.size()) {
+			servePath = arg.substr(serveFlag.size());
+		}
+		else if (arg == "--profile") {
+			profile.path = "";
+		}
+		else if (arg.rfind("--profile=", 0) == 0 && arg.size() > 10) {
+			profile.path = arg.substr(10);
+		}
+		else if (arg == "--order=input" || arg == "--order=bfs" || arg == "--order=rcm") {
+			order = arg == "--order=bfs" ? NodeOrder::Bfs : arg == "--order=rcm" ? NodeOrder::ReverseCuthillMcKee : NodeOrder::Input;
+		}
+		else if (arg == "--bfs=top-down" || arg == "--bfs=direction-optimizing" || arg == "--bfs=bidirectional") {
+			bfs = arg == "--bfs=direction-optimizing" ? Algorithms::BfsStrategy::DirectionOptimizing
+				: arg == "--bfs=bidirectional" ? Algorithms::BfsStrategy::Bidirectional : Algorithms::BfsStrategy::TopDown;
+		}
+		else if (arg == "--convert-to-text") {
+			convertToText = true;
+		}
+		else if (arg == "--contingency") {
+			contingency = true;
+		}
+		else if (arg == "--min-cut") {
+			minCut = true;
+		}
+		else if (arg == "--reduce") {
+			reduce = true;
+		}
+		else if (arg == "--min-cost") {
+			minCost = true;
+		}
+		else if (arg == "--paths") {
+			paths = true;
+		}
+		else if (arg.rfind(threadsFlag, 0) == 0 && arg.size() > threadsFlag.size() && arg.size() <= threadsFlag.size() + 4
+			&& arg.find_first_not_of("0123456789", threadsFlag.size()) == std::string::npos) {
+			threadCount = std::stoul(arg.substr(threadsFlag.size()));
+		}
+		else if (arg.rfind("--", 0) != 0 && inputPath.empty()) {
+			inputPath = arg;
+		}
+		else {
+			return usage(argv[0]);
+		}
+	}
 
-	std::vector<GraphNode*> nodes;
-	nodes.push_back(source);
-	for (auto& pair : indexNodes)
-		nodes.push_back(pair.second);
-	nodes.push_back(sink);
+	if (!maxFlowAlgorithms<int>(threadCount).count(algorithmName))
+		return usage(argv[0]);
+	// Snapshots e a análise N-1 usam capacidades de 32 bits.
+	if (capacityType != "int32" && capacityType != "int64" && capacityType != "double")
+		return usage(argv[0]);
+	if (capacityType != "int32" && (!snapshotPath.empty() || contingency || !scenariosPath.empty() || reduce))
+		return usage(argv[0]);
+	// O fluxo de custo mínimo tem um solver próprio, com capacidades inteiras.
+	if (minCost && (capacityType == "double" || reduce || contingency || !scenariosPath.empty()))
+		return usage(argv[0]);
+	// A decomposição do fluxo acompanha o relatório de uma única rede, com capacidades inteiras.
+	if (paths && (capacityType == "double" || contingency || !scenariosPath.empty() || !lambdas.empty()))
+		return usage(argv[0]);
+	// A varredura usa capacidades de 64 bits e escreve o seu próprio relatório.
+	if (!lambdas.empty() && (capacityType != "int32" || contingency || !scenariosPath.empty() || minCut || minCost || reduce
+		|| !snapshotPath.empty()))
+		return usage(argv[0]);
+	// O servidor mantém a rede resolvida por 'IncrementalMaxFlow' e responde só às consultas.
+	if (!servePath.empty() && (capacityType != "int32" || contingency || !scenariosPath.empty() || !lambdas.empty() || minCut
+		|| minCost || reduce || paths || !snapshotPath.empty()))
+		return usage(argv[0]);
+	// Com os cenários na entrada padrão, a rede precisa vir de um arquivo.
+	if (scenariosPath == "-" && inputPath.empty())
+		return usage(argv[0]);
 
-	Graph graph(nodes);
+	// A entrada pode estar no formato texto ou ser um snapshot binário, reconhecido pela assinatura.
+	Network input;
+	std::optional<NetworkSnapshot> snapshot;
+	std::optional<Profiler::ScopedPhase> phase(std::in_place, "parse");
+	try {
+		if (!inputPath.empty() && NetworkSnapshot::isSnapshot(inputPath)) {
+			snapshot = NetworkSnapshot::load(inputPath);
+			snapshot->validate();
+			input = snapshot->getNetwork();
+		}
+		else {
+			input = inputPath.empty() ? NetworkParser::parseDescriptor(0) : NetworkParser::parseFile(inputPath);
+		}
 
-	int maxFlow = Algorithms::EdmondKarp(&graph, source, sink);
-	std::cout << maxFlow << std::endl;
+		if (!convertPath.empty()) {
+			NetworkSnapshot::write(convertPath, input);
+			return 0;
+		}
+	}
+	catch (const std::runtime_error& error) {
+		std::cerr << (inputPath.empty() ? "entrada" : inputPath) << ": " << error.what() << std::endl;
+		return 1;
+	}
+	phase.reset();
 
-	int totalDemand = 0;
-	for (GraphNode* node : graph.getNodes()) {
-		if (node->getDemand() > 0)
-			totalDemand += node->getDemand();
+	if (convertToText) {
+		input.print(std::cout);
+		std::cout.flush();
+		return 0;
 	}
-	int unattendedEnergy = totalDemand - maxFlow;
-	std::cout << unattendedEnergy << std::endl;
 
-	int totalOutgoingFlow = 0;
-	for (auto* gerador : geradores) {
-		for (GraphEdge& edge : gerador->getEdges())
-			totalOutgoingFlow += edge.getFlow();
+	// A análise N-1, os cenários, a varredura e o servidor resolvem o fluxo máximo sem limites inferiores.
+	if ((contingency || !scenariosPath.empty() || !lambdas.empty() || !servePath.empty()) && input.hasLowerBounds()) {
+		std::cerr << (inputPath.empty() ? "entrada" : inputPath)
+			<< ": limites mínimos não podem ser usados com --contingency, --scenarios, --sweep ou --serve" << std::endl;
+		return 1;
 	}
-	std::cout << totalOutgoingFlow << std::endl;
 
-	std::vector<GraphEdge> criticalEdges;
-	for (GraphNode* node : graph.getNodes()) {
-		for (GraphEdge& edge : node->getEdges()) {
-			if (edge.getFlow() == edge.getCapacity()) {
-				criticalEdges.push_back(edge);
+	// Servidor: a rede é resolvida uma vez e as consultas chegam pelo socket até 'desligar'.
+	if (!servePath.empty()) {
+		try {
+			std::optional<DiagnosisService> service;
+			{
+				Profiler::ScopedPhase buildPhase("build");
+				service.emplace(input);
 			}
+			DiagnosisServer server(*service, servePath);
+			std::cerr << "Escutando em " << servePath << std::endl;
+			server.run();
+		}
+		catch (const std::runtime_error& error) {
+			std::cerr << servePath << ": " << error.what() << std::endl;
+			return 1;
 		}
+		return 0;
+	}
+
+	// Varredura paramétrica: um ponto por fator, em ordem crescente, e as mudanças de inclinação.
+	if (!lambdas.empty()) {
+		Profiler::ScopedPhase sweepPhase("sweep");
+		ParametricMaxFlow parametric(input, maxFlowAlgorithms<std::int64_t>(threadCount, bfs).at(algorithmName));
+		std::vector<ParametricPoint> points = parametric.sweep(lambdas);
+		// 'digits10' dígitos: os fluxos das mudanças de inclinação não perdem dígitos, e os fatores
+		// saem como foram escritos, sem o resíduo de 'início + i * passo'.
+		std::cout.precision(std::numeric_limits<double>::digits10);
+		std::cout << points.size() << '\n';
+		for (const ParametricPoint& point : points)
+			std::cout << point.lambda << " " << point.maxFlow << " " << point.demand - point.maxFlow << " " << point.cutSlope << '\n';
+		std::vector<ParametricBreakpoint> breakpoints = parametric.breakpoints(points.front().lambda, points.back().lambda);
+		std::cout << breakpoints.size() << '\n';
+		for (const ParametricBreakpoint& breakpoint : breakpoints)
+			std::cout << breakpoint.lambda << " " << breakpoint.maxFlow << '\n';
+		std::cout.flush();
+		return 0;
 	}
 
-	std::cout << criticalEdges.size() << std::endl;
-	for (GraphEdge& edge : criticalEdges) {
-		std::cout << edge.getSource()->getIndex() << " "
-			<< edge.getTarget()->getIndex() << " "
-			<< edge.getCapacity() << std::endl;
+	// Análise N-1: para cada conexão, o fluxo perdido e a demanda não atendida sem ela.
+	if (contingency) {
+		Profiler::ScopedPhase contingencyPhase("contingency");
+		ThreadPool pool(threadCount);
+		ContingencyReport report = ContingencyAnalysis::run(input, pool);
+		std::cout << report.baseMaxFlow << '\n' << report.baseUnmetDemand << '\n' << report.edges.size() << '\n';
+		for (const ContingencyResult& result : report.edges) {
+			std::cout << input.getEdgeSource(result.edge) << " " << input.getEdgeTarget(result.edge) << " "
+				<< input.getEdgeCapacity(result.edge) << " " << result.lostFlow << " " << result.unmetDemand << '\n';
+		}
+		std::cout.flush();
+		return 0;
 	}
 
-	for (auto& pair : indexNodes)
-		delete pair.second;
-	delete source;
-	delete sink;
+	// Lote de cenários: a rede é montada uma vez e cada cenário é resolvido sobre ela.
+	if (!scenariosPath.empty()) {
+		std::ifstream file;
+		if (scenariosPath != "-") {
+			file.open(scenariosPath);
+			if (!file) {
+				std::cerr << "Erro ao abrir arquivo: " << scenariosPath << std::endl;
+				return 1;
+			}
+		}
+		Profiler::ScopedPhase scenariosPhase("scenarios");
+		ThreadPool pool(threadCount);
+		// Os cenários já usam todas as threads; cada um é resolvido em uma única thread.
+		ScenarioBatch batch(input, maxFlowAlgorithms<int>(1, bfs).at(algorithmName), pool);
+		ScenarioReader reader(scenariosPath == "-" ? std::cin : file, input);
+		try {
+			batch.run(reader, std::cout);
+		}
+		catch (const std::runtime_error& error) {
+			std::cerr << (scenariosPath == "-" ? "cenarios" : scenariosPath) << ": " << error.what() << std::endl;
+			return 1;
+		}
+		return 0;
+	}
 
-	return 0;
+	// O fluxo de um snapshot foi calculado com capacidades de 32 bits.
+	const NetworkSnapshot* loaded = snapshot ? &*snapshot : nullptr;
+	if (capacityType != "int32" && loaded && loaded->hasFlow()) {
+		std::cerr << inputPath << ": o snapshot já traz um fluxo com capacidades de 32 bits; use --capacity=int32" << std::endl;
+		return 1;
+	}
+	if (capacityType == "int64")
+		return solve<std::int64_t>(input, loaded, inputPath, snapshotPath, algorithmName, threadCount, minCut, reduce, order, bfs, minCost, paths);
+	if (capacityType == "double")
+		return solve<double>(input, loaded, inputPath, snapshotPath, algorithmName, threadCount, minCut, reduce, order, bfs, minCost, paths);
+	return solve<int>(input, loaded, inputPath, snapshotPath, algorithmName, threadCount, minCut, reduce, order, bfs, minCost, paths);
 }
@@ -0,0 +1,268 @@
+#include <algorithm>
+#include <functional>
+#include <limits>
+#include <queue>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "Algorithms.h"
+#include "Profiler.h"
+
+using NodeId = ResidualGraph::NodeId;
+using ArcId = ResidualGraph::ArcId;
+
+namespace {
+	/**
+	 * \brief Distância dos nós que o Dijkstra não alcança.
+	 */
+	constexpr std::int64_t UNREACHABLE = std::numeric_limits<std::int64_t>::max();
+
+	/**
+	 * \brief Nível usado para nós fora do grafo de níveis.
+	 */
+	constexpr NodeId UNREACHED = std::numeric_limits<NodeId>::max();
+
+	/**
+	 * \struct CostWorkspace
+	 * \brief Custos e vetores do fluxo de custo mínimo, indexados pelo arco ou pelo nó.
+	 */
+	template <typename Capacity>
+	struct CostWorkspace {
+		explicit CostWorkspace(const BasicResidualGraph<Capacity>& graph) : network(graph) {}
+
+		const BasicResidualGraph<Capacity>& network;
+
+		/**
+		 * \brief Custo de cada arco: o da aresta no arco direto e o negado no reverso.
+		 */
+		std::vector<std::int64_t> arcCost;
+
+		/**
+		 * \brief Potencial de cada nó; os custos reduzidos dos arcos residuais nunca são negativos.
+		 */
+		std::vector<std::int64_t> potential;
+
+		std::vector<std::int64_t> distance;
+		std::vector<NodeId> level;
+		std::vector<ArcId> current;
+		std::vector<NodeId> queue;
+		std::vector<ArcId> path;
+
+		/**
+		 * \brief Verifica se o arco tem capacidade residual e custo reduzido zero, isto é, se
+		 *        está em um caminho de custo mínimo.
+		 */
+		bool admissible(NodeId u, ArcId arc) const {
+			return CapacityTraits<Capacity>::positive(network.getResidual(arc))
+				&& arcCost[arc] + potential[u] - potential[network.getHead(arc)] == 0;
+		}
+	};
+
+	/**
+	 * \brief Dijkstra com os custos reduzidos, seguido da atualização dos potenciais.
+	 *
+	 * \details A busca para quando o sumidouro sai da fila. Cada potencial soma
+	 *          min(distância do nó, distância do sumidouro): com esse limite os custos reduzidos
+	 *          continuam não negativos, inclusive nos nós que a busca não chegou a fechar.
+	 *
+	 * \return Retorna `true` se o sumidouro for alcançável.
+	 *
+	 * \complexidade O(E log V).
+	 */
+	template <typename Capacity>
+	bool updatePotentials(CostWorkspace<Capacity>& workspace, NodeId source, NodeId sink)
+	{
+		const BasicResidualGraph<Capacity>& network = workspace.network;
+		std::vector<std::int64_t>& distance = workspace.distance;
+		std::fill(distance.begin(), distance.end(), UNREACHABLE);
+
+		using Entry = std::pair<std::int64_t, NodeId>;
+		std::priority_queue<Entry, std::vector<Entry>, std::greater<Entry>> heap;
+		distance[source] = 0;
+		heap.push({ 0, source });
+		while (!heap.empty()) {
+			auto [d, u] = heap.top();
+			heap.pop();
+			if (d != distance[u])
+				continue;
+			if (u == sink)
+				break;
+			Profiler::count(Profiler::Counter::EdgesScanned, network.end(u) - network.begin(u));
+
+			for (ArcId arc = network.begin(u); arc < network.end(u); arc++) {
+				if (!CapacityTraits<Capacity>::positive(network.getResidual(arc)))
+					continue;
+				NodeId v = network.getHead(arc);
+				std::int64_t reduced = workspace.arcCost[arc] + workspace.potential[u] - workspace.potential[v];
+				if (d + reduced < distance[v]) {
+					distance[v] = d + reduced;
+					heap.push({ distance[v], v });
+				}
+			}
+		}
+
+		if (distance[sink] == UNREACHABLE)
+			return false;
+		for (NodeId v = 0; v < network.getNodeCount(); v++)
+			workspace.potential[v] += std::min(distance[v], distance[sink]);
+		return true;
+	}
+
+	/**
+	 * \brief Grafo de níveis dos arcos admissíveis (custo reduzido zero), como em 'bfsLevels' do Dinic.
+	 *
+	 * \details Os arcos de custo zero podem formar ciclos; os níveis da BFS os quebram.
+	 */
+	template <typename Capacity>
+	bool admissibleLevels(CostWorkspace<Capacity>& workspace, NodeId source, NodeId sink)
+	{
+		const BasicResidualGraph<Capacity>& network = workspace.network;
+		std::vector<NodeId>& level = workspace.level;
+		std::vector<NodeId>& queue = workspace.queue;
+		std::fill(level.begin(), level.end(), UNREACHED);
+		queue.clear();
+
+		queue.push_back(source);
+		level[source] = 0;
+		Profiler::count(Profiler::Counter::BfsCalls);
+
+		for (std::size_t head = 0; head < queue.size(); head++) {
+			NodeId u = queue[head];
+			if (level[u] >= level[sink])
+				break;
+			Profiler::count(Profiler::Counter::EdgesScanned, network.end(u) - network.begin(u));
+
+			for (ArcId arc = network.begin(u); arc < network.end(u); arc++) {
+				NodeId v = network.getHead(arc);
+				if (level[v] == UNREACHED && workspace.admissible(u, arc)) {
+					level[v] = level[u] + 1;
+					queue.push_back(v);
+				}
+			}
+		}
+
+		return level[sink] != UNREACHED;
+	}
+
+	/**
+	 * \brief Fluxo bloqueante pelos arcos admissíveis que avançam um nível, como em 'blockingFlow' do Dinic.
+	 *
+	 * \return O fluxo enviado.
+	 */
+	template <typename Capacity>
+	Capacity admissibleBlockingFlow(BasicResidualGraph<Capacity>& network, CostWorkspace<Capacity>& workspace,
+		NodeId source, NodeId sink)
+	{
+		std::vector<NodeId>& level = workspace.level;
+		std::vector<ArcId>& current = workspace.current;
+		std::vector<ArcId>& path = workspace.path;
+
+		Capacity flow = 0;
+		for (NodeId u = 0; u < network.getNodeCount(); u++)
+			current[u] = network.begin(u);
+		path.clear();
+
+		NodeId u = source;
+		while (true) {
+			if (u == sink) {
+				Capacity pathFlow = std::numeric_limits<Capacity>::max();
+				for (ArcId arc : path)
+					pathFlow = std::min(pathFlow, network.getResidual(arc));
+
+				std::size_t firstSaturated = path.size();
+				for (std::size_t i = 0; i < path.size(); i++) {
+					network.push(path[i], pathFlow);
+					if (firstSaturated == path.size() && !CapacityTraits<Capacity>::positive(network.getResidual(path[i])))
+						firstSaturated = i;
+				}
+				flow = CapacityTraits<Capacity>::add(flow, pathFlow);
+				Profiler::count(Profiler::Counter::AugmentingPaths);
+				Profiler::sample(Profiler::Distribution::PathLength, static_cast<double>(path.size()));
+				Profiler::sample(Profiler::Distribution::Bottleneck, static_cast<double>(pathFlow));
+
+				u = network.getHead(network.getReverse(path[firstSaturated]));
+				path.resize(firstSaturated);
+				continue;
+			}
+
+			ArcId end = network.end(u);
+			ArcId& arc = current[u];
+			while (arc < end && (level[network.getHead(arc)] != level[u] + 1 || !workspace.admissible(u, arc)))
+				arc++;
+
+			if (arc < end) {
+				path.push_back(arc);
+				u = network.getHead(arc);
+			}
+			else {
+				level[u] = UNREACHED;
+				if (path.empty())
+					break;
+				u = network.getHead(network.getReverse(path.back()));
+				path.pop_back();
+				current[u]++;
+			}
+		}
+
+		return flow;
+	}
+}
+
+MinCostFlow<int> Algorithms::MinCostMaxFlow(Graph* graph, GraphNode* source, GraphNode* sink)
+{
+	// As arestas diretas são numeradas na mesma ordem em que 'ResidualGraph(Graph*)' as percorre.
+	std::vector<int> costs;
+	for (GraphNode* node : graph->getNodes())
+		for (GraphEdge& edge : node->getEdges())
+			if (!edge.isReverse())
+				costs.push_back(edge.getCost());
+
+	ResidualGraph network(graph);
+	MinCostFlow<int> result = MinCostMaxFlow(network, costs,
+		network.getNodeId(source->getIndex()),
+		network.getNodeId(sink->getIndex()));
+	network.writeBack();
+	return result;
+}
+
+template <typename Capacity>
+MinCostFlow<Capacity> Algorithms::MinCostMaxFlow(BasicResidualGraph<Capacity>& network, std::span<const int> edgeCosts,
+	NodeId source, NodeId sink)
+{
+	network.reset();
+
+	CostWorkspace<Capacity> workspace(network);
+	workspace.arcCost.assign(network.getArcCount(), 0);
+	for (std::size_t e = 0; e < edgeCosts.size() && e < network.getEdgeCount(); e++) {
+		if (edgeCosts[e] < 0)
+			throw std::runtime_error("aresta " + std::to_string(e) + " com custo negativo");
+		ArcId arc = network.getEdgeArc(e);
+		workspace.arcCost[arc] = edgeCosts[e];
+		workspace.arcCost[network.getReverse(arc)] = -edgeCosts[e];
+	}
+	// Sem fluxo, só os arcos diretos têm capacidade residual, e os seus custos não são
+	// negativos: os potenciais começam em zero.
+	workspace.potential.assign(network.getNodeCount(), 0);
+	workspace.distance.resize(network.getNodeCount());
+	workspace.level.resize(network.getNodeCount());
+	workspace.current.resize(network.getNodeCount());
+	workspace.queue.reserve(network.getNodeCount());
+
+	MinCostFlow<Capacity> result{ 0, 0 };
+	if (source == sink)
+		return result;
+
+	while (updatePotentials(workspace, source, sink)) {
+		while (admissibleLevels(workspace, source, sink))
+			result.flow = CapacityTraits<Capacity>::add(result.flow, admissibleBlockingFlow(network, workspace, source, sink));
+	}
+
+	for (std::size_t e = 0; e < edgeCosts.size() && e < network.getEdgeCount(); e++)
+		result.cost += static_cast<std::int64_t>(network.getEdgeFlow(e)) * edgeCosts[e];
+	return result;
+}
+
+template MinCostFlow<int> Algorithms::MinCostMaxFlow<int>(BasicResidualGraph<int>&, std::span<const int>, NodeId, NodeId);
+template MinCostFlow<std::int64_t> Algorithms::MinCostMaxFlow<std::int64_t>(BasicResidualGraph<std::int64_t>&, std::span<const int>, NodeId, NodeId);
@@ -0,0 +1,54 @@
+#include <vector>
+
+#include "Algorithms.h"
+
+using NodeId = ResidualGraph::NodeId;
+using ArcId = ResidualGraph::ArcId;
+
+template <typename Capacity>
+std::vector<std::uint8_t> Algorithms::MinCutSourceSide(const BasicResidualGraph<Capacity>& network, NodeId source)
+{
+	std::vector<std::uint8_t> sourceSide(network.getNodeCount(), 0);
+	std::vector<NodeId> queue;
+	queue.reserve(network.getNodeCount());
+
+	queue.push_back(source);
+	sourceSide[source] = 1;
+	for (std::size_t head = 0; head < queue.size(); head++) {
+		NodeId u = queue[head];
+		for (ArcId arc = network.begin(u); arc < network.end(u); arc++) {
+			NodeId v = network.getHead(arc);
+			if (!sourceSide[v] && CapacityTraits<Capacity>::positive(network.getResidual(arc))) {
+				sourceSide[v] = 1;
+				queue.push_back(v);
+			}
+		}
+	}
+
+	return sourceSide;
+}
+
+template <typename Capacity>
+std::vector<ArcId> Algorithms::MinCut(const BasicResidualGraph<Capacity>& network, NodeId source)
+{
+	std::vector<std::uint8_t> sourceSide = MinCutSourceSide(network, source);
+
+	std::vector<ArcId> cut;
+	for (NodeId u = 0; u < network.getNodeCount(); u++) {
+		if (!sourceSide[u])
+			continue;
+		for (ArcId arc = network.begin(u); arc < network.end(u); arc++)
+			if (network.getEdgeId(arc) != ResidualGraph::NO_EDGE && !sourceSide[network.getHead(arc)])
+				cut.push_back(arc);
+	}
+
+	return cut;
+}
+
+template std::vector<std::uint8_t> Algorithms::MinCutSourceSide<int>(const BasicResidualGraph<int>&, NodeId);
+template std::vector<std::uint8_t> Algorithms::MinCutSourceSide<std::int64_t>(const BasicResidualGraph<std::int64_t>&, NodeId);
+template std::vector<std::uint8_t> Algorithms::MinCutSourceSide<double>(const BasicResidualGraph<double>&, NodeId);
+
+template std::vector<ArcId> Algorithms::MinCut<int>(const BasicResidualGraph<int>&, NodeId);
+template std::vector<ArcId> Algorithms::MinCut<std::int64_t>(const BasicResidualGraph<std::int64_t>&, NodeId);
+template std::vector<ArcId> Algorithms::MinCut<double>(const BasicResidualGraph<double>&, NodeId);
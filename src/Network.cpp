@@ -0,0 +1,78 @@
+#include "Network.h"
+
+namespace {
+	/**
+	 * \struct NetworkStorage
+	 * \brief Vetores de uma rede montada em memória, compartilhados pelas cópias da 'Network'.
+	 */
+	struct NetworkStorage {
+		std::vector<int> demands;
+		std::vector<std::uint32_t> generators;
+		std::vector<std::uint32_t> edgeSources;
+		std::vector<std::uint32_t> edgeTargets;
+		std::vector<int> edgeCapacities;
+		std::vector<int> edgeCosts;
+		std::vector<int> supplies;
+		std::vector<int> firmDemands;
+		std::vector<int> edgeLowerBounds;
+	};
+}
+
+void Network::print(std::ostream& out) const
+{
+	out << getNodeCount() << " " << getEdgeCount() << '\n';
+	for (std::uint32_t generator : m_generators) {
+		out << generator << " 0";
+		if (getSupplyLimit(generator) != INT_MAX)
+			out << " " << getSupplyLimit(generator);
+		out << '\n';
+	}
+	for (std::size_t index = 1; index <= getNodeCount(); index++) {
+		if (m_demands[index] > 0) {
+			out << index << " " << m_demands[index];
+			if (getFirmDemand(index) > 0)
+				out << " " << getFirmDemand(index);
+			out << '\n';
+		}
+	}
+	// O fluxo mínimo é a quinta coluna; com ele, o custo é escrito mesmo quando é zero.
+	for (std::size_t e = 0; e < getEdgeCount(); e++) {
+		out << m_edgeSources[e] << " " << m_edgeTargets[e] << " " << m_edgeCapacities[e];
+		if (hasEdgeCosts() || !m_edgeLowerBounds.empty())
+			out << " " << getEdgeCost(e);
+		if (!m_edgeLowerBounds.empty())
+			out << " " << m_edgeLowerBounds[e];
+		out << '\n';
+	}
+}
+
+NetworkBuilder::NetworkBuilder(std::size_t nodeCount, std::size_t edgeCount) :
+	m_demands(nodeCount + 2, 0), m_defined(nodeCount + 2, false)
+{
+	m_edgeSources.reserve(edgeCount);
+	m_edgeTargets.reserve(edgeCount);
+	m_edgeCapacities.reserve(edgeCount);
+}
+
+Network NetworkBuilder::build()
+{
+	auto storage = std::make_shared<NetworkStorage>();
+	storage->demands = std::move(m_demands);
+	storage->generators = std::move(m_generators);
+	storage->edgeSources = std::move(m_edgeSources);
+	storage->edgeTargets = std::move(m_edgeTargets);
+	storage->edgeCapacities = std::move(m_edgeCapacities);
+	storage->edgeCosts = std::move(m_edgeCosts);
+	if (!storage->edgeCosts.empty())
+		storage->edgeCosts.resize(storage->edgeSources.size(), 0);
+	storage->supplies = std::move(m_supplies);
+	storage->firmDemands = std::move(m_firmDemands);
+	storage->edgeLowerBounds = std::move(m_edgeLowerBounds);
+	if (!storage->edgeLowerBounds.empty())
+		storage->edgeLowerBounds.resize(storage->edgeSources.size(), 0);
+	m_defined.clear();
+
+	return Network(storage, storage->demands, storage->generators,
+		storage->edgeSources, storage->edgeTargets, storage->edgeCapacities, storage->edgeCosts,
+		storage->supplies, storage->firmDemands, storage->edgeLowerBounds);
+}
@@ -0,0 +1,246 @@
+#include <algorithm>
+#include <climits>
+#include <cmath>
+#include <functional>
+#include <numbers>
+#include <random>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "NetworkGenerator.h"
+
+namespace {
+	/**
+	 * \class EdgeSink
+	 * \brief Recebe as conexões geradas até atingir o alvo de conexões.
+	 */
+	class EdgeSink {
+	public:
+		EdgeSink(NetworkBuilder& builder, std::size_t limit) : m_builder(builder), m_limit(limit), m_count(0) {}
+
+		/**
+		 * \brief Adiciona uma conexão; retorna falso (sem adicionar) quando o alvo já foi atingido.
+		 */
+		bool add(std::size_t source, std::size_t target, int capacity) {
+			if (m_count == m_limit)
+				return false;
+			m_builder.addEdge(source, target, capacity);
+			m_count++;
+			return true;
+		}
+
+		bool full() const { return m_count == m_limit; }
+
+	private:
+		NetworkBuilder& m_builder;
+		std::size_t m_limit;
+		std::size_t m_count;
+	};
+
+	/**
+	 * \brief Multiplica uma capacidade, saturando em INT_MAX.
+	 */
+	int scale(int capacity, int factor) {
+		return static_cast<int>(std::min<long long>(INT_MAX, static_cast<long long>(capacity) * factor));
+	}
+
+	/**
+	 * \brief Geração -> transmissão -> distribuição.
+	 *
+	 * Índices 1..g são geradores, g+1..g+t subestações de transmissão e o restante consumidores
+	 * de distribuição, alimentados em ramais radiais de oito nós.
+	 */
+	void generateLayered(NetworkBuilder& builder, EdgeSink& edges, std::size_t v, std::mt19937_64& random,
+		const std::function<int()>& capacity, const std::function<int()>& demand)
+	{
+		std::size_t g = std::max<std::size_t>(1, v / 20);
+		std::size_t t = std::min(std::max<std::size_t>(1, v / 5), v - g - 1);
+		std::size_t d = v - g - t;
+		auto transmission = [&](std::size_t k) { return g + 1 + k % std::max<std::size_t>(1, t); };
+		auto distribution = [&](std::size_t k) { return g + t + 1 + k; };
+
+		for (std::size_t i = 1; i <= v; i++)
+			builder.defineNode(i, i <= g ? 0 : demand());
+
+		// Cada gerador alimenta duas subestações vizinhas do anel.
+		for (std::size_t i = 0; i < g && t > 0; i++) {
+			edges.add(i + 1, transmission(i * t / g), scale(capacity(), 4));
+			edges.add(i + 1, transmission(i * t / g + 1), scale(capacity(), 4));
+		}
+		// Anel de transmissão nos dois sentidos.
+		for (std::size_t k = 0; t > 1 && k < t; k++) {
+			edges.add(transmission(k), transmission(k + 1), scale(capacity(), 2));
+			edges.add(transmission(k + 1), transmission(k), scale(capacity(), 2));
+		}
+		// Ramais radiais: o primeiro nó de cada ramal é ligado a uma subestação.
+		for (std::size_t j = 0; j < d; j++) {
+			std::size_t feeder = t > 0 ? transmission(j * t / d) : 1 + j % g;
+			edges.add(j % 8 == 0 ? feeder : distribution(j - 1), distribution(j), capacity());
+		}
+		// Interligações entre ramais próximos e cordas de transmissão.
+		std::uniform_int_distribution<std::size_t> offset(1, 16);
+		while (!edges.full()) {
+			if (d > 1 && random() % 10 < 7) {
+				std::size_t a = random() % d;
+				std::size_t b = std::min(d - 1, a + offset(random));
+				if (random() % 2)
+					std::swap(a, b);
+				edges.add(distribution(a), distribution(b), capacity());
+			}
+			else {
+				edges.add(random() % v + 1, random() % v + 1, capacity());
+			}
+		}
+	}
+
+	/**
+	 * \brief Pontos aleatórios no quadrado unitário ligados aos vizinhos dentro de um raio.
+	 *
+	 * O raio é escolhido para que o número esperado de pares seja o alvo de conexões, e os
+	 * pares são encontrados com uma grade de células do tamanho do raio.
+	 */
+	void generateGeometric(NetworkBuilder& builder, EdgeSink& edges, std::size_t v, std::size_t e, std::mt19937_64& random,
+		const std::function<int()>& capacity, const std::function<int()>& demand)
+	{
+		std::size_t g = std::max<std::size_t>(1, v / 20);
+		for (std::size_t i = 1; i <= v; i++)
+			builder.defineNode(i, i <= g ? 0 : demand());
+
+		double radius = std::sqrt(2.0 * static_cast<double>(e) / (std::numbers::pi * static_cast<double>(v) * static_cast<double>(v)));
+		radius = std::clamp(radius, 1.0 / std::sqrt(4.0 * static_cast<double>(v)), 1.0);
+		std::size_t cells = static_cast<std::size_t>(std::ceil(1.0 / radius));
+
+		std::uniform_real_distribution<double> coordinate(0.0, 1.0);
+		std::vector<double> x(v), y(v);
+		std::vector<std::vector<std::size_t>> grid(cells * cells);
+		auto cellOf = [&](double value) { return std::min(cells - 1, static_cast<std::size_t>(value * static_cast<double>(cells))); };
+		for (std::size_t i = 0; i < v; i++) {
+			x[i] = coordinate(random);
+			y[i] = coordinate(random);
+			grid[cellOf(x[i]) * cells + cellOf(y[i])].push_back(i);
+		}
+
+		std::vector<std::pair<std::size_t, std::size_t>> pairs;
+		for (std::size_t i = 0; i < v; i++) {
+			std::size_t cx = cellOf(x[i]), cy = cellOf(y[i]);
+			for (std::size_t nx = cx > 0 ? cx - 1 : 0; nx <= std::min(cells - 1, cx + 1); nx++) {
+				for (std::size_t ny = cy > 0 ? cy - 1 : 0; ny <= std::min(cells - 1, cy + 1); ny++) {
+					for (std::size_t j : grid[nx * cells + ny]) {
+						double dx = x[i] - x[j], dy = y[i] - y[j];
+						if (i < j && dx * dx + dy * dy <= radius * radius)
+							pairs.emplace_back(i, j);
+					}
+				}
+			}
+		}
+
+		std::shuffle(pairs.begin(), pairs.end(), random);
+		for (auto [a, b] : pairs) {
+			if (random() % 2)
+				std::swap(a, b);
+			if (!edges.add(a + 1, b + 1, capacity()))
+				break;
+		}
+	}
+
+	/**
+	 * \brief Grade quadrada com conexões nos dois sentidos; com 'chords', completa o alvo com cordas aleatórias.
+	 */
+	void generateGrid(NetworkBuilder& builder, EdgeSink& edges, std::size_t v, bool chords, std::mt19937_64& random,
+		const std::function<int()>& capacity, const std::function<int()>& demand)
+	{
+		std::size_t width = static_cast<std::size_t>(std::ceil(std::sqrt(static_cast<double>(v))));
+		for (std::size_t i = 1; i <= v; i++)
+			builder.defineNode(i, (i - 1) % width == 0 ? 0 : demand());
+
+		for (std::size_t k = 0; k < v; k++) {
+			if ((k + 1) % width != 0 && k + 1 < v) {
+				edges.add(k + 1, k + 2, capacity());
+				edges.add(k + 2, k + 1, capacity());
+			}
+			if (k + width < v) {
+				edges.add(k + 1, k + width + 1, capacity());
+				edges.add(k + width + 1, k + 1, capacity());
+			}
+		}
+		while (chords && !edges.full())
+			edges.add(random() % v + 1, random() % v + 1, capacity());
+	}
+
+	/**
+	 * \brief Corredor longo e estreito com um gerador em uma ponta e consumidores de demanda 1.
+	 *
+	 * As conexões têm a capacidade máxima, então cada aumento do Edmonds-Karp envia uma única
+	 * unidade, ao consumidor não atendido mais próximo, depois de uma BFS que percorre todo o
+	 * trecho já atendido do corredor: O(V * E) no total, contra O(V) fases curtas no Dinic.
+	 */
+	void generateAdversarial(NetworkBuilder& builder, EdgeSink& edges, std::size_t v, std::mt19937_64& random, int maxCapacity)
+	{
+		std::size_t width = std::max<std::size_t>(1, std::min<std::size_t>(8, v / 2));
+		for (std::size_t i = 1; i <= v; i++)
+			builder.defineNode(i, i == 1 ? 0 : 1);
+
+		for (std::size_t k = 0; k < v; k++) {
+			if (k + width < v)
+				edges.add(k + 1, k + width + 1, maxCapacity);
+			if ((k + 1) % width != 0 && k + 1 < v)
+				edges.add(k + 1, k + 2, maxCapacity);
+		}
+		// Conexões extras avançam uma coluna do corredor em uma linha aleatória.
+		while (!edges.full() && v > width) {
+			std::size_t k = random() % (v - width);
+			std::size_t column = (k + width) / width * width;
+			edges.add(k + 1, std::min(v - 1, column + random() % width) + 1, maxCapacity);
+		}
+	}
+}
+
+NetworkGenerator::Topology NetworkGenerator::parseTopology(const std::string& name)
+{
+	if (name == "layered")
+		return Topology::Layered;
+	if (name == "geometric")
+		return Topology::Geometric;
+	if (name == "grid")
+		return Topology::Grid;
+	if (name == "mesh")
+		return Topology::Mesh;
+	if (name == "adversarial")
+		return Topology::Adversarial;
+	throw std::runtime_error("topologia desconhecida: " + name);
+}
+
+Network NetworkGenerator::generate(const Options& options)
+{
+	std::size_t v = options.nodeCount;
+	if (v < 2)
+		throw std::runtime_error("a rede precisa de ao menos dois nós");
+	if (options.minCapacity < 0 || options.minCapacity > options.maxCapacity)
+		throw std::runtime_error("faixa de capacidades inválida");
+
+	std::mt19937_64 random(options.seed);
+	std::uniform_int_distribution<int> capacityDistribution(options.minCapacity, options.maxCapacity);
+	std::uniform_int_distribution<int> demandDistribution(std::max(1, options.minCapacity), std::max(1, options.maxCapacity));
+	std::function<int()> capacity = [&]() { return capacityDistribution(random); };
+	std::function<int()> demand = [&]() { return demandDistribution(random); };
+
+	NetworkBuilder builder(v, options.edgeCount);
+	EdgeSink edges(builder, options.edgeCount);
+	switch (options.topology) {
+	case Topology::Layered:
+		generateLayered(builder, edges, v, random, capacity, demand);
+		break;
+	case Topology::Geometric:
+		generateGeometric(builder, edges, v, options.edgeCount, random, capacity, demand);
+		break;
+	case Topology::Grid:
+	case Topology::Mesh:
+		generateGrid(builder, edges, v, options.topology == Topology::Mesh, random, capacity, demand);
+		break;
+	case Topology::Adversarial:
+		generateAdversarial(builder, edges, v, random, options.maxCapacity);
+		break;
+	}
+	return builder.build();
+}
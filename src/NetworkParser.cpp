@@ -0,0 +1,274 @@
+#include <algorithm>
+#include <cerrno>
+#include <climits>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "NetworkParser.h"
+
+namespace {
+	/**
+	 * \brief Tamanho dos blocos lidos de um descritor.
+	 */
+	constexpr std::size_t BLOCK_SIZE = 1 << 20;
+
+	/**
+	 * \brief Número máximo de conexões reservadas antecipadamente quando o tamanho da entrada é desconhecido.
+	 */
+	constexpr std::size_t MAX_RESERVED = 1 << 24;
+
+	/**
+	 * \class Scanner
+	 * \brief Percorre o texto da entrada lendo inteiros sem sinal e contando as linhas.
+	 *
+	 * \details O texto vem de um bloco de memória (arquivo mapeado) ou é lido de um descritor
+	 *          em blocos de 'BLOCK_SIZE' bytes. No segundo caso, quando o bloco atual termina,
+	 *          o próximo é lido para o mesmo buffer; um número dividido entre dois blocos é
+	 *          lido normalmente, pois os dígitos são consumidos um a um.
+	 */
+	class Scanner {
+	public:
+		Scanner(const char* data, std::size_t size) : m_pos(data), m_end(data + size), m_fd(-1), m_line(1) {}
+
+		Scanner(int fd) : m_pos(nullptr), m_end(nullptr), m_fd(fd), m_buffer(BLOCK_SIZE), m_line(1) {}
+
+		/**
+		 * \brief Número da linha atual, a partir de 1.
+		 */
+		std::size_t getLine() const { return m_line; }
+
+		/**
+		 * \brief Ignora linhas em branco antes de um registro.
+		 * \return Falso se a entrada terminou.
+		 */
+		bool skipBlankLines() {
+			while (available()) {
+				char c = *m_pos;
+				if (c == '\n')
+					m_line++;
+				else if (c != ' ' && c != '\t' && c != '\r')
+					return true;
+				m_pos++;
+			}
+			return false;
+		}
+
+		/**
+		 * \brief Lê um inteiro sem sinal na linha atual, ignorando espaços antes dele.
+		 * \param value Recebe o valor lido.
+		 * \return Falso se a linha terminou, se o próximo caractere não é um dígito ou se o
+		 *         valor não cabe em 64 bits.
+		 */
+		bool readUnsigned(std::uint64_t& value) {
+			while (available() && (*m_pos == ' ' || *m_pos == '\t' || *m_pos == '\r'))
+				m_pos++;
+			if (!available() || *m_pos < '0' || *m_pos > '9')
+				return false;
+
+			value = 0;
+			while (available() && *m_pos >= '0' && *m_pos <= '9') {
+				std::uint64_t digit = static_cast<std::uint64_t>(*m_pos - '0');
+				if (value > (UINT64_MAX - digit) / 10)
+					return false;
+				value = value * 10 + digit;
+				m_pos++;
+			}
+			return true;
+		}
+
+		/**
+		 * \brief Descarta o restante da linha atual, incluindo a quebra de linha.
+		 */
+		void endLine() {
+			while (available()) {
+				if (*m_pos++ == '\n') {
+					m_line++;
+					return;
+				}
+			}
+		}
+
+	private:
+		/**
+		 * \brief Garante que há ao menos um byte a ler, lendo o próximo bloco se necessário.
+		 */
+		bool available() {
+			if (m_pos != m_end)
+				return true;
+			if (m_fd < 0)
+				return false;
+
+			ssize_t count;
+			do {
+				count = ::read(m_fd, m_buffer.data(), m_buffer.size());
+			} while (count < 0 && errno == EINTR);
+			if (count < 0)
+				throw std::runtime_error(std::string("erro ao ler a entrada: ") + std::strerror(errno));
+			if (count == 0) {
+				m_fd = -1;
+				return false;
+			}
+
+			m_pos = m_buffer.data();
+			m_end = m_pos + count;
+			return true;
+		}
+
+		const char* m_pos;
+		const char* m_end;
+		int m_fd;
+		std::vector<char> m_buffer;
+		std::size_t m_line;
+	};
+
+	[[noreturn]] void fail(const Scanner& scanner, const std::string& message) {
+		throw std::runtime_error("linha " + std::to_string(scanner.getLine()) + ": " + message);
+	}
+
+	/**
+	 * \brief Lê um campo de uma linha, verificando se está no intervalo [minimum, maximum].
+	 */
+	std::uint64_t readField(Scanner& scanner, std::uint64_t minimum, std::uint64_t maximum,
+		const char* expected, const char* field)
+	{
+		std::uint64_t value;
+		if (!scanner.readUnsigned(value))
+			fail(scanner, std::string("esperado '") + expected + "'");
+		if (value < minimum || value > maximum)
+			fail(scanner, std::string(field) + " " + std::to_string(value) + " fora do intervalo "
+				+ std::to_string(minimum) + ".." + std::to_string(maximum));
+		return value;
+	}
+
+	/**
+	 * \brief Lê a rede completa.
+	 * \param scanner O texto da entrada.
+	 * \param maxNodes Maior número de nós que cabe na entrada.
+	 * \param maxReserved Limite para as conexões reservadas a partir do cabeçalho, para que um
+	 *                    cabeçalho malformado não cause uma alocação gigantesca.
+	 */
+	Network parse(Scanner& scanner, std::size_t maxNodes, std::size_t maxReserved) {
+		constexpr const char* HEADER = "V E";
+		constexpr const char* NODE = "índice tipo [limite]";
+		constexpr const char* EDGE = "origem destino capacidade [custo [mínimo]]";
+		constexpr std::uint64_t MAX_NODES = UINT32_MAX - 2;
+
+		if (!scanner.skipBlankLines())
+			fail(scanner, "entrada vazia");
+		std::size_t v = readField(scanner, 1, MAX_NODES, HEADER, "número de nós");
+		std::size_t e = readField(scanner, 0, SIZE_MAX, HEADER, "número de conexões");
+		scanner.endLine();
+
+		if (v > maxNodes)
+			fail(scanner, "o número de nós excede o tamanho da entrada");
+		NetworkBuilder network(v, std::min(e, maxReserved));
+
+		for (std::size_t i = 0; i < v; i++) {
+			if (!scanner.skipBlankLines())
+				fail(scanner, std::string("fim da entrada; esperado '") + NODE + "'");
+			std::size_t index = readField(scanner, 1, v, NODE, "índice");
+			int demand = static_cast<int>(readField(scanner, 0, INT_MAX, NODE, "tipo"));
+			if (network.isDefined(index))
+				fail(scanner, "nó " + std::to_string(index) + " definido mais de uma vez");
+			network.defineNode(index, demand);
+			// O limite é opcional: a geração máxima de um gerador ou a demanda firme de um consumidor.
+			std::uint64_t limit;
+			if (scanner.readUnsigned(limit)) {
+				if (demand == 0 && limit > INT_MAX)
+					fail(scanner, "geração máxima " + std::to_string(limit) + " fora do intervalo 0.." + std::to_string(INT_MAX));
+				if (demand > 0 && limit > static_cast<std::uint64_t>(demand))
+					fail(scanner, "demanda firme " + std::to_string(limit) + " fora do intervalo 0.." + std::to_string(demand));
+				if (demand == 0)
+					network.setSupplyLimit(index, static_cast<int>(limit));
+				else if (limit > 0)
+					network.setFirmDemand(index, static_cast<int>(limit));
+			}
+			scanner.endLine();
+		}
+
+		if (!network.hasGenerators())
+			fail(scanner, "a rede não possui geradores");
+
+		for (std::size_t i = 0; i < e; i++) {
+			if (!scanner.skipBlankLines())
+				fail(scanner, std::string("fim da entrada; esperado '") + EDGE + "'");
+			std::size_t source = readField(scanner, 1, v, EDGE, "origem");
+			std::size_t target = readField(scanner, 1, v, EDGE, "destino");
+			int capacity = static_cast<int>(readField(scanner, 0, INT_MAX, EDGE, "capacidade"));
+			// O custo e o fluxo mínimo são opcionais; sem eles a conexão tem custo e mínimo zero.
+			std::uint64_t cost;
+			std::uint64_t lowerBound;
+			bool hasCost = scanner.readUnsigned(cost);
+			if (!hasCost)
+				cost = 0;
+			else if (cost > INT_MAX)
+				fail(scanner, "custo " + std::to_string(cost) + " fora do intervalo 0.." + std::to_string(INT_MAX));
+			if (!hasCost || !scanner.readUnsigned(lowerBound))
+				lowerBound = 0;
+			else if (lowerBound > static_cast<std::uint64_t>(capacity))
+				fail(scanner, "mínimo " + std::to_string(lowerBound) + " fora do intervalo 0.." + std::to_string(capacity));
+			network.addEdge(source, target, capacity, static_cast<int>(cost), static_cast<int>(lowerBound));
+			scanner.endLine();
+		}
+
+		return network.build();
+	}
+}
+
+Network NetworkParser::parseFile(const std::string& path)
+{
+	int fd = ::open(path.c_str(), O_RDONLY);
+	if (fd < 0)
+		throw std::runtime_error("Erro ao abrir arquivo: " + path);
+
+	struct stat info;
+	if (::fstat(fd, &info) < 0 || !S_ISREG(info.st_mode) || info.st_size == 0) {
+		// Arquivos vazios ou especiais (pipes, dispositivos) não podem ser mapeados.
+		try {
+			Network network = parseDescriptor(fd);
+			::close(fd);
+			return network;
+		}
+		catch (...) {
+			::close(fd);
+			throw;
+		}
+	}
+
+	std::size_t size = static_cast<std::size_t>(info.st_size);
+	void* data = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+	::close(fd);
+	if (data == MAP_FAILED)
+		throw std::runtime_error("Erro ao mapear arquivo: " + path);
+	::madvise(data, size, MADV_SEQUENTIAL);
+
+	try {
+		Network network = parseBuffer(static_cast<const char*>(data), size);
+		::munmap(data, size);
+		return network;
+	}
+	catch (...) {
+		::munmap(data, size);
+		throw;
+	}
+}
+
+Network NetworkParser::parseDescriptor(int fd)
+{
+	Scanner scanner(fd);
+	return parse(scanner, SIZE_MAX, MAX_RESERVED);
+}
+
+Network NetworkParser::parseBuffer(const char* data, std::size_t size)
+{
+	// Cada linha de nó ocupa ao menos quatro bytes ("1 0\n") e cada conexão, seis ("1 2 0\n").
+	Scanner scanner(data, size);
+	return parse(scanner, size / 4 + 1, size / 6 + 1);
+}
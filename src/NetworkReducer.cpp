@@ -0,0 +1,207 @@
+#include <algorithm>
+#include <unordered_map>
+#include <utility>
+
+#include "NetworkReducer.h"
+
+NetworkReducer::NetworkReducer(const Network& network) :
+	m_originalNodeCount(0), m_originalEdgeCount(0), m_source(0), m_sink(0), m_graph(reduce(network))
+{
+}
+
+NetworkReducer::Graph NetworkReducer::reduce(const Network& network)
+{
+	using NodeId = Graph::NodeId;
+
+	// Rede de fluxo original, na mesma numeração de 'ResidualGraph(const Network&)'.
+	const NodeId source = static_cast<NodeId>(network.getSourceIndex());
+	const NodeId sink = static_cast<NodeId>(network.getSinkIndex());
+	const std::size_t nodeCount = network.getSinkIndex() + 1;
+	std::vector<NodeId> tails;
+	std::vector<NodeId> heads;
+	std::vector<std::int64_t> capacities;
+	for (std::size_t e = 0; e < network.getEdgeCount(); e++) {
+		tails.push_back(static_cast<NodeId>(network.getEdgeSource(e)));
+		heads.push_back(static_cast<NodeId>(network.getEdgeTarget(e)));
+		capacities.push_back(network.getEdgeCapacity(e));
+	}
+	for (std::size_t generator : network.getGenerators()) {
+		tails.push_back(source);
+		heads.push_back(static_cast<NodeId>(generator));
+		capacities.push_back(network.getSupplyLimit(generator));
+	}
+	for (std::size_t index = 1; index <= network.getNodeCount(); index++) {
+		if (network.getDemand(index) > 0) {
+			tails.push_back(static_cast<NodeId>(index));
+			heads.push_back(sink);
+			capacities.push_back(network.getDemand(index));
+		}
+	}
+	m_originalNodeCount = nodeCount;
+	m_originalEdgeCount = tails.size();
+
+	// Poda: BFS direta a partir da origem e reversa a partir do sumidouro, pelas arestas úteis.
+	auto useful = [&](std::size_t e) { return capacities[e] > 0 && tails[e] != heads[e]; };
+	std::vector<std::vector<std::size_t>> outgoing(nodeCount), incoming(nodeCount);
+	for (std::size_t e = 0; e < tails.size(); e++) {
+		if (useful(e)) {
+			outgoing[tails[e]].push_back(e);
+			incoming[heads[e]].push_back(e);
+		}
+	}
+	auto reach = [&](NodeId start, const std::vector<std::vector<std::size_t>>& adjacency, const std::vector<NodeId>& ends) {
+		std::vector<std::uint8_t> reached(nodeCount, 0);
+		std::vector<NodeId> queue = { start };
+		reached[start] = 1;
+		for (std::size_t i = 0; i < queue.size(); i++) {
+			for (std::size_t e : adjacency[queue[i]]) {
+				if (!reached[ends[e]]) {
+					reached[ends[e]] = 1;
+					queue.push_back(ends[e]);
+				}
+			}
+		}
+		return reached;
+	};
+	std::vector<std::uint8_t> alive = reach(source, outgoing, heads);
+	std::vector<std::uint8_t> reachesSink = reach(sink, incoming, tails);
+	for (std::size_t v = 0; v < nodeCount; v++)
+		alive[v] = alive[v] && reachesSink[v];
+	alive[source] = alive[sink] = 1;
+	outgoing.assign(nodeCount, {});
+	incoming.assign(nodeCount, {});
+
+	// Itens vivos, com no máximo um por par (origem, destino).
+	std::vector<std::uint8_t> live;
+	std::unordered_map<std::uint64_t, std::size_t> byEndpoints;
+	std::vector<std::uint32_t> inDegree(nodeCount, 0), outDegree(nodeCount, 0);
+	auto key = [&](const Item& item) { return static_cast<std::uint64_t>(item.tail) * nodeCount + item.head; };
+	auto create = [&](Item item) {
+		m_items.push_back(std::move(item));
+		live.push_back(1);
+		return m_items.size() - 1;
+	};
+	auto insert = [&](Item item) {
+		std::size_t id = create(std::move(item));
+		Item& added = m_items[id];
+		auto [position, inserted] = byEndpoints.emplace(key(added), id);
+		if (inserted) {
+			outgoing[added.tail].push_back(id);
+			incoming[added.head].push_back(id);
+			outDegree[added.tail]++;
+			inDegree[added.head]++;
+			return;
+		}
+
+		std::size_t existing = position->second;
+		if (m_items[existing].kind == Item::Kind::Parallel) {
+			m_items[existing].children.push_back(id);
+			m_items[existing].capacity += m_items[id].capacity;
+			live[id] = 0;
+			return;
+		}
+		Item group{ Item::Kind::Parallel, m_items[id].tail, m_items[id].head,
+			m_items[existing].capacity + m_items[id].capacity, 0, { existing, id } };
+		std::size_t groupId = create(std::move(group));
+		live[existing] = live[id] = 0;
+		position->second = groupId;
+		outgoing[m_items[groupId].tail].push_back(groupId);
+		incoming[m_items[groupId].head].push_back(groupId);
+	};
+	auto remove = [&](std::size_t id) {
+		live[id] = 0;
+		byEndpoints.erase(key(m_items[id]));
+		outDegree[m_items[id].tail]--;
+		inDegree[m_items[id].head]--;
+	};
+	auto firstLive = [&](const std::vector<std::size_t>& ids) {
+		return *std::find_if(ids.begin(), ids.end(), [&](std::size_t id) { return live[id]; });
+	};
+
+	for (std::size_t e = 0; e < tails.size(); e++)
+		if (useful(e) && alive[tails[e]] && alive[heads[e]])
+			insert({ Item::Kind::Edge, tails[e], heads[e], capacities[e], e, {} });
+
+	// Contração das cadeias: cada nó com uma entrada e uma saída some, e as vizinhanças são revistas.
+	auto contractible = [&](NodeId v) {
+		return v != source && v != sink && alive[v] && inDegree[v] == 1 && outDegree[v] == 1;
+	};
+	std::vector<NodeId> pending;
+	for (NodeId v = 0; v < nodeCount; v++)
+		if (contractible(v))
+			pending.push_back(v);
+	while (!pending.empty()) {
+		NodeId v = pending.back();
+		pending.pop_back();
+		if (!contractible(v))
+			continue;
+
+		std::size_t in = firstLive(incoming[v]);
+		std::size_t out = firstLive(outgoing[v]);
+		remove(in);
+		remove(out);
+		alive[v] = 0;
+		NodeId u = m_items[in].tail;
+		NodeId w = m_items[out].head;
+		// Um laço u -> v -> u não leva fluxo em um fluxo máximo sem ciclos e é descartado.
+		if (u != w)
+			insert({ Item::Kind::Series, u, w, std::min(m_items[in].capacity, m_items[out].capacity), 0, { in, out } });
+		pending.push_back(u);
+		pending.push_back(w);
+	}
+
+	// Numeração densa dos nós que sobraram.
+	std::vector<NodeId> dense(nodeCount, 0);
+	NodeId reducedNodes = 0;
+	for (NodeId v = 0; v < nodeCount; v++)
+		if (alive[v])
+			dense[v] = reducedNodes++;
+	m_source = dense[source];
+	m_sink = dense[sink];
+
+	std::vector<NodeId> reducedTails;
+	std::vector<NodeId> reducedHeads;
+	std::vector<std::int64_t> reducedCapacities;
+	for (std::size_t id = 0; id < m_items.size(); id++) {
+		if (live[id]) {
+			m_reducedItems.push_back(id);
+			reducedTails.push_back(dense[m_items[id].tail]);
+			reducedHeads.push_back(dense[m_items[id].head]);
+			reducedCapacities.push_back(m_items[id].capacity);
+		}
+	}
+	return Graph(reducedNodes, reducedTails, reducedHeads, reducedCapacities);
+}
+
+std::vector<int> NetworkReducer::expandFlows() const
+{
+	std::vector<int> flows(m_originalEdgeCount, 0);
+	std::vector<std::pair<std::size_t, std::int64_t>> stack;
+	for (std::size_t r = 0; r < m_reducedItems.size(); r++)
+		if (m_graph.getEdgeFlow(r) > 0)
+			stack.emplace_back(m_reducedItems[r], m_graph.getEdgeFlow(r));
+
+	while (!stack.empty()) {
+		auto [id, flow] = stack.back();
+		stack.pop_back();
+		const Item& item = m_items[id];
+		switch (item.kind) {
+		case Item::Kind::Edge:
+			flows[item.edge] = static_cast<int>(flow);
+			break;
+		case Item::Kind::Series:
+			for (std::size_t child : item.children)
+				stack.emplace_back(child, flow);
+			break;
+		case Item::Kind::Parallel:
+			for (std::size_t child : item.children) {
+				std::int64_t share = std::min(flow, m_items[child].capacity);
+				if (share > 0)
+					stack.emplace_back(child, share);
+				flow -= share;
+			}
+			break;
+		}
+	}
+	return flows;
+}
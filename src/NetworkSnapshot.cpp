@@ -0,0 +1,258 @@
+#include <climits>
+#include <cstring>
+#include <fstream>
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "NetworkSnapshot.h"
+
+namespace {
+	constexpr char MAGIC[8] = { 'M', 'M', 'X', 'S', 'N', 'A', 'P', '\0' };
+
+	/**
+	 * \brief Valor gravado em 'Header::byteOrder'; lido com a ordem de bytes oposta, vira 0x04030201.
+	 */
+	constexpr std::uint32_t BYTE_ORDER_MARK = 0x01020304;
+
+	/**
+	 * \brief Bit de 'Header::flags' que indica a presença da seção de fluxos.
+	 */
+	constexpr std::uint32_t HAS_FLOW = 1;
+
+	/**
+	 * \struct Header
+	 * \brief Cabeçalho do arquivo, com 64 bytes.
+	 */
+	struct Header {
+		char magic[8];
+		std::uint32_t version;
+		std::uint32_t flags;
+		std::uint32_t byteOrder;
+		std::uint32_t reserved;
+		std::uint64_t nodeCount;
+		std::uint64_t edgeCount;
+		std::uint64_t generatorCount;
+		std::uint64_t flowCount;
+		std::int64_t maxFlow;
+	};
+	static_assert(sizeof(Header) == 64);
+
+	/**
+	 * \brief Arredonda 'offset' para o próximo múltiplo de 8.
+	 */
+	std::uint64_t align(std::uint64_t offset) { return (offset + 7) & ~std::uint64_t(7); }
+
+	/**
+	 * \struct Mapping
+	 * \brief Arquivo mapeado em memória, desfeito quando a última rede que o usa é destruída.
+	 */
+	struct Mapping {
+		void* data;
+		std::size_t size;
+
+		Mapping(void* data, std::size_t size) : data(data), size(size) {}
+		Mapping(const Mapping&) = delete;
+		Mapping& operator=(const Mapping&) = delete;
+		~Mapping() { ::munmap(data, size); }
+	};
+
+	/**
+	 * \brief Grava um vetor e completa com zeros até o próximo múltiplo de 8 bytes.
+	 */
+	template <typename T>
+	void writeSection(std::ofstream& out, std::span<const T> values) {
+		static const char padding[8] = {};
+		std::uint64_t size = values.size() * sizeof(T);
+		out.write(reinterpret_cast<const char*>(values.data()), static_cast<std::streamsize>(size));
+		out.write(padding, static_cast<std::streamsize>(align(size) - size));
+	}
+
+	/**
+	 * \brief Enxerga 'count' valores do arquivo mapeado a partir de 'offset'.
+	 */
+	template <typename T>
+	std::span<const T> section(const char* bytes, std::uint64_t offset, std::uint64_t count) {
+		return std::span<const T>(reinterpret_cast<const T*>(bytes + offset), static_cast<std::size_t>(count));
+	}
+}
+
+void NetworkSnapshot::write(const std::string& path, const Network& network, const ResidualGraph* flow, int maxFlow)
+{
+	if (network.hasEdgeCosts())
+		throw std::runtime_error("o snapshot não guarda o custo das conexões: " + path);
+	if (network.hasSupplyLimits() || network.hasLowerBounds())
+		throw std::runtime_error("o snapshot não guarda limites de geração nem limites mínimos: " + path);
+
+	std::vector<int> flows;
+	if (flow) {
+		flows.resize(flow->getEdgeCount());
+		for (std::size_t e = 0; e < flows.size(); e++)
+			flows[e] = flow->getEdgeFlow(e);
+	}
+
+	Header header = {};
+	std::memcpy(header.magic, MAGIC, sizeof(MAGIC));
+	header.version = VERSION;
+	header.flags = flow ? HAS_FLOW : 0;
+	header.byteOrder = BYTE_ORDER_MARK;
+	header.nodeCount = network.getNodeCount();
+	header.edgeCount = network.getEdgeCount();
+	header.generatorCount = network.getGenerators().size();
+	header.flowCount = flows.size();
+	header.maxFlow = flow ? maxFlow : 0;
+
+	std::ofstream out(path, std::ios::binary | std::ios::trunc);
+	if (!out)
+		throw std::runtime_error("Erro ao criar arquivo: " + path);
+
+	out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+	writeSection(out, network.getDemands());
+	writeSection(out, network.getGenerators());
+	writeSection(out, network.getEdgeSources());
+	writeSection(out, network.getEdgeTargets());
+	writeSection(out, network.getEdgeCapacities());
+	writeSection(out, std::span<const int>(flows));
+
+	out.close();
+	if (!out)
+		throw std::runtime_error("Erro ao gravar arquivo: " + path);
+}
+
+bool NetworkSnapshot::isSnapshot(const std::string& path)
+{
+	char magic[sizeof(MAGIC)];
+	std::ifstream in(path, std::ios::binary);
+	return in.read(magic, sizeof(magic)) && std::memcmp(magic, MAGIC, sizeof(MAGIC)) == 0;
+}
+
+NetworkSnapshot NetworkSnapshot::load(const std::string& path)
+{
+	int fd = ::open(path.c_str(), O_RDONLY);
+	if (fd < 0)
+		throw std::runtime_error("Erro ao abrir arquivo: " + path);
+
+	struct stat info;
+	if (::fstat(fd, &info) < 0 || !S_ISREG(info.st_mode) || static_cast<std::size_t>(info.st_size) < sizeof(Header)) {
+		::close(fd);
+		throw std::runtime_error("snapshot truncado: " + path);
+	}
+
+	std::size_t size = static_cast<std::size_t>(info.st_size);
+	void* data = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+	::close(fd);
+	if (data == MAP_FAILED)
+		throw std::runtime_error("Erro ao mapear arquivo: " + path);
+	auto mapping = std::make_shared<Mapping>(data, size);
+
+	const char* bytes = static_cast<const char*>(data);
+	const Header& header = *reinterpret_cast<const Header*>(bytes);
+	if (std::memcmp(header.magic, MAGIC, sizeof(MAGIC)) != 0)
+		throw std::runtime_error("arquivo não é um snapshot: " + path);
+	if (header.byteOrder != BYTE_ORDER_MARK)
+		throw std::runtime_error("snapshot gravado com outra ordem de bytes: " + path);
+	if (header.version != VERSION)
+		throw std::runtime_error("versão " + std::to_string(header.version) + " do snapshot não suportada: " + path);
+
+	// Cada contagem é limitada pelo tamanho do arquivo antes de calcular os deslocamentos,
+	// para que um cabeçalho adulterado não cause estouro na soma.
+	std::uint64_t limit = size / sizeof(std::uint32_t);
+	bool hasFlow = (header.flags & HAS_FLOW) != 0;
+	if (header.nodeCount == 0 || header.nodeCount > limit || header.edgeCount > limit
+		|| header.generatorCount > header.nodeCount || header.flowCount > limit || (!hasFlow && header.flowCount != 0)
+		|| header.maxFlow < 0 || header.maxFlow > INT_MAX)
+		throw std::runtime_error("snapshot com cabeçalho inválido: " + path);
+
+	std::uint64_t demandsOffset = sizeof(Header);
+	std::uint64_t generatorsOffset = align(demandsOffset + (header.nodeCount + 2) * sizeof(int));
+	std::uint64_t sourcesOffset = align(generatorsOffset + header.generatorCount * sizeof(std::uint32_t));
+	std::uint64_t targetsOffset = align(sourcesOffset + header.edgeCount * sizeof(std::uint32_t));
+	std::uint64_t capacitiesOffset = align(targetsOffset + header.edgeCount * sizeof(std::uint32_t));
+	std::uint64_t flowsOffset = align(capacitiesOffset + header.edgeCount * sizeof(int));
+	std::uint64_t endOffset = align(flowsOffset + header.flowCount * sizeof(int));
+	if (endOffset > size)
+		throw std::runtime_error("snapshot truncado: " + path);
+
+	NetworkSnapshot snapshot;
+	snapshot.m_hasFlow = hasFlow;
+	snapshot.m_maxFlow = static_cast<int>(header.maxFlow);
+	snapshot.m_flows = section<int>(bytes, flowsOffset, header.flowCount);
+	snapshot.m_network = Network(mapping,
+		section<int>(bytes, demandsOffset, header.nodeCount + 2),
+		section<std::uint32_t>(bytes, generatorsOffset, header.generatorCount),
+		section<std::uint32_t>(bytes, sourcesOffset, header.edgeCount),
+		section<std::uint32_t>(bytes, targetsOffset, header.edgeCount),
+		section<int>(bytes, capacitiesOffset, header.edgeCount));
+	return snapshot;
+}
+
+void NetworkSnapshot::validate() const
+{
+	const Network& network = m_network;
+	const std::size_t v = network.getNodeCount();
+	auto fail = [](const std::string& field, long long value, long long minimum, long long maximum) {
+		throw std::runtime_error("snapshot inválido: " + field + " " + std::to_string(value) + " fora do intervalo "
+			+ std::to_string(minimum) + ".." + std::to_string(maximum));
+	};
+
+	for (std::size_t index = 1; index <= v; index++)
+		if (network.getDemand(index) < 0)
+			fail("tipo", network.getDemand(index), 0, INT_MAX);
+	for (std::size_t generator : network.getGenerators()) {
+		if (generator < 1 || generator > v)
+			fail("índice", static_cast<long long>(generator), 1, static_cast<long long>(v));
+		if (network.getDemand(generator) != 0)
+			throw std::runtime_error("snapshot inválido: o gerador " + std::to_string(generator) + " tem demanda");
+	}
+	for (std::size_t e = 0; e < network.getEdgeCount(); e++) {
+		if (network.getEdgeSource(e) < 1 || network.getEdgeSource(e) > v)
+			fail("origem", static_cast<long long>(network.getEdgeSource(e)), 1, static_cast<long long>(v));
+		if (network.getEdgeTarget(e) < 1 || network.getEdgeTarget(e) > v)
+			fail("destino", static_cast<long long>(network.getEdgeTarget(e)), 1, static_cast<long long>(v));
+		if (network.getEdgeCapacity(e) < 0)
+			fail("capacidade", network.getEdgeCapacity(e), 0, INT_MAX);
+	}
+	if (!m_hasFlow)
+		return;
+
+	// O fluxo segue a numeração de 'ResidualGraph(const Network&)': as conexões, as arestas da
+	// super origem para cada gerador e as de cada consumidor para o super sumidouro.
+	std::size_t consumers = 0;
+	for (std::size_t index = 1; index <= v; index++)
+		if (network.getDemand(index) > 0)
+			consumers++;
+	std::size_t edgeCount = network.getEdgeCount() + network.getGenerators().size() + consumers;
+	if (m_flows.size() != edgeCount)
+		throw std::runtime_error("snapshot inválido: " + std::to_string(m_flows.size()) + " fluxos para "
+			+ std::to_string(edgeCount) + " arestas");
+
+	std::vector<std::int64_t> balance(v + 2, 0);
+	std::size_t edge = 0;
+	auto addFlow = [&](std::size_t tail, std::size_t head, int capacity) {
+		int flow = m_flows[edge++];
+		if (flow < 0 || flow > capacity)
+			fail("fluxo", flow, 0, capacity);
+		balance[tail] -= flow;
+		balance[head] += flow;
+	};
+	for (std::size_t e = 0; e < network.getEdgeCount(); e++)
+		addFlow(network.getEdgeSource(e), network.getEdgeTarget(e), network.getEdgeCapacity(e));
+	for (std::size_t generator : network.getGenerators())
+		addFlow(network.getSourceIndex(), generator, INT_MAX);
+	for (std::size_t index = 1; index <= v; index++)
+		if (network.getDemand(index) > 0)
+			addFlow(index, network.getSinkIndex(), network.getDemand(index));
+
+	for (std::size_t index = 1; index <= v; index++)
+		if (balance[index] != 0)
+			throw std::runtime_error("snapshot inválido: o fluxo não se conserva no nó " + std::to_string(index)
+				+ " (saldo " + std::to_string(balance[index]) + ")");
+	if (balance[network.getSinkIndex()] != m_maxFlow)
+		throw std::runtime_error("snapshot inválido: fluxo máximo " + std::to_string(m_maxFlow)
+			+ " diferente do fluxo que chega ao sumidouro, " + std::to_string(balance[network.getSinkIndex()]));
+}
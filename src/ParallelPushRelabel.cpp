@@ -0,0 +1,331 @@
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <vector>
+
+#include "Algorithms.h"
+#include "Profiler.h"
+#include "ThreadPool.h"
+
+using NodeId = ResidualGraph::NodeId;
+using ArcId = ResidualGraph::ArcId;
+
+namespace {
+	/**
+	 * \brief Número de nós de cada tarefa entregue ao 'ThreadPool'.
+	 */
+	constexpr std::size_t BLOCK_SIZE = 256;
+
+	/**
+	 * \brief Custo, em varreduras de arco, atribuído a cada reetiquetagem.
+	 */
+	constexpr std::size_t RELABEL_WORK = 12;
+
+	/**
+	 * \brief A reetiquetagem global é refeita após 'GLOBAL_RELABEL_FACTOR * V + E' unidades de trabalho.
+	 */
+	constexpr std::size_t GLOBAL_RELABEL_FACTOR = 6;
+
+	/**
+	 * \class SynchronousPushRelabel
+	 * \brief Estado do push-relabel paralelo síncrono.
+	 *
+	 * \details O algoritmo avança em rodadas sobre o conjunto de nós ativos, cada uma com duas
+	 *          passadas paralelas separadas por uma barreira ('ThreadPool::parallelFor'):
+	 *
+	 *          1. Empurrar: cada nó ativo envia seu excesso pelos arcos admissíveis
+	 *             (altura(v) == altura(w) + 1), usando as alturas do início da rodada. Como um par de
+	 *             arcos só é admissível em um dos sentidos, nenhum outro nó altera as capacidades
+	 *             residuais que o nó lê ou escreve; apenas o excesso recebido pelos vizinhos é
+	 *             acumulado com uma soma atômica.
+	 *          2. Reetiquetar: os nós que ficaram com excesso sem arco admissível recebem a menor
+	 *             altura válida, calculada com as alturas antigas dos vizinhos e gravada em um vetor
+	 *             separado, de modo que o resultado não depende da ordem entre as threads.
+	 *
+	 *          A reetiquetagem global é uma BFS paralela por níveis. A primeira fase (alturas até o
+	 *          sumidouro) calcula o pré-fluxo máximo; a segunda repete as rodadas com a origem como
+	 *          destino, devolvendo o excesso restante e deixando um fluxo válido na rede.
+	 */
+	template <typename Capacity>
+	class SynchronousPushRelabel {
+		using Traits = CapacityTraits<Capacity>;
+		using Sum = typename Traits::Sum;
+
+	public:
+		SynchronousPushRelabel(BasicResidualGraph<Capacity>& network, NodeId source, NodeId sink, ThreadPool& pool) :
+			m_network(network), m_source(source), m_sink(sink), m_pool(pool),
+			m_nodeCount(static_cast<NodeId>(network.getNodeCount())),
+			m_label(m_nodeCount), m_newLabel(m_nodeCount), m_excess(m_nodeCount, 0),
+			m_incoming(m_nodeCount), m_claimed(m_nodeCount), m_blocked(m_nodeCount, 0),
+			m_localNodes(pool.getThreadCount()), m_localWork(pool.getThreadCount()), m_stamp(0) {}
+
+		/**
+		 * \brief Executa as duas fases e retorna o fluxo que chegou ao sumidouro.
+		 */
+		Capacity run() {
+			for (ArcId arc = m_network.begin(m_source); arc < m_network.end(m_source); arc++) {
+				Capacity residual = m_network.getSaturatingAmount(arc);
+				if (Traits::positive(residual)) {
+					m_network.push(arc, residual);
+					m_excess[m_network.getHead(arc)] += residual;
+				}
+			}
+
+			discharge(m_sink, m_source);
+			Capacity maxFlow = Traits::fromSum(m_excess[m_sink]);
+			discharge(m_source, m_sink);
+			return maxFlow;
+		}
+
+	private:
+		/**
+		 * \brief Executa 'task(node, thread)' em paralelo para cada nó de 'nodes'.
+		 */
+		template <typename Task>
+		void forEach(const std::vector<NodeId>& nodes, Task task) {
+			std::size_t blocks = (nodes.size() + BLOCK_SIZE - 1) / BLOCK_SIZE;
+			m_pool.parallelFor(blocks, [&](std::size_t block, std::size_t thread) {
+				std::size_t end = std::min(nodes.size(), (block + 1) * BLOCK_SIZE);
+				for (std::size_t i = block * BLOCK_SIZE; i < end; i++)
+					task(nodes[i], thread);
+			});
+		}
+
+		/**
+		 * \brief Executa 'task(node, thread)' em paralelo para cada nó da rede.
+		 */
+		template <typename Task>
+		void forEachNode(Task task) {
+			std::size_t blocks = (m_nodeCount + BLOCK_SIZE - 1) / BLOCK_SIZE;
+			m_pool.parallelFor(blocks, [&](std::size_t block, std::size_t thread) {
+				NodeId end = static_cast<NodeId>(std::min<std::size_t>(m_nodeCount, (block + 1) * BLOCK_SIZE));
+				for (NodeId v = static_cast<NodeId>(block * BLOCK_SIZE); v < end; v++)
+					task(v, thread);
+			});
+		}
+
+		/**
+		 * \brief Marca 'v' como incluído na lista da passada atual; retorna falso se já estava.
+		 */
+		bool claim(NodeId v) {
+			return m_claimed[v].exchange(m_stamp, std::memory_order_relaxed) != m_stamp;
+		}
+
+		/**
+		 * \brief Junta as listas locais das threads em 'nodes'.
+		 */
+		void gather(std::vector<NodeId>& nodes) {
+			nodes.clear();
+			for (std::vector<NodeId>& local : m_localNodes) {
+				nodes.insert(nodes.end(), local.begin(), local.end());
+				local.clear();
+			}
+		}
+
+		/**
+		 * \brief Recalcula as alturas como a distância até 'target' no grafo residual (BFS paralela).
+		 *
+		 * \details Nós que não alcançam 'target', e o nó 'excluded', recebem altura V. Ao final
+		 *          'm_active' contém os nós com excesso e altura menor que V.
+		 */
+		void globalRelabel(NodeId target, NodeId excluded) {
+			Profiler::count(Profiler::Counter::GlobalRelabels);
+			m_stamp++;
+			forEachNode([&](NodeId v, std::size_t) { m_label[v] = m_nodeCount; });
+			claim(target);
+			claim(excluded);
+			m_label[target] = 0;
+
+			std::vector<NodeId> frontier = { target };
+			for (NodeId level = 1; !frontier.empty(); level++) {
+				forEach(frontier, [&](NodeId w, std::size_t thread) {
+					for (ArcId arc = m_network.begin(w); arc < m_network.end(w); arc++) {
+						NodeId u = m_network.getHead(arc);
+						if (Traits::positive(m_network.getResidual(m_network.getReverse(arc))) && claim(u)) {
+							m_label[u] = level;
+							m_localNodes[thread].push_back(u);
+						}
+					}
+				});
+				gather(frontier);
+			}
+
+			forEachNode([&](NodeId v, std::size_t thread) {
+				if (Traits::positive(m_excess[v]) && v != target && v != excluded && m_label[v] < m_nodeCount)
+					m_localNodes[thread].push_back(v);
+			});
+			gather(m_active);
+		}
+
+		/**
+		 * \brief Envia o excesso de 'v' pelos arcos admissíveis.
+		 */
+		void push(NodeId v, std::size_t thread) {
+			Sum excess = m_excess[v];
+			NodeId label = m_label[v];
+			for (ArcId arc = m_network.begin(v); arc < m_network.end(v) && Traits::positive(excess); arc++) {
+				// A altura é verificada antes da capacidade residual: se o arco é admissível, o
+				// vizinho não pode empurrar pelo arco par nesta rodada.
+				NodeId w = m_network.getHead(arc);
+				if (m_label[w] + 1 != label || !Traits::positive(m_network.getResidual(arc)))
+					continue;
+
+				Capacity amount = static_cast<Capacity>(std::min<Sum>(excess, m_network.getResidual(arc)));
+				m_network.push(arc, amount);
+				excess -= amount;
+				Profiler::count(Profiler::Counter::Pushes);
+				m_incoming[w].fetch_add(amount, std::memory_order_relaxed);
+				if (claim(w))
+					m_localNodes[thread].push_back(w);
+			}
+			m_excess[v] = excess;
+
+			m_blocked[v] = Traits::positive(excess);
+			if (m_blocked[v] && claim(v))
+				m_localNodes[thread].push_back(v);
+		}
+
+		/**
+		 * \brief Calcula em 'm_newLabel' a menor altura válida de 'v', sem alterar 'm_label'.
+		 */
+		void relabel(NodeId v, std::size_t thread) {
+			Profiler::count(Profiler::Counter::Relabels);
+			NodeId label = m_nodeCount;
+			for (ArcId arc = m_network.begin(v); arc < m_network.end(v); arc++)
+				if (Traits::positive(m_network.getResidual(arc)))
+					label = std::min(label, m_label[m_network.getHead(arc)] + 1);
+			m_newLabel[v] = label;
+			m_localWork[thread] += m_network.end(v) - m_network.begin(v) + RELABEL_WORK;
+		}
+
+		/**
+		 * \brief Processa rodadas até que nenhum nó com altura menor que V tenha excesso.
+		 * \param target O nó que absorve o excesso (sumidouro na primeira fase, origem na segunda).
+		 * \param excluded O nó que não participa da fase.
+		 */
+		void discharge(NodeId target, NodeId excluded) {
+			globalRelabel(target, excluded);
+			std::fill(m_localWork.begin(), m_localWork.end(), 0);
+
+			std::vector<NodeId> touched;
+			while (!m_active.empty()) {
+				m_stamp++;
+				claim(target);
+				claim(excluded);
+				forEach(m_active, [&](NodeId v, std::size_t thread) { push(v, thread); });
+				gather(touched);
+
+				forEach(touched, [&](NodeId v, std::size_t thread) {
+					m_excess[v] += m_incoming[v].exchange(0, std::memory_order_relaxed);
+					if (m_blocked[v])
+						relabel(v, thread);
+				});
+				forEach(touched, [&](NodeId v, std::size_t thread) {
+					if (m_blocked[v]) {
+						m_label[v] = m_newLabel[v];
+						m_blocked[v] = 0;
+					}
+					if (m_label[v] < m_nodeCount)
+						m_localNodes[thread].push_back(v);
+				});
+				gather(m_active);
+
+				// O excesso enviado ao destino é somado fora das listas, que nunca o incluem. O
+				// devolvido à origem não é acumulado: com arestas infinitas ele poderia estourar
+				// 'Sum', e nunca é lido.
+				Sum arrived = m_incoming[target].exchange(0, std::memory_order_relaxed);
+				if (target != m_source)
+					m_excess[target] += arrived;
+
+				std::size_t work = 0;
+				for (std::size_t local : m_localWork)
+					work += local;
+				if (work > GLOBAL_RELABEL_FACTOR * m_nodeCount + m_network.getArcCount() / 2) {
+					globalRelabel(target, excluded);
+					std::fill(m_localWork.begin(), m_localWork.end(), 0);
+				}
+			}
+		}
+
+		BasicResidualGraph<Capacity>& m_network;
+		NodeId m_source;
+		NodeId m_sink;
+		ThreadPool& m_pool;
+		NodeId m_nodeCount;
+
+		/**
+		 * \brief Altura de cada nó no início da rodada.
+		 */
+		std::vector<NodeId> m_label;
+
+		/**
+		 * \brief Altura calculada na passada de reetiquetagem, copiada para 'm_label' ao seu fim.
+		 */
+		std::vector<NodeId> m_newLabel;
+
+		std::vector<Sum> m_excess;
+
+		/**
+		 * \brief Excesso recebido na rodada atual, somado a 'm_excess' na passada seguinte.
+		 */
+		std::vector<std::atomic<Sum>> m_incoming;
+
+		/**
+		 * \brief Valor de 'm_stamp' da última passada que incluiu o nó em uma lista.
+		 */
+		std::vector<std::atomic<std::uint32_t>> m_claimed;
+
+		/**
+		 * \brief Indica que o nó terminou a passada de envio com excesso e precisa ser reetiquetado.
+		 */
+		std::vector<std::uint8_t> m_blocked;
+
+		/**
+		 * \brief Nós ativos da rodada atual.
+		 */
+		std::vector<NodeId> m_active;
+
+		/**
+		 * \brief Listas e contadores de trabalho de cada thread, juntados após cada passada.
+		 */
+		std::vector<std::vector<NodeId>> m_localNodes;
+		std::vector<std::size_t> m_localWork;
+
+		std::uint32_t m_stamp;
+	};
+}
+
+int Algorithms::ParallelPushRelabel(Graph* graph, GraphNode* source, GraphNode* sink, std::size_t threadCount)
+{
+	ResidualGraph network(graph);
+	int maxFlow = ParallelPushRelabel(network,
+		network.getNodeId(source->getIndex()),
+		network.getNodeId(sink->getIndex()),
+		threadCount);
+	network.writeBack();
+	return maxFlow;
+}
+
+template <typename Capacity>
+Capacity Algorithms::ParallelPushRelabel(BasicResidualGraph<Capacity>& network, NodeId source, NodeId sink, std::size_t threadCount)
+{
+	ThreadPool pool(threadCount);
+	return ParallelPushRelabel(network, source, sink, pool);
+}
+
+template <typename Capacity>
+Capacity Algorithms::ParallelPushRelabel(BasicResidualGraph<Capacity>& network, NodeId source, NodeId sink, ThreadPool& pool)
+{
+	if (source == sink)
+		return 0;
+
+	SynchronousPushRelabel<Capacity> solver(network, source, sink, pool);
+	return solver.run();
+}
+
+template int Algorithms::ParallelPushRelabel<int>(BasicResidualGraph<int>&, NodeId, NodeId, std::size_t);
+template std::int64_t Algorithms::ParallelPushRelabel<std::int64_t>(BasicResidualGraph<std::int64_t>&, NodeId, NodeId, std::size_t);
+template double Algorithms::ParallelPushRelabel<double>(BasicResidualGraph<double>&, NodeId, NodeId, std::size_t);
+template int Algorithms::ParallelPushRelabel<int>(BasicResidualGraph<int>&, NodeId, NodeId, ThreadPool&);
+template std::int64_t Algorithms::ParallelPushRelabel<std::int64_t>(BasicResidualGraph<std::int64_t>&, NodeId, NodeId, ThreadPool&);
+template double Algorithms::ParallelPushRelabel<double>(BasicResidualGraph<double>&, NodeId, NodeId, ThreadPool&);
@@ -0,0 +1,296 @@
+#include <algorithm>
+#include <charconv>
+#include <cmath>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+#include "Algorithms.h"
+#include "ParametricMaxFlow.h"
+
+namespace {
+	/**
+	 * \brief Lê um número real que ocupa todo o texto.
+	 */
+	double parseNumber(const std::string& text, std::size_t begin, std::size_t end) {
+		double value = 0;
+		auto [last, error] = std::from_chars(text.data() + begin, text.data() + end, value);
+		if (begin == end || error != std::errc() || last != text.data() + end || !std::isfinite(value))
+			throw std::runtime_error("fator inválido: '" + text.substr(begin, end - begin) + "'");
+		return value;
+	}
+}
+
+ParametricMaxFlow::ParametricMaxFlow(const Network& network, MaxFlowAlgorithm algorithm) :
+	m_graph(network), m_algorithm(std::move(algorithm)),
+	m_source(static_cast<Graph::NodeId>(network.getSourceIndex())),
+	m_sink(static_cast<Graph::NodeId>(network.getSinkIndex())),
+	m_nodeDemands(m_graph.getNodeCount(), 0), m_lambda(0), m_maxFlow(0)
+{
+	// As arestas do super sumidouro são as últimas, na ordem dos consumidores.
+	std::size_t edge = network.getEdgeCount() + network.getGenerators().size();
+	for (std::size_t index = 1; index <= network.getNodeCount(); index++) {
+		if (network.getDemand(index) > 0) {
+			m_sinkEdges.push_back(edge);
+			m_demands.push_back(network.getDemand(index));
+			m_nodeDemands[index] = network.getDemand(index);
+			m_graph.setCapacity(m_graph.getEdgeArc(edge++), 0);
+		}
+	}
+}
+
+ParametricPoint ParametricMaxFlow::solve(double lambda)
+{
+	if (!(lambda >= 0 && lambda <= MAX_LAMBDA))
+		throw std::runtime_error("fator " + std::to_string(lambda) + " fora do intervalo 0.." + std::to_string(MAX_LAMBDA));
+	if (lambda < m_lambda)
+		throw std::runtime_error("fator " + std::to_string(lambda) + " menor que o anterior, " + std::to_string(m_lambda));
+	m_lambda = lambda;
+
+	// floor(lambda * demanda) não diminui quando 'lambda' cresce: o fluxo atual continua válido.
+	ParametricPoint point{ lambda, 0, 0, 0, 0 };
+	for (std::size_t i = 0; i < m_sinkEdges.size(); i++) {
+		std::int64_t capacity = static_cast<std::int64_t>(std::floor(lambda * m_demands[i]));
+		m_graph.setCapacity(m_graph.getEdgeArc(m_sinkEdges[i]), capacity);
+		point.demand += capacity;
+	}
+	m_maxFlow += m_algorithm(m_graph, m_source, m_sink);
+	point.maxFlow = m_maxFlow;
+
+	CutLine cut = cutLine(Algorithms::MinCutSourceSide(m_graph, m_source));
+	point.cutConstant = cut.constant;
+	point.cutSlope = cut.slope;
+	return point;
+}
+
+std::vector<ParametricPoint> ParametricMaxFlow::sweep(std::vector<double> lambdas)
+{
+	std::sort(lambdas.begin(), lambdas.end());
+	std::vector<ParametricPoint> points;
+	points.reserve(lambdas.size());
+	for (double lambda : lambdas)
+		points.push_back(solve(lambda));
+	return points;
+}
+
+std::vector<ParametricBreakpoint> ParametricMaxFlow::breakpoints(double first, double last) const
+{
+	// Os nós ficam em 'order' do primeiro a deixar o lado da origem ao último: primeiro os que
+	// já estão do lado do sumidouro logo depois de zero, por último os que nunca saem.
+	std::vector<std::uint8_t> lowSide = minCutSide(0);
+	std::vector<std::uint8_t> highSide = minCutSide(CapacityTraits<std::int64_t>::infinity());
+	std::vector<Graph::NodeId> order;
+	order.reserve(m_graph.getNodeCount());
+	for (int group = 0; group < 3; group++)
+		for (Graph::NodeId node = 0; node < m_graph.getNodeCount(); node++)
+			if (lowSide[node] + highSide[node] == group)
+				order.push_back(node);
+	std::vector<std::size_t> positions(order.size());
+	for (std::size_t i = 0; i < order.size(); i++)
+		positions[order[i]] = i;
+
+	// Um intervalo entre dois cortes mínimos e os nós que mudam de lado entre eles,
+	// 'order[begin..end)'.
+	struct Interval {
+		CutLine left;
+		CutLine right;
+		std::size_t begin;
+		std::size_t end;
+	};
+	std::size_t lowCount = static_cast<std::size_t>(std::count(lowSide.begin(), lowSide.end(), 0));
+	std::size_t highCount = static_cast<std::size_t>(std::count(highSide.begin(), highSide.end(), 1));
+	std::vector<Interval> pending{ { cutLine(lowSide), cutLine(highSide), lowCount, order.size() - highCount } };
+
+	// Contribuição de uma aresta cortada para a reta do corte.
+	auto addArc = [this](CutLine& line, Graph::ArcId arc, std::int64_t sign) {
+		Graph::NodeId tail = m_graph.getHead(m_graph.getReverse(arc));
+		if (m_graph.getHead(arc) == m_sink)
+			line.slope += sign * m_nodeDemands[tail];
+		else
+			line.constant += sign * m_graph.getCapacity(arc);
+	};
+
+	std::vector<ParametricBreakpoint> result;
+	std::vector<Graph::NodeId> sourceNodes;
+	while (!pending.empty()) {
+		auto [left, right, begin, end] = pending.back();
+		pending.pop_back();
+		// Retas paralelas de dois cortes mínimos são a mesma: não há mudança entre elas.
+		if (left.slope == right.slope)
+			continue;
+
+		std::int64_t numerator = right.constant - left.constant;
+		std::int64_t denominator = left.slope - right.slope;
+		std::int64_t divisor = std::gcd(numerator, denominator);
+		numerator /= divisor;
+		denominator /= divisor;
+		double lambda = static_cast<double>(numerator) / static_cast<double>(denominator);
+
+		// A reta do corte no cruzamento é a de 'right' mais as arestas que saem dos nós da região
+		// que ficam do lado da origem, menos as que chegam a eles do lado da origem de 'right'.
+		std::vector<std::uint8_t> side = regionMinCut(order, positions, begin, end, numerator, denominator);
+		CutLine middle = right;
+		for (std::size_t i = begin; i < end; i++) {
+			if (!side[i - begin])
+				continue;
+			for (Graph::ArcId arc = m_graph.begin(order[i]); arc < m_graph.end(order[i]); arc++) {
+				std::size_t position = positions[m_graph.getHead(arc)];
+				if (m_graph.getEdgeId(arc) != ResidualGraph::NO_EDGE) {
+					if (position < begin || (position < end && !side[position - begin]))
+						addArc(middle, arc, 1);
+				}
+				else if (position >= end)
+					addArc(middle, m_graph.getReverse(arc), -1);
+			}
+		}
+
+		// O corte mínimo no cruzamento vale o mesmo que as duas retas exatamente quando a curva
+		// segue 'left' até ali e 'right' depois.
+		std::int64_t constantGap = 0;
+		std::int64_t slopeGap = 0;
+		if (__builtin_mul_overflow(middle.constant - left.constant, denominator, &constantGap)
+			|| __builtin_mul_overflow(left.slope - middle.slope, numerator, &slopeGap))
+			throw std::runtime_error("fator " + std::to_string(numerator) + "/" + std::to_string(denominator) + ": corte não cabe em 64 bits");
+		if (constantGap == slopeGap) {
+			if (lambda >= first && lambda <= last)
+				result.push_back({ lambda, static_cast<double>(left.constant) + static_cast<double>(left.slope) * lambda });
+			continue;
+		}
+
+		// Os nós do lado do sumidouro saem antes do cruzamento e vão para o começo da região.
+		sourceNodes.clear();
+		std::size_t split = begin;
+		for (std::size_t i = begin; i < end; i++) {
+			if (side[i - begin])
+				sourceNodes.push_back(order[i]);
+			else
+				order[split++] = order[i];
+		}
+		std::copy(sourceNodes.begin(), sourceNodes.end(), order.begin() + static_cast<std::ptrdiff_t>(split));
+		for (std::size_t i = begin; i < end; i++)
+			positions[order[i]] = i;
+
+		// A metade da esquerda sai da pilha primeiro, e as mudanças saem em ordem crescente.
+		if (lambda <= last)
+			pending.push_back({ middle, right, split, end });
+		if (lambda >= first)
+			pending.push_back({ left, middle, begin, split });
+	}
+	return result;
+}
+
+ParametricMaxFlow::CutLine ParametricMaxFlow::cutLine(const std::vector<std::uint8_t>& sourceSide) const
+{
+	CutLine cut{ 0, 0 };
+	for (std::size_t e = 0; e < m_graph.getEdgeCount(); e++) {
+		Graph::ArcId arc = m_graph.getEdgeArc(e);
+		Graph::NodeId tail = m_graph.getHead(m_graph.getReverse(arc));
+		Graph::NodeId head = m_graph.getHead(arc);
+		if (sourceSide[tail] && !sourceSide[head] && head != m_sink)
+			cut.constant += m_graph.getCapacity(arc);
+	}
+	for (std::size_t i = 0; i < m_sinkEdges.size(); i++) {
+		Graph::ArcId arc = m_graph.getEdgeArc(m_sinkEdges[i]);
+		if (sourceSide[m_graph.getHead(m_graph.getReverse(arc))])
+			cut.slope += m_demands[i];
+	}
+	return cut;
+}
+
+std::vector<std::uint8_t> ParametricMaxFlow::minCutSide(std::int64_t sinkCapacity) const
+{
+	Graph graph = m_graph;
+	graph.reset();
+	for (std::size_t edge : m_sinkEdges)
+		graph.setCapacity(graph.getEdgeArc(edge), sinkCapacity);
+	m_algorithm(graph, m_source, m_sink);
+	return Algorithms::MinCutSourceSide(graph, m_source);
+}
+
+std::vector<std::uint8_t> ParametricMaxFlow::regionMinCut(const std::vector<Graph::NodeId>& order,
+	const std::vector<std::size_t>& positions, std::size_t begin, std::size_t end,
+	std::int64_t numerator, std::int64_t denominator) const
+{
+	// Na rede contraída, 0 é a origem, 1..n são os nós da região e n + 1 é o sumidouro.
+	const Graph::NodeId source = 0;
+	const Graph::NodeId sink = static_cast<Graph::NodeId>(end - begin + 1);
+	auto local = [&](Graph::NodeId node) {
+		std::size_t position = positions[node];
+		if (position >= end)
+			return source;
+		return position < begin ? sink : static_cast<Graph::NodeId>(position - begin + 1);
+	};
+
+	// A soma das capacidades finitas fica abaixo de 'infinity', como nas redes de 'solve', para
+	// que nenhum excesso estoure e nenhuma capacidade multiplicada pareça infinita.
+	const std::int64_t infinity = CapacityTraits<std::int64_t>::infinity();
+	std::vector<Graph::NodeId> tails;
+	std::vector<Graph::NodeId> heads;
+	std::vector<std::int64_t> capacities;
+	std::int64_t total = 0;
+	bool overflow = false;
+	for (std::size_t i = begin; i < end; i++) {
+		for (Graph::ArcId arc = m_graph.begin(order[i]); arc < m_graph.end(order[i]); arc++) {
+			// Das arestas que chegam à região, só as que vêm da origem contraída ficam na rede.
+			Graph::ArcId edgeArc = arc;
+			if (m_graph.getEdgeId(arc) == ResidualGraph::NO_EDGE) {
+				edgeArc = m_graph.getReverse(arc);
+				if (local(m_graph.getHead(arc)) != source)
+					continue;
+			}
+			else if (local(m_graph.getHead(arc)) == source || m_graph.getHead(arc) == order[i])
+				continue;
+
+			Graph::NodeId tail = m_graph.getHead(m_graph.getReverse(edgeArc));
+			Graph::NodeId head = m_graph.getHead(edgeArc);
+			std::int64_t capacity = m_graph.getCapacity(edgeArc);
+			if (head == m_sink)
+				overflow = overflow || __builtin_mul_overflow(static_cast<std::int64_t>(m_nodeDemands[tail]), numerator, &capacity);
+			else if (capacity != infinity)
+				overflow = overflow || __builtin_mul_overflow(capacity, denominator, &capacity);
+			if (capacity != infinity)
+				overflow = overflow || __builtin_add_overflow(total, capacity, &total);
+			tails.push_back(local(tail));
+			heads.push_back(local(head));
+			capacities.push_back(capacity);
+		}
+	}
+	if (overflow || total >= infinity)
+		throw std::runtime_error("fator " + std::to_string(numerator) + "/" + std::to_string(denominator) + ": capacidades multiplicadas não cabem em 64 bits");
+
+	Graph graph(end - begin + 2, tails, heads, capacities);
+	m_algorithm(graph, source, sink);
+	std::vector<std::uint8_t> side = Algorithms::MinCutSourceSide(graph, source);
+	return std::vector<std::uint8_t>(side.begin() + 1, side.end() - 1);
+}
+
+std::vector<double> ParametricMaxFlow::parseLambdas(const std::string& text)
+{
+	std::vector<double> lambdas;
+	std::size_t firstColon = text.find(':');
+	if (firstColon != std::string::npos) {
+		std::size_t secondColon = text.find(':', firstColon + 1);
+		if (secondColon == std::string::npos)
+			throw std::runtime_error("intervalo sem passo: '" + text + "'");
+		double first = parseNumber(text, 0, firstColon);
+		double last = parseNumber(text, firstColon + 1, secondColon);
+		double step = parseNumber(text, secondColon + 1, text.size());
+		if (step <= 0 || last < first || (last - first) / step >= static_cast<double>(MAX_POINTS))
+			throw std::runtime_error("intervalo inválido: '" + text + "'");
+		// A tolerância inclui o fim apesar do arredondamento de 'first + i * step'.
+		std::size_t count = static_cast<std::size_t>(std::floor((last - first) / step + 1e-9)) + 1;
+		for (std::size_t i = 0; i < count; i++)
+			lambdas.push_back(std::min(last, first + static_cast<double>(i) * step));
+		return lambdas;
+	}
+
+	for (std::size_t begin = 0; begin <= text.size(); ) {
+		std::size_t end = std::min(text.find(',', begin), text.size());
+		lambdas.push_back(parseNumber(text, begin, end));
+		if (lambdas.size() > MAX_POINTS)
+			throw std::runtime_error("mais de " + std::to_string(MAX_POINTS) + " fatores");
+		begin = end + 1;
+	}
+	return lambdas;
+}
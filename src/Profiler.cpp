@@ -0,0 +1,95 @@
+#include <limits>
+
+#include "Profiler.h"
+
+namespace {
+	const char* const COUNTER_NAMES[] = { "bfs_calls", "edges_scanned", "augmenting_paths", "pushes", "relabels", "global_relabels" };
+	const char* const DISTRIBUTION_NAMES[] = { "path_length", "bottleneck" };
+
+	/**
+	 * \brief Escreve uma string JSON; os nomes de fase não têm caracteres especiais além de aspas e barras.
+	 */
+	void writeString(std::ostream& out, const std::string& text) {
+		out << '"';
+		for (char c : text) {
+			if (c == '"' || c == '\\')
+				out << '\\';
+			out << c;
+		}
+		out << '"';
+	}
+}
+
+std::array<std::atomic<std::uint64_t>, static_cast<std::size_t>(Profiler::Counter::Count)> Profiler::s_counters{};
+std::array<Profiler::Statistic, static_cast<std::size_t>(Profiler::Distribution::Count)> Profiler::s_distributions{};
+std::mutex Profiler::s_phaseMutex;
+std::vector<std::pair<std::string, double>> Profiler::s_phases;
+
+void Profiler::Statistic::add(double value)
+{
+	count.fetch_add(1, std::memory_order_relaxed);
+	sum.fetch_add(value, std::memory_order_relaxed);
+	for (double current = min.load(std::memory_order_relaxed);
+		value < current && !min.compare_exchange_weak(current, value, std::memory_order_relaxed);) {}
+	for (double current = max.load(std::memory_order_relaxed);
+		value > current && !max.compare_exchange_weak(current, value, std::memory_order_relaxed);) {}
+}
+
+void Profiler::addPhase(const std::string& name, double milliseconds)
+{
+	std::lock_guard<std::mutex> lock(s_phaseMutex);
+	for (auto& [phase, total] : s_phases) {
+		if (phase == name) {
+			total += milliseconds;
+			return;
+		}
+	}
+	s_phases.emplace_back(name, milliseconds);
+}
+
+void Profiler::reset()
+{
+	for (std::atomic<std::uint64_t>& counter : s_counters)
+		counter.store(0, std::memory_order_relaxed);
+	for (Statistic& statistic : s_distributions) {
+		statistic.count.store(0, std::memory_order_relaxed);
+		statistic.sum.store(0, std::memory_order_relaxed);
+		statistic.min.store(std::numeric_limits<double>::infinity(), std::memory_order_relaxed);
+		statistic.max.store(-std::numeric_limits<double>::infinity(), std::memory_order_relaxed);
+	}
+	std::lock_guard<std::mutex> lock(s_phaseMutex);
+	s_phases.clear();
+}
+
+void Profiler::writeJson(std::ostream& out)
+{
+	out << "{\n  \"instrumented\": " << (enabled ? "true" : "false") << ",\n  \"phases_ms\": {";
+	{
+		std::lock_guard<std::mutex> lock(s_phaseMutex);
+		for (std::size_t i = 0; i < s_phases.size(); i++) {
+			out << (i == 0 ? "\n    " : ",\n    ");
+			writeString(out, s_phases[i].first);
+			out << ": " << s_phases[i].second;
+		}
+		out << (s_phases.empty() ? "}" : "\n  }");
+	}
+
+	if constexpr (enabled) {
+		out << ",\n  \"counters\": {";
+		for (std::size_t i = 0; i < s_counters.size(); i++)
+			out << (i == 0 ? "\n    \"" : ",\n    \"") << COUNTER_NAMES[i] << "\": " << s_counters[i].load(std::memory_order_relaxed);
+		out << "\n  },\n  \"distributions\": {";
+		for (std::size_t i = 0; i < s_distributions.size(); i++) {
+			const Statistic& statistic = s_distributions[i];
+			std::uint64_t count = statistic.count.load(std::memory_order_relaxed);
+			double sum = statistic.sum.load(std::memory_order_relaxed);
+			out << (i == 0 ? "\n    \"" : ",\n    \"") << DISTRIBUTION_NAMES[i] << "\": { \"count\": " << count
+				<< ", \"sum\": " << sum
+				<< ", \"min\": " << (count ? statistic.min.load(std::memory_order_relaxed) : 0)
+				<< ", \"max\": " << (count ? statistic.max.load(std::memory_order_relaxed) : 0)
+				<< ", \"mean\": " << (count ? sum / static_cast<double>(count) : 0) << " }";
+		}
+		out << "\n  }";
+	}
+	out << "\n}\n";
+}
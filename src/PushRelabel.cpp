@@ -0,0 +1,376 @@
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+#include "Algorithms.h"
+#include "Profiler.h"
+
+using NodeId = ResidualGraph::NodeId;
+using ArcId = ResidualGraph::ArcId;
+
+namespace {
+	/**
+	 * \brief Valor usado nas listas encadeadas para indicar o fim da lista.
+	 */
+	constexpr NodeId NONE = std::numeric_limits<NodeId>::max();
+
+	/**
+	 * \brief Custo, em varreduras de arco, atribuído a cada reetiquetagem.
+	 */
+	constexpr std::size_t RELABEL_WORK = 12;
+
+	/**
+	 * \brief A reetiquetagem global é refeita após 'GLOBAL_RELABEL_FACTOR * V + E' unidades de trabalho.
+	 */
+	constexpr std::size_t GLOBAL_RELABEL_FACTOR = 6;
+
+	/**
+	 * \class HighestLabelPushRelabel
+	 * \brief Estado do algoritmo push-relabel com seleção do nó ativo de maior altura.
+	 *
+	 * \details A primeira fase calcula um pré-fluxo máximo: apenas nós com altura menor que V são
+	 *          processados, e ao seu fim o excesso do sumidouro é o valor do fluxo máximo. A segunda
+	 *          fase devolve à origem o excesso que ficou preso nos demais nós, transformando o
+	 *          pré-fluxo em um fluxo válido, de modo que as capacidades residuais da rede possam ser
+	 *          usadas nos relatórios exatamente como após o Edmonds-Karp.
+	 */
+	template <typename Capacity>
+	class HighestLabelPushRelabel {
+		using Traits = CapacityTraits<Capacity>;
+		using Sum = typename Traits::Sum;
+
+	public:
+		HighestLabelPushRelabel(BasicResidualGraph<Capacity>& network, NodeId source, NodeId sink) :
+			m_network(network), m_source(source), m_sink(sink),
+			m_nodeCount(static_cast<NodeId>(network.getNodeCount())),
+			m_height(m_nodeCount), m_excess(m_nodeCount, 0), m_current(m_nodeCount),
+			m_activeFirst(2 * static_cast<std::size_t>(m_nodeCount) + 1, NONE), m_activeNext(m_nodeCount, NONE),
+			m_bucketFirst(m_nodeCount + 1, NONE), m_bucketNext(m_nodeCount, NONE), m_bucketPrev(m_nodeCount, NONE),
+			m_maxActive(0), m_maxHeight(0), m_work(0) {}
+
+		/**
+		 * \brief Executa as duas fases e retorna o fluxo que chegou ao sumidouro.
+		 */
+		Capacity run() {
+			for (ArcId arc = m_network.begin(m_source); arc < m_network.end(m_source); arc++) {
+				Capacity residual = m_network.getSaturatingAmount(arc);
+				if (Traits::positive(residual)) {
+					m_network.push(arc, residual);
+					m_excess[m_network.getHead(arc)] += residual;
+				}
+			}
+
+			globalRelabel();
+			while (selectActive()) {
+				NodeId u = m_activeFirst[m_maxActive];
+				m_activeFirst[m_maxActive] = m_activeNext[u];
+				discharge(u);
+
+				if (m_work > GLOBAL_RELABEL_FACTOR * m_nodeCount + m_network.getArcCount() / 2) {
+					globalRelabel();
+				}
+			}
+
+			returnExcess();
+			return Traits::fromSum(m_excess[m_sink]);
+		}
+
+	private:
+		/**
+		 * \brief Recalcula as alturas como a distância exata até o sumidouro (BFS reversa).
+		 *
+		 * \details Nós que não alcançam o sumidouro recebem altura V e deixam de ser processados na
+		 *          primeira fase. As listas de nós ativos e de nós por altura são refeitas.
+		 */
+		void globalRelabel() {
+			Profiler::count(Profiler::Counter::GlobalRelabels);
+			std::fill(m_height.begin(), m_height.end(), m_nodeCount);
+			std::fill(m_activeFirst.begin(), m_activeFirst.end(), NONE);
+			std::fill(m_bucketFirst.begin(), m_bucketFirst.end(), NONE);
+			m_maxActive = 0;
+			m_maxHeight = 0;
+			m_work = 0;
+
+			m_queue.clear();
+			m_queue.push_back(m_sink);
+			m_height[m_sink] = 0;
+
+			for (std::size_t head = 0; head < m_queue.size(); head++) {
+				NodeId v = m_queue[head];
+				for (ArcId arc = m_network.begin(v); arc < m_network.end(v); arc++) {
+					NodeId u = m_network.getHead(arc);
+					if (m_height[u] == m_nodeCount && u != m_source
+						&& Traits::positive(m_network.getResidual(m_network.getReverse(arc)))) {
+						m_height[u] = m_height[v] + 1;
+						m_queue.push_back(u);
+						m_current[u] = m_network.begin(u);
+						addToBucket(u);
+						if (Traits::positive(m_excess[u]))
+							activate(u);
+					}
+				}
+			}
+		}
+
+		/**
+		 * \brief Posiciona 'm_maxActive' na maior altura com algum nó ativo.
+		 * \return Falso se não houver nenhum nó ativo.
+		 */
+		bool selectActive() {
+			while (m_activeFirst[m_maxActive] == NONE) {
+				if (m_maxActive == 0)
+					return false;
+				m_maxActive--;
+			}
+			return true;
+		}
+
+		/**
+		 * \brief Empurra todo o excesso de 'u', reetiquetando-o quando necessário.
+		 */
+		void discharge(NodeId u) {
+			while (Traits::positive(m_excess[u])) {
+				ArcId end = m_network.end(u);
+				ArcId arc = m_current[u];
+				for (; arc < end && Traits::positive(m_excess[u]); arc++) {
+					NodeId v = m_network.getHead(arc);
+					if (m_height[v] + 1 == m_height[u] && Traits::positive(m_network.getResidual(arc))) {
+						push(u, arc, v);
+						if (!Traits::positive(m_excess[u]))
+							break;
+					}
+				}
+				m_current[u] = std::min(arc, end);
+
+				if (Traits::positive(m_excess[u]) && !relabel(u))
+					return;
+			}
+		}
+
+		/**
+		 * \brief Envia o máximo possível do excesso de 'u' pelo arco.
+		 */
+		void push(NodeId u, ArcId arc, NodeId v) {
+			Profiler::count(Profiler::Counter::Pushes);
+			Capacity amount = static_cast<Capacity>(std::min<Sum>(m_excess[u], m_network.getResidual(arc)));
+			m_network.push(arc, amount);
+			m_excess[u] -= amount;
+			if (!Traits::positive(m_excess[v]) && v != m_sink)
+				activate(v);
+			m_excess[v] += amount;
+		}
+
+		/**
+		 * \brief Eleva 'u' para uma altura acima do seu vizinho residual mais baixo.
+		 *
+		 * \details Se 'u' era o único nó na sua altura, a heurística de lacuna (gap) move para a
+		 *          altura V todos os nós acima dela, pois nenhum deles alcança mais o sumidouro.
+		 *
+		 * \return Verdadeiro se 'u' continua na primeira fase (altura menor que V).
+		 */
+		bool relabel(NodeId u) {
+			Profiler::count(Profiler::Counter::Relabels);
+			NodeId oldHeight = m_height[u];
+			removeFromBucket(u);
+
+			if (m_bucketFirst[oldHeight] == NONE) {
+				for (NodeId h = oldHeight; h <= m_maxHeight; h++) {
+					for (NodeId v = m_bucketFirst[h]; v != NONE; v = m_bucketNext[v])
+						m_height[v] = m_nodeCount;
+					m_bucketFirst[h] = NONE;
+					m_activeFirst[h] = NONE;
+				}
+				m_maxHeight = oldHeight > 0 ? oldHeight - 1 : 0;
+				m_height[u] = m_nodeCount;
+				return false;
+			}
+
+			m_work += RELABEL_WORK;
+			NodeId newHeight = m_nodeCount;
+			for (ArcId arc = m_network.begin(u); arc < m_network.end(u); arc++) {
+				NodeId v = m_network.getHead(arc);
+				if (Traits::positive(m_network.getResidual(arc)) && m_height[v] + 1 < newHeight) {
+					newHeight = m_height[v] + 1;
+					m_current[u] = arc;
+				}
+			}
+			m_work += m_network.end(u) - m_network.begin(u);
+
+			m_height[u] = newHeight;
+			if (newHeight >= m_nodeCount)
+				return false;
+
+			addToBucket(u);
+			m_maxActive = newHeight;
+			return true;
+		}
+
+		/**
+		 * \brief Segunda fase: devolve à origem o excesso dos nós que não alcançam o sumidouro.
+		 *
+		 * \details As alturas passam a ser V mais a distância residual até a origem, e os nós com
+		 *          excesso são descarregados em ordem FIFO sem nunca alcançar o sumidouro.
+		 */
+		void returnExcess() {
+			std::vector<NodeId>& height = m_height;
+			NodeId unreachable = 2 * m_nodeCount;
+			std::fill(height.begin(), height.end(), unreachable);
+
+			m_queue.clear();
+			m_queue.push_back(m_source);
+			height[m_source] = m_nodeCount;
+			for (std::size_t head = 0; head < m_queue.size(); head++) {
+				NodeId v = m_queue[head];
+				for (ArcId arc = m_network.begin(v); arc < m_network.end(v); arc++) {
+					NodeId u = m_network.getHead(arc);
+					if (height[u] == unreachable && u != m_sink
+						&& Traits::positive(m_network.getResidual(m_network.getReverse(arc)))) {
+						height[u] = height[v] + 1;
+						m_queue.push_back(u);
+					}
+				}
+			}
+
+			m_queue.clear();
+			std::vector<bool> queued(m_nodeCount, false);
+			for (NodeId u = 0; u < m_nodeCount; u++) {
+				m_current[u] = m_network.begin(u);
+				if (u != m_source && u != m_sink && Traits::positive(m_excess[u])) {
+					m_queue.push_back(u);
+					queued[u] = true;
+				}
+			}
+
+			for (std::size_t head = 0; head < m_queue.size(); head++) {
+				NodeId u = m_queue[head];
+				queued[u] = false;
+
+				while (Traits::positive(m_excess[u])) {
+					ArcId arc = m_current[u];
+					if (arc == m_network.end(u)) {
+						NodeId newHeight = unreachable;
+						for (ArcId a = m_network.begin(u); a < m_network.end(u); a++) {
+							NodeId v = m_network.getHead(a);
+							if (Traits::positive(m_network.getResidual(a)) && height[v] + 1 < newHeight)
+								newHeight = height[v] + 1;
+						}
+						height[u] = newHeight;
+						m_current[u] = m_network.begin(u);
+						continue;
+					}
+
+					NodeId v = m_network.getHead(arc);
+					if (Traits::positive(m_network.getResidual(arc)) && height[v] + 1 == height[u]) {
+						Capacity amount = static_cast<Capacity>(std::min<Sum>(m_excess[u], m_network.getResidual(arc)));
+						m_network.push(arc, amount);
+						m_excess[u] -= amount;
+						Profiler::count(Profiler::Counter::Pushes);
+						// O excesso devolvido à origem não é acumulado: com arestas infinitas ele
+						// poderia estourar 'Sum', e nunca é lido.
+						if (v != m_source)
+							m_excess[v] += amount;
+						if (v != m_source && !queued[v]) {
+							m_queue.push_back(v);
+							queued[v] = true;
+						}
+					}
+					else {
+						m_current[u]++;
+					}
+				}
+			}
+		}
+
+		void activate(NodeId u) {
+			NodeId h = m_height[u];
+			if (h >= m_nodeCount)
+				return;
+			m_activeNext[u] = m_activeFirst[h];
+			m_activeFirst[h] = u;
+			m_maxActive = std::max(m_maxActive, h);
+		}
+
+		void addToBucket(NodeId u) {
+			NodeId h = m_height[u];
+			m_bucketPrev[u] = NONE;
+			m_bucketNext[u] = m_bucketFirst[h];
+			if (m_bucketFirst[h] != NONE)
+				m_bucketPrev[m_bucketFirst[h]] = u;
+			m_bucketFirst[h] = u;
+			m_maxHeight = std::max(m_maxHeight, h);
+		}
+
+		void removeFromBucket(NodeId u) {
+			NodeId h = m_height[u];
+			if (m_bucketPrev[u] != NONE)
+				m_bucketNext[m_bucketPrev[u]] = m_bucketNext[u];
+			else
+				m_bucketFirst[h] = m_bucketNext[u];
+			if (m_bucketNext[u] != NONE)
+				m_bucketPrev[m_bucketNext[u]] = m_bucketPrev[u];
+		}
+
+		BasicResidualGraph<Capacity>& m_network;
+		NodeId m_source;
+		NodeId m_sink;
+		NodeId m_nodeCount;
+
+		/**
+		 * \brief Altura (rótulo de distância) de cada nó.
+		 */
+		std::vector<NodeId> m_height;
+
+		/**
+		 * \brief Excesso de cada nó; 64 bits nos tipos inteiros, porque os arcos da super origem são infinitos.
+		 */
+		std::vector<Sum> m_excess;
+
+		/**
+		 * \brief Arco corrente de cada nó, a partir do qual a próxima descarga continua.
+		 */
+		std::vector<ArcId> m_current;
+
+		/**
+		 * \brief Listas encadeadas de nós ativos, indexadas pela altura.
+		 */
+		std::vector<NodeId> m_activeFirst;
+		std::vector<NodeId> m_activeNext;
+
+		/**
+		 * \brief Listas duplamente encadeadas de todos os nós de cada altura, usadas na heurística de lacuna.
+		 */
+		std::vector<NodeId> m_bucketFirst;
+		std::vector<NodeId> m_bucketNext;
+		std::vector<NodeId> m_bucketPrev;
+
+		NodeId m_maxActive;
+		NodeId m_maxHeight;
+		std::size_t m_work;
+		std::vector<NodeId> m_queue;
+	};
+}
+
+int Algorithms::PushRelabel(Graph* graph, GraphNode* source, GraphNode* sink)
+{
+	ResidualGraph network(graph);
+	int maxFlow = PushRelabel(network,
+		network.getNodeId(source->getIndex()),
+		network.getNodeId(sink->getIndex()));
+	network.writeBack();
+	return maxFlow;
+}
+
+template <typename Capacity>
+Capacity Algorithms::PushRelabel(BasicResidualGraph<Capacity>& network, NodeId source, NodeId sink)
+{
+	if (source == sink)
+		return 0;
+
+	HighestLabelPushRelabel<Capacity> solver(network, source, sink);
+	return solver.run();
+}
+
+template int Algorithms::PushRelabel<int>(BasicResidualGraph<int>&, NodeId, NodeId);
+template std::int64_t Algorithms::PushRelabel<std::int64_t>(BasicResidualGraph<std::int64_t>&, NodeId, NodeId);
+template double Algorithms::PushRelabel<double>(BasicResidualGraph<double>&, NodeId, NodeId);
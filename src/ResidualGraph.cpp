@@ -0,0 +1,296 @@
+#include <algorithm>
+#include <climits>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+#include "ResidualGraph.h"
+
+namespace {
+	/**
+	 * \brief Calcula a posição de cada nó na ordem pedida.
+	 *
+	 * \details Os vizinhos são tomados sem direção. Na BFS, cada componente começa no seu nó de
+	 *          menor número (o primeiro é o nó 0). No Cuthill-McKee, cada componente começa no nó
+	 *          de menor grau, os vizinhos são visitados em ordem crescente de grau e a ordem final
+	 *          é invertida.
+	 *
+	 * \return O novo número de cada nó.
+	 */
+	std::vector<std::uint32_t> computeOrder(std::size_t nodeCount, const std::vector<std::uint32_t>& tails,
+		const std::vector<std::uint32_t>& heads, NodeOrder order)
+	{
+		std::vector<std::size_t> offsets(nodeCount + 1, 0);
+		for (std::size_t e = 0; e < tails.size(); e++) {
+			offsets[tails[e] + 1]++;
+			offsets[heads[e] + 1]++;
+		}
+		for (std::size_t v = 0; v < nodeCount; v++)
+			offsets[v + 1] += offsets[v];
+		std::vector<std::uint32_t> neighbours(offsets[nodeCount]);
+		std::vector<std::size_t> next(offsets.begin(), offsets.end() - 1);
+		for (std::size_t e = 0; e < tails.size(); e++) {
+			neighbours[next[tails[e]]++] = heads[e];
+			neighbours[next[heads[e]]++] = tails[e];
+		}
+		auto degree = [&](std::uint32_t v) { return offsets[v + 1] - offsets[v]; };
+
+		bool cuthillMcKee = order == NodeOrder::ReverseCuthillMcKee;
+		std::vector<std::uint32_t> starts(nodeCount);
+		std::iota(starts.begin(), starts.end(), 0);
+		if (cuthillMcKee)
+			std::stable_sort(starts.begin(), starts.end(), [&](std::uint32_t a, std::uint32_t b) { return degree(a) < degree(b); });
+
+		std::vector<std::uint8_t> visited(nodeCount, 0);
+		std::vector<std::uint32_t> sequence;
+		sequence.reserve(nodeCount);
+		for (std::uint32_t start : starts) {
+			if (visited[start])
+				continue;
+			visited[start] = 1;
+			sequence.push_back(start);
+			for (std::size_t head = sequence.size() - 1; head < sequence.size(); head++) {
+				std::uint32_t u = sequence[head];
+				std::size_t first = sequence.size();
+				for (std::size_t i = offsets[u]; i < offsets[u + 1]; i++) {
+					if (!visited[neighbours[i]]) {
+						visited[neighbours[i]] = 1;
+						sequence.push_back(neighbours[i]);
+					}
+				}
+				if (cuthillMcKee)
+					std::stable_sort(sequence.begin() + static_cast<std::ptrdiff_t>(first), sequence.end(),
+						[&](std::uint32_t a, std::uint32_t b) { return degree(a) < degree(b); });
+			}
+		}
+		if (cuthillMcKee)
+			std::reverse(sequence.begin(), sequence.end());
+
+		std::vector<std::uint32_t> rank(nodeCount);
+		for (std::size_t position = 0; position < nodeCount; position++)
+			rank[sequence[position]] = static_cast<std::uint32_t>(position);
+		return rank;
+	}
+}
+
+template <typename Capacity>
+BasicResidualGraph<Capacity>::BasicResidualGraph(Graph* graph, NodeOrder order)
+{
+	std::vector<GraphNode*>& nodes = graph->getNodes();
+
+	m_nodeIndices.reserve(nodes.size());
+	for (GraphNode* node : nodes) {
+		m_nodeIds[node->getIndex()] = static_cast<NodeId>(m_nodeIndices.size());
+		m_nodeIndices.push_back(node->getIndex());
+	}
+
+	std::vector<NodeId> tails;
+	std::vector<NodeId> heads;
+	std::vector<Capacity> capacities;
+	for (NodeId u = 0; u < nodes.size(); u++) {
+		for (GraphEdge& edge : nodes[u]->getEdges()) {
+			if (edge.isReverse())
+				continue;
+			m_edges.push_back(&edge);
+			tails.push_back(u);
+			heads.push_back(getNodeId(edge.getTarget()->getIndex()));
+			capacities.push_back(edge.getCapacity());
+		}
+	}
+
+	reorder(order, tails, heads);
+	build(tails, heads, capacities);
+}
+
+template <typename Capacity>
+BasicResidualGraph<Capacity>::BasicResidualGraph(const Network& network, NodeOrder order)
+{
+	std::size_t nodeCount = network.getSinkIndex() + 1;
+	m_nodeIndices.resize(nodeCount);
+	for (std::size_t index = 0; index < nodeCount; index++)
+		m_nodeIndices[index] = index;
+
+	// Conexões da entrada, depois as arestas da super origem e por fim as do super sumidouro.
+	std::size_t edgeCount = network.getEdgeCount() + network.getGenerators().size() + network.getNodeCount();
+	std::vector<NodeId> tails;
+	std::vector<NodeId> heads;
+	std::vector<Capacity> capacities;
+	tails.reserve(edgeCount);
+	heads.reserve(edgeCount);
+	capacities.reserve(edgeCount);
+
+	for (std::size_t e = 0; e < network.getEdgeCount(); e++) {
+		tails.push_back(static_cast<NodeId>(network.getEdgeSource(e)));
+		heads.push_back(static_cast<NodeId>(network.getEdgeTarget(e)));
+		capacities.push_back(network.getEdgeCapacity(e));
+	}
+	for (std::size_t generator : network.getGenerators()) {
+		int supply = network.getSupplyLimit(generator);
+		tails.push_back(static_cast<NodeId>(network.getSourceIndex()));
+		heads.push_back(static_cast<NodeId>(generator));
+		capacities.push_back(supply == INT_MAX ? CapacityTraits<Capacity>::infinity() : supply);
+	}
+	for (std::size_t index = 1; index <= network.getNodeCount(); index++) {
+		if (network.getDemand(index) > 0) {
+			tails.push_back(static_cast<NodeId>(index));
+			heads.push_back(static_cast<NodeId>(network.getSinkIndex()));
+			capacities.push_back(network.getDemand(index));
+		}
+	}
+
+	reorder(order, tails, heads);
+	build(tails, heads, capacities);
+}
+
+template <typename Capacity>
+BasicResidualGraph<Capacity>::BasicResidualGraph(std::size_t nodeCount, std::span<const NodeId> tails,
+	std::span<const NodeId> heads, std::span<const Capacity> capacities)
+{
+	if (tails.size() != heads.size() || tails.size() != capacities.size())
+		throw std::runtime_error("listas de arestas com tamanhos diferentes");
+	for (std::size_t e = 0; e < tails.size(); e++)
+		if (tails[e] >= nodeCount || heads[e] >= nodeCount)
+			throw std::runtime_error("aresta " + std::to_string(e) + " com nó inexistente");
+
+	m_nodeIndices.resize(nodeCount);
+	for (std::size_t index = 0; index < nodeCount; index++)
+		m_nodeIndices[index] = index;
+
+	build(tails, heads, capacities);
+}
+
+template <typename Capacity>
+void BasicResidualGraph<Capacity>::reorder(NodeOrder order, std::vector<NodeId>& tails, std::vector<NodeId>& heads)
+{
+	if (order == NodeOrder::Input)
+		return;
+
+	std::size_t nodeCount = m_nodeIndices.size();
+	std::vector<NodeId> rank = computeOrder(nodeCount, tails, heads, order);
+	for (std::size_t e = 0; e < tails.size(); e++) {
+		tails[e] = rank[tails[e]];
+		heads[e] = rank[heads[e]];
+	}
+
+	std::vector<std::size_t> indices(nodeCount);
+	for (std::size_t v = 0; v < nodeCount; v++)
+		indices[rank[v]] = m_nodeIndices[v];
+	m_nodeIndices = std::move(indices);
+
+	if (!m_nodeIds.empty()) {
+		for (auto& [index, id] : m_nodeIds)
+			id = rank[id];
+	}
+	else {
+		m_denseIds.resize(nodeCount);
+		for (std::size_t index = 0; index < nodeCount; index++)
+			m_denseIds[index] = rank[index];
+	}
+}
+
+template <typename Capacity>
+void BasicResidualGraph<Capacity>::build(std::span<const NodeId> tails, std::span<const NodeId> heads, std::span<const Capacity> capacities)
+{
+	std::size_t nodeCount = m_nodeIndices.size();
+	std::size_t edgeCount = tails.size();
+
+	// Primeira passada: conta os arcos de cada nó e as arestas que saem de cada nó.
+	std::vector<std::size_t> order(nodeCount + 1, 0);
+	m_offsets.assign(nodeCount + 1, 0);
+	for (std::size_t e = 0; e < edgeCount; e++) {
+		m_offsets[tails[e] + 1]++;
+		m_offsets[heads[e] + 1]++;
+		order[tails[e] + 1]++;
+	}
+	for (std::size_t u = 0; u < nodeCount; u++) {
+		m_offsets[u + 1] += m_offsets[u];
+		order[u + 1] += order[u];
+	}
+
+	// As arestas são processadas agrupadas pelo nó de origem, mantendo a ordem relativa
+	// (ordenação por contagem estável); a aresta de número 'e' é a e-ésima da lista.
+	std::vector<std::size_t> sorted(edgeCount);
+	for (std::size_t e = 0; e < edgeCount; e++)
+		sorted[order[tails[e]]++] = e;
+
+	// Segunda passada: posiciona o arco direto e o reverso de cada aresta.
+	std::size_t arcCount = 2 * edgeCount;
+	m_heads.resize(arcCount);
+	m_reverse.resize(arcCount);
+	m_capacities.resize(arcCount);
+	m_edgeIds.resize(arcCount);
+	m_edgeArcs.resize(edgeCount);
+
+	std::vector<ArcId> next(m_offsets.begin(), m_offsets.end() - 1);
+	for (std::size_t e : sorted) {
+		ArcId forward = next[tails[e]]++;
+		ArcId backward = next[heads[e]]++;
+
+		m_heads[forward] = heads[e];
+		m_reverse[forward] = backward;
+		m_capacities[forward] = capacities[e];
+		m_edgeIds[forward] = e;
+
+		m_heads[backward] = tails[e];
+		m_reverse[backward] = forward;
+		m_capacities[backward] = 0;
+		m_edgeIds[backward] = NO_EDGE;
+
+		m_edgeArcs[e] = forward;
+	}
+
+	reset();
+}
+
+template <typename Capacity>
+void BasicResidualGraph<Capacity>::reset()
+{
+	m_residuals = m_capacities;
+}
+
+template <typename Capacity>
+void BasicResidualGraph<Capacity>::setEdgeFlows(std::span<const Capacity> flows)
+{
+	if (flows.size() != m_edgeArcs.size())
+		throw std::runtime_error("número de fluxos diferente do número de arestas");
+
+	reset();
+	for (std::size_t e = 0; e < flows.size(); e++) {
+		ArcId arc = m_edgeArcs[e];
+		if (flows[e] < 0 || flows[e] > m_capacities[arc])
+			throw std::runtime_error("fluxo da aresta " + std::to_string(e) + " fora da capacidade");
+		push(arc, flows[e]);
+	}
+}
+
+template <typename Capacity>
+void BasicResidualGraph<Capacity>::writeBack()
+{
+	for (std::size_t e = 0; e < m_edges.size(); e++) {
+		ArcId arc = m_edgeArcs[e];
+		m_edges[e]->setFlow(static_cast<int>(m_residuals[arc]));
+		if (GraphEdge* reverse = m_edges[e]->getReverse())
+			reverse->setFlow(static_cast<int>(m_residuals[m_reverse[arc]]));
+	}
+}
+
+template <typename Capacity>
+std::size_t BasicResidualGraph<Capacity>::getMemoryUsage() const
+{
+	return m_offsets.capacity() * sizeof(ArcId)
+		+ m_heads.capacity() * sizeof(NodeId)
+		+ m_reverse.capacity() * sizeof(ArcId)
+		+ m_capacities.capacity() * sizeof(Capacity)
+		+ m_residuals.capacity() * sizeof(Capacity)
+		+ m_edgeIds.capacity() * sizeof(std::size_t)
+		+ m_edges.capacity() * sizeof(GraphEdge*)
+		+ m_edgeArcs.capacity() * sizeof(ArcId)
+		+ m_nodeIndices.capacity() * sizeof(std::size_t)
+		+ m_nodeIds.size() * (sizeof(std::size_t) + sizeof(NodeId) + 2 * sizeof(void*))
+		+ m_nodeIds.bucket_count() * sizeof(void*);
+}
+
+template class BasicResidualGraph<int>;
+template class BasicResidualGraph<std::int64_t>;
+template class BasicResidualGraph<double>;
@@ -0,0 +1,155 @@
+#include <sstream>
+#include <stdexcept>
+
+#include "ScenarioBatch.h"
+
+ScenarioReader::ScenarioReader(std::istream& in, const Network& network) :
+	m_in(in), m_network(network), m_line(0)
+{
+	std::uint64_t stride = network.getSinkIndex() + 1;
+	for (std::size_t e = 0; e < network.getEdgeCount(); e++)
+		m_edgesByEndpoints[network.getEdgeSource(e) * stride + network.getEdgeTarget(e)].push_back(e);
+}
+
+bool ScenarioReader::readLine(std::string& line)
+{
+	while (std::getline(m_in, line)) {
+		m_line++;
+		std::size_t start = line.find_first_not_of(" \t\r");
+		if (start != std::string::npos && line[start] != '#')
+			return true;
+	}
+	return false;
+}
+
+void ScenarioReader::fail(const std::string& message) const
+{
+	throw std::runtime_error("linha " + std::to_string(m_line) + ": " + message);
+}
+
+bool ScenarioReader::next(Scenario& scenario)
+{
+	std::string line;
+	if (!m_pending) {
+		if (!readLine(line))
+			return false;
+		std::istringstream fields(line);
+		std::string keyword, name;
+		if (!(fields >> keyword >> name) || keyword != "cenario")
+			fail("esperado 'cenario NOME'");
+		m_pending = name;
+	}
+
+	scenario.name = std::move(*m_pending);
+	scenario.edits.clear();
+	m_pending.reset();
+
+	while (readLine(line)) {
+		std::istringstream fields(line);
+		std::string keyword;
+		fields >> keyword;
+		if (keyword == "cenario") {
+			std::string name;
+			if (!(fields >> name))
+				fail("esperado 'cenario NOME'");
+			m_pending = name;
+			break;
+		}
+		else if (keyword == "demanda") {
+			std::size_t index;
+			int demand;
+			if (!(fields >> index >> demand) || demand < 0)
+				fail("esperado 'demanda ÍNDICE VALOR'");
+			if (index < 1 || index > m_network.getNodeCount())
+				fail("nó inexistente: " + std::to_string(index));
+			if (m_network.getDemand(index) == 0)
+				fail("o nó " + std::to_string(index) + " é um gerador");
+			scenario.edits.push_back(NetworkEdit::setDemand(index, demand));
+		}
+		else if (keyword == "capacidade") {
+			std::size_t source, target;
+			int capacity;
+			if (!(fields >> source >> target >> capacity) || capacity < 0)
+				fail("esperado 'capacidade ORIGEM DESTINO VALOR'");
+			auto edges = m_edgesByEndpoints.end();
+			if (source <= m_network.getNodeCount() && target <= m_network.getNodeCount())
+				edges = m_edgesByEndpoints.find(source * (m_network.getSinkIndex() + 1) + target);
+			if (edges == m_edgesByEndpoints.end())
+				fail("conexão inexistente: " + std::to_string(source) + " " + std::to_string(target));
+			for (std::size_t edge : edges->second)
+				scenario.edits.push_back(NetworkEdit::setCapacity(edge, capacity));
+		}
+		else {
+			fail("esperado 'demanda', 'capacidade' ou 'cenario'");
+		}
+	}
+	return true;
+}
+
+ScenarioBatch::ScenarioBatch(const Network& network, MaxFlowAlgorithm algorithm, ThreadPool& pool) :
+	m_network(network), m_algorithm(std::move(algorithm)), m_pool(pool), m_base(network), m_totalDemand(0),
+	m_demandEdges(network.getSinkIndex() + 1, ResidualGraph::NO_EDGE),
+	m_graphs(pool.getThreadCount()), m_changed(pool.getThreadCount())
+{
+	// As arestas do super sumidouro vêm depois das conexões e das arestas da super origem.
+	std::size_t edge = network.getEdgeCount() + network.getGenerators().size();
+	for (std::size_t index = 1; index <= network.getNodeCount(); index++) {
+		m_totalDemand += network.getDemand(index);
+		if (network.getDemand(index) > 0)
+			m_demandEdges[index] = edge++;
+	}
+}
+
+ScenarioResult ScenarioBatch::solve(const Scenario& scenario, std::size_t thread)
+{
+	if (!m_graphs[thread])
+		m_graphs[thread].emplace(m_base);
+	ResidualGraph& graph = *m_graphs[thread];
+	std::vector<ResidualGraph::ArcId>& changed = m_changed[thread];
+
+	std::int64_t totalDemand = m_totalDemand;
+	for (const NetworkEdit& edit : scenario.edits) {
+		std::size_t edge = edit.type == NetworkEdit::Type::Demand ? m_demandEdges[edit.first] : edit.first;
+		ResidualGraph::ArcId arc = graph.getEdgeArc(edge);
+		if (edit.type == NetworkEdit::Type::Demand)
+			totalDemand += edit.value - graph.getCapacity(arc);
+		graph.setCapacity(arc, edit.value);
+		changed.push_back(arc);
+	}
+
+	graph.reset();
+	ResidualGraph::NodeId sink = graph.getNodeId(m_network.getSinkIndex());
+	int maxFlow = m_algorithm(graph, graph.getNodeId(m_network.getSourceIndex()), sink);
+
+	// Os valores da base são restaurados antes do próximo cenário; 'reset' corrige os residuais.
+	for (ResidualGraph::ArcId arc : changed)
+		graph.setCapacity(arc, m_base.getCapacity(arc));
+	changed.clear();
+
+	return { scenario.name, maxFlow, totalDemand - maxFlow };
+}
+
+std::size_t ScenarioBatch::run(ScenarioReader& reader, std::ostream& out)
+{
+	std::size_t batchSize = 4 * m_pool.getThreadCount();
+	std::vector<Scenario> scenarios(batchSize);
+	std::vector<ScenarioResult> results(batchSize);
+	std::size_t solved = 0;
+
+	while (true) {
+		std::size_t count = 0;
+		while (count < batchSize && reader.next(scenarios[count]))
+			count++;
+		if (count == 0)
+			break;
+
+		m_pool.parallelFor(count, [&](std::size_t index, std::size_t thread) {
+			results[index] = solve(scenarios[index], thread);
+		});
+		for (std::size_t i = 0; i < count; i++)
+			out << results[i].name << ' ' << results[i].maxFlow << ' ' << results[i].unmetDemand << '\n';
+		out.flush();
+		solved += count;
+	}
+	return solved;
+}
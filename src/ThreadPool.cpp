@@ -0,0 +1,81 @@
+#include <algorithm>
+
+#include "ThreadPool.h"
+
+ThreadPool::ThreadPool(std::size_t threadCount)
+{
+	if (threadCount == 0)
+		threadCount = std::max<std::size_t>(1, std::thread::hardware_concurrency());
+
+	m_workers.reserve(threadCount - 1);
+	for (std::size_t thread = 1; thread < threadCount; thread++)
+		m_workers.emplace_back(&ThreadPool::workerLoop, this, thread);
+}
+
+ThreadPool::~ThreadPool()
+{
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		m_stop = true;
+	}
+	m_start.notify_all();
+	for (std::thread& worker : m_workers)
+		worker.join();
+}
+
+void ThreadPool::parallelFor(std::size_t count, const std::function<void(std::size_t, std::size_t)>& task)
+{
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		m_task = &task;
+		m_count = count;
+		m_next = 0;
+		m_error = nullptr;
+		m_running = m_workers.size();
+		m_generation++;
+	}
+	m_start.notify_all();
+
+	runTasks(0);
+
+	std::unique_lock<std::mutex> lock(m_mutex);
+	m_done.wait(lock, [this] { return m_running == 0; });
+	m_task = nullptr;
+	if (m_error)
+		std::rethrow_exception(m_error);
+}
+
+void ThreadPool::runTasks(std::size_t thread)
+{
+	for (std::size_t index = m_next++; index < m_count; index = m_next++) {
+		try {
+			(*m_task)(index, thread);
+		}
+		catch (...) {
+			std::lock_guard<std::mutex> lock(m_mutex);
+			if (!m_error)
+				m_error = std::current_exception();
+			m_next = m_count;
+		}
+	}
+}
+
+void ThreadPool::workerLoop(std::size_t thread)
+{
+	std::size_t generation = 0;
+	while (true) {
+		{
+			std::unique_lock<std::mutex> lock(m_mutex);
+			m_start.wait(lock, [&] { return m_stop || m_generation != generation; });
+			if (m_stop)
+				return;
+			generation = m_generation;
+		}
+
+		runTasks(thread);
+
+		std::lock_guard<std::mutex> lock(m_mutex);
+		if (--m_running == 0)
+			m_done.notify_one();
+	}
+}
@@ -0,0 +1,32 @@
+#ifndef TESTNETWORKS_H
+#define TESTNETWORKS_H
+
+#include <cstddef>
+#include <random>
+
+#include "Network.h"
+
+/**
+ * \brief Redes de teste compartilhadas entre os arquivos de teste.
+ */
+namespace TestNetworks {
+	/**
+	 * \brief Rede aleatória com três geradores e nove consumidores.
+	 * \param random O gerador de números aleatórios.
+	 * \param edgeCount O número de conexões, com capacidades de 0 a 14 e laços permitidos.
+	 *
+	 * Pequena o bastante para ser resolvida do zero a cada alteração, como referência das
+	 * análises que reaproveitam o fluxo.
+	 */
+	inline Network randomNetwork(std::mt19937& random, std::size_t edgeCount) {
+		const std::size_t nodeCount = 12;
+		NetworkBuilder builder(nodeCount, edgeCount);
+		for (std::size_t index = 1; index <= nodeCount; index++)
+			builder.defineNode(index, index <= 3 ? 0 : static_cast<int>(random() % 20 + 1));
+		for (std::size_t e = 0; e < edgeCount; e++)
+			builder.addEdge(random() % nodeCount + 1, random() % nodeCount + 1, static_cast<int>(random() % 15));
+		return builder.build();
+	}
+}
+
+#endif // TESTNETWORKS_H
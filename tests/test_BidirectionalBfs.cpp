@@ -0,0 +1,86 @@
+#include <boost/test/unit_test.hpp>
+
+#include <random>
+
+#include "Algorithms.h"
+#include "Network.h"
+#include "NetworkGenerator.h"
+#include "ResidualGraph.h"
+
+namespace {
+	/**
+	 * \brief Confere os algoritmos de caminhos aumentantes com a BFS bidirecional contra o Dinic.
+	 */
+	void checkBidirectional(const Network& network) {
+		ResidualGraph::NodeId sink = static_cast<ResidualGraph::NodeId>(network.getSinkIndex());
+		ResidualGraph reference(network);
+		int expected = Algorithms::Dinic(reference, 0, sink);
+
+		ResidualGraph augmented(network);
+		BOOST_REQUIRE(Algorithms::EdmondKarp(augmented, 0, sink, Algorithms::BfsStrategy::Bidirectional) == expected);
+		BOOST_REQUIRE(Algorithms::EdmondKarp(augmented, 0, sink) == 0);
+
+		ResidualGraph scaled(network);
+		BOOST_REQUIRE(Algorithms::CapacityScaling(scaled, 0, sink, Algorithms::BfsStrategy::Bidirectional) == expected);
+		BOOST_REQUIRE(Algorithms::EdmondKarp(scaled, 0, sink) == 0);
+	}
+}
+
+/**
+ * \brief Teste 1: Redes aleatórias e sintéticas
+ *
+ * O fluxo é o mesmo do Dinic, e não resta caminho aumentante ao final.
+ */
+BOOST_AUTO_TEST_CASE(TestBidirectionalMatchesDinic)
+{
+	std::mt19937 random(20);
+	for (int round = 0; round < 40; round++) {
+		std::size_t nodeCount = 2 + random() % 80;
+		std::size_t edgeCount = random() % (4 * nodeCount);
+		NetworkBuilder builder(nodeCount, edgeCount);
+		for (std::size_t index = 1; index <= nodeCount; index++)
+			builder.defineNode(index, index % 6 == 1 ? 0 : static_cast<int>(1 + random() % 50));
+		for (std::size_t e = 0; e < edgeCount; e++)
+			builder.addEdge(random() % nodeCount + 1, random() % nodeCount + 1, static_cast<int>(random() % 40));
+		checkBidirectional(builder.build());
+	}
+
+	for (const char* topology : { "layered", "geometric", "grid", "mesh", "adversarial" }) {
+		NetworkGenerator::Options options;
+		options.topology = NetworkGenerator::parseTopology(topology);
+		options.nodeCount = 600;
+		options.edgeCount = 2000;
+		options.minCapacity = 1;
+		options.maxCapacity = 100;
+		options.seed = 20;
+		checkBidirectional(NetworkGenerator::generate(options));
+	}
+}
+
+/**
+ * \brief Teste 2: Caminhos aumentantes mínimos
+ *
+ * O consumidor 2 é atendido pela conexão direta 1 -> 2 e pela cadeia 1 -> 3 -> 4 -> 2. Com
+ * caminhos mínimos, a conexão direta é usada primeiro e a cadeia só leva a demanda de 3 e 4;
+ * um caminho mais longo pela cadeia desviaria parte da demanda de 2.
+ */
+BOOST_AUTO_TEST_CASE(TestBidirectionalShortestPaths)
+{
+	NetworkBuilder builder(4, 4);
+	builder.defineNode(1, 0);
+	builder.defineNode(2, 5);
+	builder.defineNode(3, 1);
+	builder.defineNode(4, 1);
+	builder.addEdge(1, 2, 5);
+	builder.addEdge(1, 3, 5);
+	builder.addEdge(3, 4, 5);
+	builder.addEdge(4, 2, 5);
+	Network network = builder.build();
+
+	ResidualGraph graph(network);
+	BOOST_TEST(Algorithms::EdmondKarp(graph, 0, 5, Algorithms::BfsStrategy::Bidirectional) == 7);
+	BOOST_TEST(graph.getEdgeFlow(0) == 5);
+	BOOST_TEST(graph.getEdgeFlow(1) == 2);
+	BOOST_TEST(graph.getEdgeFlow(2) == 1);
+	BOOST_TEST(graph.getEdgeFlow(3) == 0);
+}
@@ -0,0 +1,204 @@
+#include <boost/test/unit_test.hpp>
+
+#include <random>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "Algorithms.h"
+#include "BoundedFlow.h"
+#include "Network.h"
+#include "NetworkParser.h"
+#include "ResidualGraph.h"
+
+namespace {
+	std::vector<BoundedFlow::MaxFlowAlgorithm> algorithms() {
+		return {
+			[](BoundedFlow::Graph& graph, BoundedFlow::Graph::NodeId source, BoundedFlow::Graph::NodeId sink) {
+				return Algorithms::Dinic(graph, source, sink); },
+			[](BoundedFlow::Graph& graph, BoundedFlow::Graph::NodeId source, BoundedFlow::Graph::NodeId sink) {
+				return Algorithms::EdmondKarp(graph, source, sink); },
+			[](BoundedFlow::Graph& graph, BoundedFlow::Graph::NodeId source, BoundedFlow::Graph::NodeId sink) {
+				return Algorithms::PushRelabel(graph, source, sink); },
+			[](BoundedFlow::Graph& graph, BoundedFlow::Graph::NodeId source, BoundedFlow::Graph::NodeId sink) {
+				return Algorithms::CapacityScaling(graph, source, sink); },
+		};
+	}
+
+	/**
+	 * \brief Confere um resultado viável: limites, capacidades, conservação e valor do fluxo.
+	 */
+	void checkFeasible(const Network& network, const BoundedFlowResult& result) {
+		ResidualGraph graph(network);
+		BOOST_REQUIRE(result.flows.size() == graph.getEdgeCount());
+		graph.setEdgeFlows(result.flows);
+
+		for (std::size_t e = 0; e < network.getEdgeCount(); e++)
+			BOOST_REQUIRE(result.flows[e] >= network.getEdgeLowerBound(e));
+		ResidualGraph::NodeId sink = static_cast<ResidualGraph::NodeId>(network.getSinkIndex());
+		std::int64_t delivered = 0;
+		for (ResidualGraph::ArcId arc = graph.begin(sink); arc < graph.end(sink); arc++) {
+			ResidualGraph::NodeId consumer = graph.getHead(arc);
+			BOOST_REQUIRE(graph.getResidual(arc) >= network.getFirmDemand(consumer));
+			delivered += graph.getResidual(arc);
+		}
+		BOOST_REQUIRE(delivered == result.maxFlow);
+		for (ResidualGraph::NodeId v = 1; v < sink; v++) {
+			std::int64_t balance = 0;
+			for (ResidualGraph::ArcId arc = graph.begin(v); arc < graph.end(v); arc++)
+				balance += graph.getEdgeId(arc) == ResidualGraph::NO_EDGE ? graph.getResidual(arc) : -graph.getFlow(arc);
+			BOOST_REQUIRE(balance == 0);
+		}
+	}
+
+	/**
+	 * \brief Confere a condição de Hoffman violada pelo conjunto de um resultado inviável.
+	 */
+	void checkInfeasible(const Network& network, const BoundedFlowResult& result) {
+		std::vector<bool> inside(network.getSinkIndex() + 1, false);
+		for (std::size_t index : result.infeasibleSet)
+			inside[index] = true;
+
+		ResidualGraph graph(network);
+		std::int64_t required = 0;
+		std::int64_t available = 0;
+		for (std::size_t e = 0; e < graph.getEdgeCount(); e++) {
+			ResidualGraph::ArcId arc = graph.getEdgeArc(e);
+			std::size_t tail = graph.getHead(graph.getReverse(arc));
+			std::size_t head = graph.getHead(arc);
+			int lowerBound = e < network.getEdgeCount() ? network.getEdgeLowerBound(e)
+				: head == network.getSinkIndex() ? network.getFirmDemand(tail) : 0;
+			if (!inside[tail] && inside[head])
+				required += lowerBound;
+			else if (inside[tail] && !inside[head])
+				available += graph.getCapacity(arc);
+		}
+		BOOST_REQUIRE(required == result.requiredFlow);
+		BOOST_REQUIRE(available == result.availableCapacity);
+		BOOST_REQUIRE(required > available);
+	}
+}
+
+/**
+ * \brief Teste 1: A demanda firme redireciona o fluxo
+ *
+ * O gerador 1 produz no máximo 5 e alimenta os consumidores 2 e 3, de demanda 5 cada. O
+ * consumidor 3 tem demanda firme 4, e a conexão 1 -> 2 tem fluxo mínimo 1.
+ * Esperado: Fluxo máximo = 5, com 1 para o consumidor 2 e 4 para o consumidor 3
+ */
+BOOST_AUTO_TEST_CASE(TestBoundedFlowFirmDemand)
+{
+	NetworkBuilder builder(3, 2);
+	builder.defineNode(1, 0);
+	builder.setSupplyLimit(1, 5);
+	builder.defineNode(2, 5);
+	builder.defineNode(3, 5);
+	builder.setFirmDemand(3, 4);
+	builder.addEdge(1, 2, 10, 0, 1);
+	builder.addEdge(1, 3, 10);
+	Network network = builder.build();
+
+	// Sem os limites inferiores, só a geração máxima conta.
+	ResidualGraph plain(network);
+	BOOST_CHECK(Algorithms::Dinic(plain, 0, 4) == 5);
+
+	for (const BoundedFlow::MaxFlowAlgorithm& algorithm : algorithms()) {
+		BoundedFlowResult result = BoundedFlow::solve(network, algorithm);
+		BOOST_REQUIRE(result.feasible);
+		BOOST_CHECK(result.maxFlow == 5);
+		BOOST_CHECK(result.flows[0] == 1);
+		BOOST_CHECK(result.flows[1] == 4);
+		checkFeasible(network, result);
+	}
+}
+
+/**
+ * \brief Teste 2: Limites que não podem ser atendidos
+ *
+ * O gerador produz no máximo 3, mas o consumidor 2 exige 4 e a conexão 1 -> 3 exige 2. O
+ * conjunto {super origem, 3, super sumidouro} recebe 2 + 4 de limites e só sai dele a geração 3.
+ */
+BOOST_AUTO_TEST_CASE(TestBoundedFlowInfeasible)
+{
+	std::string text = "3 2\n1 0 3\n2 5 4\n3 5\n1 2 10\n1 3 10 0 2\n";
+	Network network = NetworkParser::parseBuffer(text.data(), text.size());
+	BOOST_CHECK(network.getSupplyLimit(1) == 3);
+	BOOST_CHECK(network.getFirmDemand(2) == 4);
+	BOOST_CHECK(network.getEdgeLowerBound(1) == 2);
+
+	BoundedFlowResult result = BoundedFlow::solve(network, algorithms()[0]);
+	BOOST_REQUIRE(!result.feasible);
+	BOOST_CHECK(result.requiredFlow == 6);
+	BOOST_CHECK(result.availableCapacity == 3);
+	BOOST_CHECK((result.infeasibleSet == std::vector<std::size_t>{ 0, 3, 4 }));
+	checkInfeasible(network, result);
+
+	// A rede é escrita de volta com as colunas de limite.
+	std::ostringstream printed;
+	network.print(printed);
+	BOOST_CHECK(printed.str() == "3 2\n1 0 3\n2 5 4\n3 5\n1 2 10 0 0\n1 3 10 0 2\n");
+
+	// Demanda firme acima da demanda e fluxo mínimo acima da capacidade.
+	std::string firm = "2 1\n1 0\n2 5 6\n1 2 3\n";
+	std::string lower = "2 1\n1 0\n2 5\n1 2 3 0 4\n";
+	BOOST_CHECK_THROW(NetworkParser::parseBuffer(firm.data(), firm.size()), std::runtime_error);
+	BOOST_CHECK_THROW(NetworkParser::parseBuffer(lower.data(), lower.size()), std::runtime_error);
+}
+
+/**
+ * \brief Teste 3: Redes aleatórias
+ *
+ * Sem limites inferiores o resultado é o fluxo máximo comum. Com eles, todos os algoritmos
+ * concordam sobre a viabilidade e o valor do fluxo, o fluxo respeita os limites e, se a rede for
+ * inviável, o conjunto informado viola a condição de Hoffman.
+ */
+BOOST_AUTO_TEST_CASE(TestBoundedFlowRandom)
+{
+	std::mt19937 random(23);
+	int feasible = 0;
+	int infeasible = 0;
+	for (int round = 0; round < 60; round++) {
+		bool bounded = round % 3 != 0;
+		std::size_t nodeCount = 2 + random() % 20;
+		std::size_t edgeCount = random() % (3 * nodeCount);
+		NetworkBuilder builder(nodeCount, edgeCount);
+		for (std::size_t index = 1; index <= nodeCount; index++) {
+			int demand = index % 3 == 1 ? 0 : static_cast<int>(1 + random() % 20);
+			builder.defineNode(index, demand);
+			if (demand == 0 && random() % 2)
+				builder.setSupplyLimit(index, static_cast<int>(random() % 40));
+			else if (demand > 0 && bounded && random() % 3 == 0)
+				builder.setFirmDemand(index, static_cast<int>(random() % (demand + 1)));
+		}
+		for (std::size_t e = 0; e < edgeCount; e++) {
+			int capacity = static_cast<int>(random() % 30);
+			int lowerBound = bounded && random() % 4 == 0 ? static_cast<int>(random() % (capacity / 2 + 1)) : 0;
+			builder.addEdge(random() % nodeCount + 1, random() % nodeCount + 1, capacity, 0, lowerBound);
+		}
+		Network network = builder.build();
+
+		std::vector<BoundedFlowResult> results;
+		for (const BoundedFlow::MaxFlowAlgorithm& algorithm : algorithms())
+			results.push_back(BoundedFlow::solve(network, algorithm));
+		for (const BoundedFlowResult& result : results) {
+			BOOST_REQUIRE(result.feasible == results[0].feasible);
+			if (result.feasible) {
+				BOOST_REQUIRE(result.maxFlow == results[0].maxFlow);
+				checkFeasible(network, result);
+			}
+			else {
+				checkInfeasible(network, result);
+			}
+		}
+
+		if (!network.hasLowerBounds()) {
+			ResidualGraph plain(network);
+			BOOST_REQUIRE(results[0].feasible);
+			BOOST_REQUIRE(results[0].maxFlow == Algorithms::Dinic(plain, 0, static_cast<ResidualGraph::NodeId>(network.getSinkIndex())));
+		}
+		(results[0].feasible ? feasible : infeasible)++;
+	}
+	BOOST_TEST(feasible > 0);
+	BOOST_TEST(infeasible > 0);
+}
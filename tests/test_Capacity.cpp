@@ -0,0 +1,194 @@
+#include <boost/test/unit_test.hpp>
+
+#include <climits>
+#include <cmath>
+#include <cstdint>
+#include <functional>
+#include <random>
+#include <sstream>
+#include <stdexcept>
+#include <vector>
+
+#include "Algorithms.h"
+#include "FlowReport.h"
+#include "Network.h"
+#include "ResidualGraph.h"
+
+namespace {
+	/**
+	 * \brief Resolve a rede com cada algoritmo, sempre a partir do fluxo nulo.
+	 */
+	template <typename Capacity>
+	std::vector<Capacity> solveAll(BasicResidualGraph<Capacity>& graph, ResidualGraph::NodeId source, ResidualGraph::NodeId sink) {
+		std::vector<std::function<Capacity()>> algorithms = {
+			[&]() { return Algorithms::EdmondKarp(graph, source, sink); },
+			[&]() { return Algorithms::PushRelabel(graph, source, sink); },
+			[&]() { return Algorithms::Dinic(graph, source, sink); },
+			[&]() { return Algorithms::CapacityScaling(graph, source, sink); },
+			[&]() { return Algorithms::ParallelPushRelabel(graph, source, sink, 2); },
+		};
+		std::vector<Capacity> flows;
+		for (const auto& algorithm : algorithms) {
+			graph.reset();
+			flows.push_back(algorithm());
+		}
+		return flows;
+	}
+}
+
+/**
+ * \brief Teste 1: Os três tipos de capacidade concordam em redes inteiras
+ *
+ * O fluxo máximo e o relatório devem ser os mesmos com 'int', 'std::int64_t' e 'double'.
+ */
+BOOST_AUTO_TEST_CASE(TestCapacityTypesAgree)
+{
+	std::mt19937 random(14);
+
+	for (int round = 0; round < 30; round++) {
+		std::size_t nodeCount = 2 + random() % 30;
+		std::size_t edgeCount = random() % (4 * nodeCount);
+		NetworkBuilder builder(nodeCount, edgeCount);
+		for (std::size_t index = 1; index <= nodeCount; index++)
+			builder.defineNode(index, index % 4 == 1 ? 0 : static_cast<int>(1 + random() % 50));
+		for (std::size_t e = 0; e < edgeCount; e++)
+			builder.addEdge(random() % nodeCount + 1, random() % nodeCount + 1, static_cast<int>(random() % 60));
+		Network network = builder.build();
+		ResidualGraph::NodeId sink = static_cast<ResidualGraph::NodeId>(network.getSinkIndex());
+
+		BasicResidualGraph<int> narrow(network);
+		BasicResidualGraph<std::int64_t> wide(network);
+		BasicResidualGraph<double> real(network);
+		std::vector<int> narrowFlows = solveAll(narrow, 0, sink);
+		std::vector<std::int64_t> wideFlows = solveAll(wide, 0, sink);
+		std::vector<double> realFlows = solveAll(real, 0, sink);
+		for (std::size_t i = 0; i < narrowFlows.size(); i++) {
+			BOOST_TEST(narrowFlows[i] == narrowFlows[0]);
+			BOOST_TEST(wideFlows[i] == narrowFlows[0]);
+			BOOST_TEST(realFlows[i] == narrowFlows[0]);
+		}
+
+		// O Edmonds-Karp escolhe os mesmos caminhos nos dois tipos e deixa os mesmos fluxos.
+		narrow.reset();
+		wide.reset();
+		Algorithms::EdmondKarp(narrow, 0, sink);
+		Algorithms::EdmondKarp(wide, 0, sink);
+		std::ostringstream narrowReport, wideReport;
+		FlowReport::write(narrowReport, network, narrow, narrowFlows[0]);
+		FlowReport::write(wideReport, network, wide, wideFlows[0]);
+		BOOST_TEST(narrowReport.str() == wideReport.str());
+	}
+}
+
+/**
+ * \brief Teste 2: Relatórios com totais acima de um milhão
+ *
+ * Com 'double' os totais não podem perder dígitos nem mudar para a notação científica: o
+ * relatório e o corte mínimo são iguais aos de 'std::int64_t'.
+ */
+BOOST_AUTO_TEST_CASE(TestCapacityTypesReportFormat)
+{
+	NetworkBuilder builder(6, 5);
+	builder.defineNode(1, 0);
+	builder.defineNode(2, 0);
+	builder.defineNode(3, 1234567);
+	builder.defineNode(4, 7654321);
+	builder.defineNode(5, 1000001);
+	builder.defineNode(6, 2);
+	builder.addEdge(1, 3, 1234567);
+	builder.addEdge(1, 4, 3000017);
+	builder.addEdge(2, 4, 2999999);
+	builder.addEdge(2, 5, 1000001);
+	builder.addEdge(2, 6, 1);
+	Network network = builder.build();
+
+	BasicResidualGraph<std::int64_t> wide(network);
+	BasicResidualGraph<double> real(network);
+	std::int64_t wideFlow = Algorithms::EdmondKarp(wide, 0, 7);
+	double realFlow = Algorithms::EdmondKarp(real, 0, 7);
+	BOOST_TEST(wideFlow == 8234585);
+
+	std::ostringstream wideReport, realReport;
+	FlowReport::write(wideReport, network, wide, wideFlow);
+	FlowReport::write(realReport, network, real, realFlow);
+	BOOST_TEST(realReport.str() == wideReport.str());
+	BOOST_TEST(wideReport.str().substr(0, 16) == "8234585\n1654306\n");
+
+	std::ostringstream wideCut, realCut;
+	FlowReport::writeMinCut(wideCut, network, wide);
+	FlowReport::writeMinCut(realCut, network, real);
+	BOOST_TEST(realCut.str() == wideCut.str());
+
+	// A precisão do fluxo de saída é restaurada.
+	BOOST_TEST(realReport.precision() == std::ostringstream().precision());
+}
+
+/**
+ * \brief Teste 3: Capacidades fracionárias
+ *
+ * Rede montada pela lista de arestas, com fluxo máximo de 3,75 (toda a capacidade que sai da
+ * origem; a aresta 1 -> 2 fica saturada com 0,5).
+ */
+BOOST_AUTO_TEST_CASE(TestFractionalCapacities)
+{
+	std::vector<ResidualGraph::NodeId> tails = { 0, 0, 1, 2, 1 };
+	std::vector<ResidualGraph::NodeId> heads = { 1, 2, 3, 3, 2 };
+	std::vector<double> capacities = { 1.5, 2.25, 1.0, 3.0, 0.5 };
+	BasicResidualGraph<double> graph(4, tails, heads, capacities);
+
+	for (double maxFlow : solveAll(graph, 0, 3))
+		BOOST_TEST(std::abs(maxFlow - 3.75) < 1e-9);
+	BOOST_TEST(std::abs(graph.getEdgeFlow(4) - 0.5) < 1e-9);
+
+	std::vector<std::uint8_t> sourceSide = Algorithms::MinCutSourceSide(graph, 0);
+	BOOST_TEST(sourceSide[0] == 1);
+	BOOST_TEST(sourceSide[1] == 0);
+	BOOST_TEST(sourceSide[2] == 0);
+}
+
+/**
+ * \brief Teste 4: Agregados acima de INT_MAX
+ *
+ * Três consumidores de demanda INT_MAX: o fluxo só cabe em 64 bits. Com 'int' as somas
+ * verificadas lançam 'std::overflow_error' em compilações de depuração.
+ */
+BOOST_AUTO_TEST_CASE(TestCapacityOverflow)
+{
+	NetworkBuilder builder(6, 3);
+	for (std::size_t index = 1; index <= 3; index++) {
+		builder.defineNode(index, 0);
+		builder.defineNode(index + 3, INT_MAX);
+		builder.addEdge(index, index + 3, INT_MAX);
+	}
+	Network network = builder.build();
+
+	BasicResidualGraph<std::int64_t> wide(network);
+	for (std::int64_t maxFlow : solveAll(wide, 0, 7))
+		BOOST_TEST(maxFlow == 3 * static_cast<std::int64_t>(INT_MAX));
+
+	std::ostringstream report;
+	FlowReport::write(report, network, wide, 3 * static_cast<std::int64_t>(INT_MAX));
+	BOOST_TEST(report.str().substr(0, report.str().find('\n')) == "6442450941");
+
+#ifndef NDEBUG
+	ResidualGraph narrow(network);
+	BOOST_CHECK_THROW(Algorithms::EdmondKarp(narrow, 0, 7), std::overflow_error);
+	narrow.reset();
+	BOOST_CHECK_THROW(Algorithms::Dinic(narrow, 0, 7), std::overflow_error);
+	narrow.reset();
+	BOOST_CHECK_THROW(Algorithms::PushRelabel(narrow, 0, 7), std::overflow_error);
+#endif
+}
+
+/**
+ * \brief Teste 5: Lista de arestas inválida
+ */
+BOOST_AUTO_TEST_CASE(TestEdgeListValidation)
+{
+	std::vector<ResidualGraph::NodeId> tails = { 0, 1 };
+	std::vector<ResidualGraph::NodeId> heads = { 1, 5 };
+	std::vector<double> capacities = { 1.0, 1.0 };
+	using RealGraph = BasicResidualGraph<double>;
+	BOOST_CHECK_THROW(RealGraph(2, tails, heads, capacities), std::runtime_error);
+	BOOST_CHECK_THROW(RealGraph(6, tails, heads, std::vector<double>{ 1.0 }), std::runtime_error);
+}
@@ -0,0 +1,86 @@
+#include <boost/test/unit_test.hpp>
+
+#include <climits>
+#include <random>
+
+#include "Algorithms.h"
+#include "Graph.h"
+#include "GraphNode.h"
+#include "Network.h"
+#include "ResidualGraph.h"
+
+/**
+ * \brief Teste 1: Capacidades de ordens de grandeza diferentes
+ *
+ * Para cada rede gerada, com capacidades entre 1 e 10^6, o fluxo deve ser o mesmo do Dinic,
+ * e a rede deve terminar com um fluxo máximo (nenhum caminho aumentante restante).
+ */
+BOOST_AUTO_TEST_CASE(TestCapacityScalingMatchesDinic)
+{
+	std::mt19937 random(3);
+
+	for (int round = 0; round < 40; round++) {
+		std::size_t nodeCount = 2 + random() % 40;
+		std::size_t edgeCount = random() % (5 * nodeCount);
+		NetworkBuilder builder(nodeCount, edgeCount);
+		for (std::size_t index = 1; index <= nodeCount; index++)
+			builder.defineNode(index, index % 5 == 1 ? 0 : static_cast<int>(1 + random() % 100000));
+		for (std::size_t e = 0; e < edgeCount; e++) {
+			int capacity = random() % 2 ? static_cast<int>(1 + random() % 10) : static_cast<int>(1 + random() % 1000000);
+			builder.addEdge(random() % nodeCount + 1, random() % nodeCount + 1, capacity);
+		}
+		Network network = builder.build();
+		ResidualGraph::NodeId sink = static_cast<ResidualGraph::NodeId>(network.getSinkIndex());
+
+		ResidualGraph scaled(network);
+		ResidualGraph reference(network);
+		int maxFlow = Algorithms::CapacityScaling(scaled, 0, sink);
+		BOOST_TEST(maxFlow == Algorithms::Dinic(reference, 0, sink));
+		BOOST_TEST(Algorithms::EdmondKarp(scaled, 0, sink) == 0);
+	}
+}
+
+/**
+ * \brief Teste 2: Arestas de capacidade INT_MAX
+ *
+ * Dois geradores (arestas INT_MAX da super origem) atendem consumidores com demanda total
+ * próxima de INT_MAX, sem estouro no valor inicial de 'delta' nem nos aumentos.
+ */
+BOOST_AUTO_TEST_CASE(TestCapacityScalingInfiniteEdges)
+{
+	NetworkBuilder builder(4, 4);
+	builder.defineNode(1, 0);
+	builder.defineNode(2, 0);
+	builder.defineNode(3, 1000000000);
+	builder.defineNode(4, 1000000000);
+	builder.addEdge(1, 3, INT_MAX);
+	builder.addEdge(2, 4, 999999999);
+	builder.addEdge(1, 4, 5);
+	builder.addEdge(2, 3, INT_MAX);
+	Network network = builder.build();
+
+	ResidualGraph graph(network);
+	BOOST_TEST(Algorithms::CapacityScaling(graph, 0, 5) == 2000000000);
+}
+
+/**
+ * \brief Teste 3: Versão baseada em 'Graph'
+ */
+BOOST_AUTO_TEST_CASE(TestCapacityScalingGraph)
+{
+	GraphNode nodeS(0);
+	GraphNode node1(1);
+	GraphNode node2(2);
+	GraphNode nodeT(3);
+
+	nodeS.connect(&node1, 1000);
+	nodeS.connect(&node2, 1000);
+	node1.connect(&node2, 1);
+	node1.connect(&nodeT, 1000);
+	node2.connect(&nodeT, 1000);
+
+	Graph graph({ &nodeS, &node1, &node2, &nodeT });
+
+	BOOST_CHECK(Algorithms::CapacityScaling(&graph, &nodeS, &nodeT) == 2000);
+	BOOST_CHECK(nodeS.getEdges()[0].getFlow() == 0);
+}
@@ -0,0 +1,64 @@
+#include <boost/test/unit_test.hpp>
+
+#include <random>
+
+#include "Algorithms.h"
+#include "ContingencyAnalysis.h"
+#include "Network.h"
+#include "ResidualGraph.h"
+#include "TestNetworks.h"
+#include "ThreadPool.h"
+
+namespace {
+	/**
+	 * \brief Fluxo máximo da rede sem a conexão 'removed', calculado do zero.
+	 */
+	int solveWithout(const Network& network, std::size_t removed) {
+		NetworkBuilder builder(network.getNodeCount(), network.getEdgeCount());
+		for (std::size_t index = 1; index <= network.getNodeCount(); index++)
+			builder.defineNode(index, network.getDemand(index));
+		for (std::size_t e = 0; e < network.getEdgeCount(); e++)
+			if (e != removed)
+				builder.addEdge(network.getEdgeSource(e), network.getEdgeTarget(e), network.getEdgeCapacity(e));
+		Network reduced = builder.build();
+		ResidualGraph graph(reduced);
+		return Algorithms::EdmondKarp(graph, 0, static_cast<ResidualGraph::NodeId>(reduced.getSinkIndex()));
+	}
+}
+
+/**
+ * \brief Teste 1: Cada cenário confere com a rede resolvida do zero sem a conexão
+ */
+BOOST_AUTO_TEST_CASE(TestContingencyMatchesFullSolves)
+{
+	std::mt19937 random(11);
+	ThreadPool pool(4);
+	for (int round = 0; round < 30; round++) {
+		Network network = TestNetworks::randomNetwork(random, 30);
+		ContingencyReport report = ContingencyAnalysis::run(network, pool);
+
+		BOOST_REQUIRE(report.edges.size() == network.getEdgeCount());
+		for (const ContingencyResult& result : report.edges) {
+			int expected = solveWithout(network, result.edge);
+			BOOST_REQUIRE(result.lostFlow == report.baseMaxFlow - expected);
+			BOOST_REQUIRE(result.unmetDemand == report.baseUnmetDemand + result.lostFlow);
+			BOOST_REQUIRE(result.skipped == (result.baseFlow == 0));
+		}
+	}
+}
+
+/**
+ * \brief Teste 2: O resultado não depende do número de threads
+ */
+BOOST_AUTO_TEST_CASE(TestContingencyThreadCount)
+{
+	std::mt19937 random(5);
+	Network network = TestNetworks::randomNetwork(random, 40);
+
+	ThreadPool single(1);
+	ThreadPool several(3);
+	ContingencyReport expected = ContingencyAnalysis::run(network, single);
+	ContingencyReport report = ContingencyAnalysis::run(network, several);
+	for (std::size_t e = 0; e < network.getEdgeCount(); e++)
+		BOOST_CHECK(report.edges[e].lostFlow == expected.edges[e].lostFlow);
+}
@@ -0,0 +1,236 @@
+#include <boost/test/unit_test.hpp>
+
+#include <atomic>
+#include <cstring>
+#include <optional>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+#include "DiagnosisServer.h"
+#include "Network.h"
+#include "NetworkParser.h"
+
+namespace {
+	/**
+	 * \brief O gerador 1 alimenta os consumidores 2 e 3, de demanda 5 cada, pelas conexões
+	 *        0 (1 -> 2, capacidade 4) e 1 (1 -> 3, capacidade 10). Fluxo máximo 9.
+	 */
+	Network smallNetwork() {
+		std::string text = "3 2\n1 0\n2 5\n3 5\n1 2 4\n1 3 10\n";
+		return NetworkParser::parseBuffer(text.data(), text.size());
+	}
+
+	std::string ask(DiagnosisService& service, const std::string& request) {
+		std::ostringstream out;
+		service.handle(request, out);
+		return out.str();
+	}
+}
+
+/**
+ * \brief Teste 1: Consultas do protocolo
+ */
+BOOST_AUTO_TEST_CASE(TestDiagnosisServiceQueries)
+{
+	DiagnosisService service(smallNetwork());
+	BOOST_CHECK(ask(service, "estado") == "1 9 1\n");
+	BOOST_CHECK(ask(service, "fluxo") == "9\n");
+	BOOST_CHECK(ask(service, "deficit") == "1\n");
+	BOOST_CHECK(ask(service, "criticas") == "1\n0 1 2 4\n");
+
+	// A simulação não publica uma nova versão.
+	BOOST_CHECK(ask(service, "simular capacidade 0 10 demanda 3 2") == "7 0\n");
+	BOOST_CHECK(ask(service, "estado") == "1 9 1\n");
+
+	BOOST_CHECK(ask(service, "alterar capacidade 0 10") == "2 10 0\n");
+	BOOST_CHECK(ask(service, "criticas") == "0\n");
+	BOOST_CHECK(ask(service, "alterar conexao 3 2 1 remover 1") == "3 5 5\n");
+
+	// Um lote com erro não publica nada, nem as alterações anteriores a ele.
+	BOOST_CHECK(ask(service, "alterar capacidade 0 1 remover 9").rfind("erro ", 0) == 0);
+	BOOST_CHECK(ask(service, "estado") == "3 5 5\n");
+	for (std::string request : { "", "bogus", "fluxo 1", "alterar", "alterar capacidade 0", "simular capacidade x 1",
+		"alterar demanda 2 99999999999", "recarregar", "recarregar /nao/existe" })
+		BOOST_CHECK(ask(service, request).rfind("erro ", 0) == 0);
+}
+
+/**
+ * \brief Teste 2: Versões antigas continuam válidas
+ *
+ * Uma consulta que ainda segura a versão anterior a responde inteira, mesmo depois de uma
+ * alteração e de uma recarga.
+ */
+BOOST_AUTO_TEST_CASE(TestDiagnosisServiceVersions)
+{
+	DiagnosisService service(smallNetwork());
+	std::shared_ptr<const NetworkVersion> first = service.current();
+
+	std::vector<NetworkEdit> edits{ NetworkEdit::setCapacity(1, 0) };
+	std::shared_ptr<const NetworkVersion> second = service.commit(edits);
+	BOOST_CHECK(second->number == 2);
+	BOOST_CHECK(second->flow.getMaxFlow() == 4);
+	BOOST_CHECK(service.current() == second);
+	BOOST_CHECK(first->number == 1);
+	BOOST_CHECK(first->flow.getMaxFlow() == 9);
+	BOOST_CHECK(first->flow.getEdgeCapacity(1) == 10);
+
+	std::string text = "2 1\n1 0\n2 3\n1 2 7\n";
+	std::shared_ptr<const NetworkVersion> third = service.reload(NetworkParser::parseBuffer(text.data(), text.size()));
+	BOOST_CHECK(third->number == 3);
+	BOOST_CHECK(third->flow.getMaxFlow() == 3);
+	BOOST_CHECK(second->flow.getMaxFlow() == 4);
+
+	BOOST_CHECK_THROW(DiagnosisService::parseEdits("capacidade 0"), std::runtime_error);
+	BOOST_CHECK_THROW(DiagnosisService::parseEdits("trocar 0 1"), std::runtime_error);
+	BOOST_CHECK(DiagnosisService::parseEdits("remover 3 demanda 2 4").size() == 2);
+}
+
+/**
+ * \brief Teste 3: Leitores concorrentes durante as alterações
+ *
+ * Uma thread alterna a capacidade da conexão 0 entre 10 e 4 enquanto outras consultam o
+ * estado. As versões pares têm fluxo 10 e as ímpares, 9: cada resposta vem de uma única versão,
+ * e as versões vistas por um leitor nunca diminuem.
+ */
+BOOST_AUTO_TEST_CASE(TestDiagnosisServiceConcurrentReaders)
+{
+	DiagnosisService service(smallNetwork());
+	std::atomic<bool> writing{ true };
+	std::atomic<int> failures{ 0 };
+	std::atomic<int> reads{ 0 };
+
+	std::vector<std::thread> readers;
+	for (int t = 0; t < 4; t++) {
+		readers.emplace_back([&] {
+			unsigned long long lastVersion = 0;
+			while (writing || reads < 100) {
+				std::istringstream answer(ask(service, "estado"));
+				unsigned long long version = 0;
+				int flow = 0;
+				long long unmet = 0;
+				answer >> version >> flow >> unmet;
+				if (flow != (version % 2 == 0 ? 10 : 9) || unmet != 10 - flow || version < lastVersion)
+					failures++;
+				lastVersion = version;
+				reads++;
+			}
+		});
+	}
+	for (int round = 0; round < 200; round++)
+		ask(service, round % 2 == 0 ? "alterar capacidade 0 10" : "alterar capacidade 0 4");
+	writing = false;
+	for (std::thread& reader : readers)
+		reader.join();
+
+	BOOST_CHECK(failures == 0);
+	BOOST_CHECK(ask(service, "estado") == "201 9 1\n");
+}
+
+/**
+ * \brief Teste 4: Consultas pelo socket
+ *
+ * Dois clientes conectados ao mesmo tempo; 'desligar' encerra o servidor e fecha a conexão do
+ * outro cliente.
+ */
+BOOST_AUTO_TEST_CASE(TestDiagnosisServerSocket)
+{
+	std::string path = "/tmp/metalmax_test_" + std::to_string(::getpid()) + ".sock";
+	DiagnosisService service(smallNetwork());
+	std::optional<DiagnosisServer> server(std::in_place, service, path);
+	std::thread running([&] { server->run(); });
+
+	auto connect = [&] {
+		int fd = ::socket(AF_UNIX, SOCK_STREAM, 0);
+		sockaddr_un address{};
+		address.sun_family = AF_UNIX;
+		std::memcpy(address.sun_path, path.c_str(), path.size() + 1);
+		BOOST_REQUIRE(::connect(fd, reinterpret_cast<const sockaddr*>(&address), sizeof(address)) == 0);
+		return fd;
+	};
+	auto exchange = [](int fd, const std::string& request) {
+		BOOST_REQUIRE(::write(fd, request.data(), request.size()) == static_cast<ssize_t>(request.size()));
+		std::string answer;
+		char c;
+		while (::read(fd, &c, 1) == 1 && c != '\n')
+			answer += c;
+		return answer;
+	};
+
+	int first = connect();
+	int second = connect();
+	BOOST_CHECK(exchange(first, "fluxo\n") == "9");
+	BOOST_CHECK(exchange(second, "alterar capacidade 0 10\r\n") == "2 10 0");
+	BOOST_CHECK(exchange(first, "estado\n") == "2 10 0");
+	BOOST_CHECK(exchange(second, "desligar\n") == "ok");
+	running.join();
+
+	char c;
+	BOOST_CHECK(::read(first, &c, 1) == 0);
+	::close(first);
+	::close(second);
+	server.reset();
+	BOOST_CHECK(::access(path.c_str(), F_OK) != 0);
+
+	// Outro tipo de arquivo no caminho não é substituído.
+	BOOST_CHECK_THROW(DiagnosisServer(service, "/tmp"), std::runtime_error);
+}
+
+/**
+ * \brief Teste 5: Fim da conexão
+ *
+ * Um cliente que fecha a escrita recebe as respostas e o fim do arquivo sem que outro cliente
+ * se conecte; uma consulta grande demais também termina com o fim do arquivo.
+ */
+BOOST_AUTO_TEST_CASE(TestDiagnosisServerEndOfFile)
+{
+	std::string path = "/tmp/metalmax_test_eof_" + std::to_string(::getpid()) + ".sock";
+	DiagnosisService service(smallNetwork());
+	DiagnosisServer server(service, path);
+	std::thread running([&] { server.run(); });
+
+	auto connect = [&] {
+		int fd = ::socket(AF_UNIX, SOCK_STREAM, 0);
+		sockaddr_un address{};
+		address.sun_family = AF_UNIX;
+		std::memcpy(address.sun_path, path.c_str(), path.size() + 1);
+		BOOST_REQUIRE(::connect(fd, reinterpret_cast<const sockaddr*>(&address), sizeof(address)) == 0);
+		// Sem o fim do arquivo, a leitura falha depois de 5 s em vez de travar o teste.
+		timeval timeout{ 5, 0 };
+		::setsockopt(fd, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+		return fd;
+	};
+	// Envia 'request', fecha a escrita e lê até o fim do arquivo; 'std::nullopt' se ele não vier.
+	auto readToEnd = [](int fd, const std::string& request) -> std::optional<std::string> {
+		std::size_t sent = 0;
+		while (sent < request.size()) {
+			ssize_t count = ::send(fd, request.data() + sent, request.size() - sent, MSG_NOSIGNAL);
+			if (count <= 0)
+				break;
+			sent += static_cast<std::size_t>(count);
+		}
+		::shutdown(fd, SHUT_WR);
+		std::string answer;
+		char chunk[256];
+		ssize_t count;
+		while ((count = ::read(fd, chunk, sizeof(chunk))) > 0)
+			answer.append(chunk, static_cast<std::size_t>(count));
+		::close(fd);
+		if (count < 0)
+			return std::nullopt;
+		return answer;
+	};
+
+	BOOST_CHECK(readToEnd(connect(), "fluxo\ndeficit\n") == "9\n1\n");
+	std::optional<std::string> answer = readToEnd(connect(), std::string((1 << 20) + 1, 'x'));
+	BOOST_CHECK(answer && answer->rfind("erro consulta maior que ", 0) == 0);
+
+	server.stop();
+	running.join();
+}
@@ -0,0 +1,74 @@
+#include <boost/test/unit_test.hpp>
+
+#include <random>
+
+#include "Graph.h"
+#include "GraphNode.h"
+#include "ResidualGraph.h"
+#include "Algorithms.h"
+
+/**
+ * \brief Teste 1: Rede de capacidade unitária
+ *
+ * Três caminhos disjuntos de S a T passando por (1), (2) e (3), mais uma aresta
+ * cruzada 1->2 que não aumenta o fluxo.
+ * Esperado: Fluxo máximo = 3
+ */
+BOOST_AUTO_TEST_CASE(TestDinicUnitCapacities)
+{
+	GraphNode nodeS(0);
+	GraphNode node1(1);
+	GraphNode node2(2);
+	GraphNode node3(3);
+	GraphNode nodeT(4);
+
+	nodeS.connect(&node1, 1);
+	nodeS.connect(&node2, 1);
+	nodeS.connect(&node3, 1);
+	node1.connect(&node2, 1);
+	node1.connect(&nodeT, 1);
+	node2.connect(&nodeT, 1);
+	node3.connect(&nodeT, 1);
+
+	Graph graph({ &nodeS, &node1, &node2, &node3, &nodeT });
+
+	int maxFlow = Algorithms::Dinic(&graph, &nodeS, &nodeT);
+	BOOST_CHECK(maxFlow == 3);
+}
+
+/**
+ * \brief Teste 2: Comparação com o Edmonds-Karp em grafos aleatórios
+ *
+ * Para cada grafo gerado, o valor do fluxo deve ser o mesmo dos dois algoritmos.
+ */
+BOOST_AUTO_TEST_CASE(TestDinicMatchesEdmondKarp)
+{
+	std::mt19937 random(7);
+
+	for (int round = 0; round < 50; round++) {
+		std::size_t nodeCount = 2 + random() % 30;
+		std::size_t edgeCount = random() % (4 * nodeCount);
+
+		std::vector<GraphNode> storage;
+		storage.reserve(nodeCount);
+		for (std::size_t i = 0; i < nodeCount; i++)
+			storage.emplace_back(i);
+		for (std::size_t i = 0; i < edgeCount; i++) {
+			std::size_t u = random() % nodeCount;
+			std::size_t v = random() % nodeCount;
+			if (u != v)
+				storage[u].connect(&storage[v], static_cast<int>(1 + random() % 5));
+		}
+
+		std::vector<GraphNode*> nodes;
+		for (GraphNode& node : storage)
+			nodes.push_back(&node);
+		Graph graph(nodes);
+
+		ResidualGraph expected(&graph);
+		ResidualGraph actual(&graph);
+		ResidualGraph::NodeId sink = static_cast<ResidualGraph::NodeId>(nodeCount - 1);
+
+		BOOST_CHECK_EQUAL(Algorithms::EdmondKarp(expected, 0, sink), Algorithms::Dinic(actual, 0, sink));
+	}
+}
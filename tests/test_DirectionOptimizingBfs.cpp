@@ -0,0 +1,78 @@
+#include <boost/test/unit_test.hpp>
+
+#include <random>
+
+#include "Algorithms.h"
+#include "Network.h"
+#include "NetworkGenerator.h"
+#include "ResidualGraph.h"
+
+namespace {
+	/**
+	 * \brief Confere os algoritmos de caminhos aumentantes com a BFS que otimiza a direção contra o Dinic.
+	 */
+	void checkDirectionOptimizing(const Network& network) {
+		ResidualGraph::NodeId sink = static_cast<ResidualGraph::NodeId>(network.getSinkIndex());
+		ResidualGraph reference(network);
+		int expected = Algorithms::Dinic(reference, 0, sink);
+
+		ResidualGraph augmented(network);
+		BOOST_REQUIRE(Algorithms::EdmondKarp(augmented, 0, sink, Algorithms::BfsStrategy::DirectionOptimizing) == expected);
+		BOOST_REQUIRE(Algorithms::EdmondKarp(augmented, 0, sink) == 0);
+
+		ResidualGraph scaled(network);
+		BOOST_REQUIRE(Algorithms::CapacityScaling(scaled, 0, sink, Algorithms::BfsStrategy::DirectionOptimizing) == expected);
+		BOOST_REQUIRE(Algorithms::EdmondKarp(scaled, 0, sink) == 0);
+	}
+}
+
+/**
+ * \brief Teste 1: Redes aleatórias e sintéticas
+ *
+ * O fluxo é o mesmo do Dinic, e não resta caminho aumentante ao final.
+ */
+BOOST_AUTO_TEST_CASE(TestDirectionOptimizingMatchesDinic)
+{
+	std::mt19937 random(19);
+	for (int round = 0; round < 40; round++) {
+		std::size_t nodeCount = 2 + random() % 80;
+		std::size_t edgeCount = random() % (4 * nodeCount);
+		NetworkBuilder builder(nodeCount, edgeCount);
+		for (std::size_t index = 1; index <= nodeCount; index++)
+			builder.defineNode(index, index % 6 == 1 ? 0 : static_cast<int>(1 + random() % 50));
+		for (std::size_t e = 0; e < edgeCount; e++)
+			builder.addEdge(random() % nodeCount + 1, random() % nodeCount + 1, static_cast<int>(random() % 40));
+		checkDirectionOptimizing(builder.build());
+	}
+
+	for (const char* topology : { "layered", "geometric", "grid", "mesh" }) {
+		NetworkGenerator::Options options;
+		options.topology = NetworkGenerator::parseTopology(topology);
+		options.nodeCount = 600;
+		options.edgeCount = 2000;
+		options.minCapacity = 1;
+		options.maxCapacity = 100;
+		options.seed = 19;
+		checkDirectionOptimizing(NetworkGenerator::generate(options));
+	}
+}
+
+/**
+ * \brief Teste 2: Rede larga e rasa
+ *
+ * Um gerador alimenta 2000 consumidores, e cada consumidor repassa energia ao seguinte. A
+ * fronteira do segundo nível tem quase todos os nós, e a busca passa a ser de baixo para cima.
+ */
+BOOST_AUTO_TEST_CASE(TestDirectionOptimizingWideNetwork)
+{
+	const std::size_t consumers = 2000;
+	NetworkBuilder builder(consumers + 1, 2 * consumers - 1);
+	builder.defineNode(1, 0);
+	for (std::size_t index = 2; index <= consumers + 1; index++)
+		builder.defineNode(index, static_cast<int>(index % 7 + 1));
+	for (std::size_t index = 2; index <= consumers + 1; index++)
+		builder.addEdge(1, index, static_cast<int>(index % 5));
+	for (std::size_t index = 2; index <= consumers; index++)
+		builder.addEdge(index, index + 1, 3);
+	checkDirectionOptimizing(builder.build());
+}
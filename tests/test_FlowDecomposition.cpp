@@ -0,0 +1,207 @@
+#include <boost/test/unit_test.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <sstream>
+#include <stdexcept>
+#include <vector>
+
+#include "Algorithms.h"
+#include "FlowReport.h"
+#include "Network.h"
+#include "ResidualGraph.h"
+
+namespace {
+	/**
+	 * \brief Decompõe o fluxo e confere que os caminhos e ciclos são contínuos e que, somados,
+	 *        reconstroem o fluxo de cada aresta.
+	 * \return O fluxo total dos caminhos.
+	 */
+	template <typename Capacity>
+	Capacity checkDecomposition(const BasicResidualGraph<Capacity>& graph, ResidualGraph::NodeId source, ResidualGraph::NodeId sink) {
+		std::vector<Capacity> rebuilt(graph.getEdgeCount(), 0);
+		Capacity pathFlow = 0;
+		std::size_t count = Algorithms::DecomposeFlow<Capacity>(graph, source, sink,
+			[&](std::span<const ResidualGraph::ArcId> arcs, Capacity amount) {
+				BOOST_REQUIRE(!arcs.empty());
+				BOOST_REQUIRE(amount > 0);
+				ResidualGraph::NodeId first = graph.getHead(graph.getReverse(arcs.front()));
+				for (std::size_t i = 0; i < arcs.size(); i++) {
+					BOOST_REQUIRE(graph.getEdgeId(arcs[i]) != ResidualGraph::NO_EDGE);
+					if (i > 0)
+						BOOST_REQUIRE(graph.getHead(graph.getReverse(arcs[i])) == graph.getHead(arcs[i - 1]));
+					rebuilt[graph.getEdgeId(arcs[i])] += amount;
+				}
+				if (graph.getHead(arcs.back()) == first) {
+					BOOST_REQUIRE(first != sink);
+				}
+				else {
+					BOOST_REQUIRE(first == source);
+					BOOST_REQUIRE(graph.getHead(arcs.back()) == sink);
+					pathFlow += amount;
+				}
+			});
+		BOOST_REQUIRE(count <= graph.getEdgeCount());
+		for (std::size_t e = 0; e < graph.getEdgeCount(); e++)
+			BOOST_REQUIRE(rebuilt[e] == graph.getEdgeFlow(e));
+		return pathFlow;
+	}
+}
+
+/**
+ * \brief Teste 1: Um caminho e um ciclo
+ *
+ * A origem 0 envia 3 unidades ao sumidouro 4 por 0 -> 1 -> 2 -> 4, e 2 unidades circulam por
+ * 1 -> 2 -> 3 -> 1.
+ * Esperado: um caminho de 3 unidades pelas arestas 0, 1 e 4, e um ciclo de 2 pelas arestas 1, 2 e 3
+ */
+BOOST_AUTO_TEST_CASE(TestFlowDecompositionCycle)
+{
+	std::vector<ResidualGraph::NodeId> tails{ 0, 1, 2, 3, 2 };
+	std::vector<ResidualGraph::NodeId> heads{ 1, 2, 3, 1, 4 };
+	std::vector<int> capacities(5, 10);
+	ResidualGraph graph(5, tails, heads, capacities);
+	graph.setEdgeFlows(std::vector<int>{ 3, 5, 2, 2, 3 });
+
+	std::vector<std::vector<std::size_t>> paths;
+	std::vector<int> amounts;
+	std::size_t count = Algorithms::DecomposeFlow<int>(graph, 0, 4, [&](std::span<const ResidualGraph::ArcId> arcs, int amount) {
+		std::vector<std::size_t> edges;
+		for (ResidualGraph::ArcId arc : arcs)
+			edges.push_back(graph.getEdgeId(arc));
+		paths.push_back(edges);
+		amounts.push_back(amount);
+	});
+	BOOST_REQUIRE(count == 2);
+	BOOST_REQUIRE(paths.size() == 2);
+	std::size_t path = paths[0].front() == 0 ? 0 : 1;
+	BOOST_CHECK((paths[path] == std::vector<std::size_t>{ 0, 1, 4 }));
+	BOOST_CHECK(amounts[path] == 3);
+	std::sort(paths[1 - path].begin(), paths[1 - path].end());
+	BOOST_CHECK((paths[1 - path] == std::vector<std::size_t>{ 1, 2, 3 }));
+	BOOST_CHECK(amounts[1 - path] == 2);
+	BOOST_CHECK(checkDecomposition(graph, 0, 4) == 3);
+
+	// A rede não é alterada: a decomposição pode ser repetida.
+	BOOST_CHECK(graph.getEdgeFlow(1) == 5);
+}
+
+/**
+ * \brief Teste 2: Caminhos dos geradores aos consumidores no relatório
+ *
+ * O gerador 1 alimenta os consumidores 2 e 3, de demanda 5 cada, por conexões de capacidade 4
+ * e 10.
+ * Esperado: 4 unidades de 1 para 2 e 5 de 1 para 3, com os índices da entrada em qualquer ordem
+ */
+BOOST_AUTO_TEST_CASE(TestFlowDecompositionReport)
+{
+	NetworkBuilder builder(3, 2);
+	builder.defineNode(1, 0);
+	builder.defineNode(2, 5);
+	builder.defineNode(3, 5);
+	builder.addEdge(1, 2, 4);
+	builder.addEdge(1, 3, 10);
+	Network network = builder.build();
+
+	for (NodeOrder order : { NodeOrder::Input, NodeOrder::Bfs, NodeOrder::ReverseCuthillMcKee }) {
+		ResidualGraph graph(network, order);
+		BOOST_REQUIRE(Algorithms::Dinic(graph, graph.getNodeId(0), graph.getNodeId(4)) == 9);
+		std::ostringstream out;
+		FlowReport::writePaths(out, network, graph);
+		BOOST_CHECK(out.str() == "4 1 2\n5 1 3\n" || out.str() == "5 1 3\n4 1 2\n");
+	}
+}
+
+/**
+ * \brief Teste 3: Fluxos inválidos
+ *
+ * Um nó que recebe mais do que envia, e fluxo que volta do sumidouro para a origem.
+ */
+BOOST_AUTO_TEST_CASE(TestFlowDecompositionInvalid)
+{
+	auto ignore = [](std::span<const ResidualGraph::ArcId>, int) {};
+
+	std::vector<ResidualGraph::NodeId> tails{ 0, 1 };
+	std::vector<ResidualGraph::NodeId> heads{ 1, 2 };
+	std::vector<int> capacities{ 5, 5 };
+	ResidualGraph leaking(3, tails, heads, capacities);
+	leaking.setEdgeFlows(std::vector<int>{ 2, 1 });
+	BOOST_CHECK_THROW(Algorithms::DecomposeFlow<int>(leaking, 0, 2, ignore), std::runtime_error);
+
+	std::vector<ResidualGraph::NodeId> backTails{ 0, 1 };
+	std::vector<ResidualGraph::NodeId> backHeads{ 1, 0 };
+	ResidualGraph back(2, backTails, backHeads, capacities);
+	back.setEdgeFlows(std::vector<int>{ 1, 1 });
+	BOOST_CHECK_THROW(Algorithms::DecomposeFlow<int>(back, 0, 1, ignore), std::runtime_error);
+}
+
+/**
+ * \brief Teste 4: Um caminho de um milhão de nós
+ *
+ * A busca usa uma pilha explícita, então a profundidade do caminho não é limitada pela pilha
+ * de chamadas.
+ */
+BOOST_AUTO_TEST_CASE(TestFlowDecompositionDeepPath)
+{
+	const std::size_t nodeCount = 1000000;
+	std::vector<ResidualGraph::NodeId> tails;
+	std::vector<ResidualGraph::NodeId> heads;
+	for (ResidualGraph::NodeId u = 0; u + 1 < nodeCount; u++) {
+		tails.push_back(u);
+		heads.push_back(u + 1);
+	}
+	std::vector<int> capacities(tails.size(), 7);
+	ResidualGraph graph(nodeCount, tails, heads, capacities);
+	graph.setEdgeFlows(capacities);
+
+	std::size_t length = 0;
+	int total = 0;
+	std::size_t count = Algorithms::DecomposeFlow<int>(graph, 0, static_cast<ResidualGraph::NodeId>(nodeCount - 1),
+		[&](std::span<const ResidualGraph::ArcId> arcs, int amount) {
+			length = arcs.size();
+			total += amount;
+		});
+	BOOST_CHECK(count == 1);
+	BOOST_CHECK(length == nodeCount - 1);
+	BOOST_CHECK(total == 7);
+}
+
+/**
+ * \brief Teste 5: Redes aleatórias
+ *
+ * Para o fluxo de cada algoritmo, os caminhos somam o fluxo máximo e, com os ciclos,
+ * reconstroem o fluxo de cada aresta.
+ */
+BOOST_AUTO_TEST_CASE(TestFlowDecompositionRandom)
+{
+	std::mt19937 random(24);
+	for (int round = 0; round < 40; round++) {
+		std::size_t nodeCount = 2 + random() % 30;
+		std::size_t edgeCount = random() % (4 * nodeCount);
+		NetworkBuilder builder(nodeCount, edgeCount);
+		for (std::size_t index = 1; index <= nodeCount; index++)
+			builder.defineNode(index, index % 3 == 1 ? 0 : static_cast<int>(1 + random() % 20));
+		for (std::size_t e = 0; e < edgeCount; e++)
+			builder.addEdge(random() % nodeCount + 1, random() % nodeCount + 1, static_cast<int>(random() % 30),
+				static_cast<int>(random() % 10));
+		Network network = builder.build();
+		ResidualGraph::NodeId sink = static_cast<ResidualGraph::NodeId>(network.getSinkIndex());
+
+		ResidualGraph dinic(network);
+		int maxFlow = Algorithms::Dinic(dinic, 0, sink);
+		BOOST_REQUIRE(checkDecomposition(dinic, 0, sink) == maxFlow);
+
+		ResidualGraph edmondsKarp(network);
+		BOOST_REQUIRE(Algorithms::EdmondKarp(edmondsKarp, 0, sink) == maxFlow);
+		BOOST_REQUIRE(checkDecomposition(edmondsKarp, 0, sink) == maxFlow);
+
+		BasicResidualGraph<std::int64_t> pushRelabel(network, NodeOrder::ReverseCuthillMcKee);
+		BOOST_REQUIRE(Algorithms::PushRelabel(pushRelabel, pushRelabel.getNodeId(0), pushRelabel.getNodeId(sink)) == maxFlow);
+		BOOST_REQUIRE(checkDecomposition(pushRelabel, pushRelabel.getNodeId(0), pushRelabel.getNodeId(sink)) == maxFlow);
+
+		BasicResidualGraph<std::int64_t> minCost(network);
+		BOOST_REQUIRE(Algorithms::MinCostMaxFlow(minCost, network.getEdgeCosts(), 0, sink).flow == maxFlow);
+		BOOST_REQUIRE(checkDecomposition(minCost, 0, sink) == maxFlow);
+	}
+}
@@ -0,0 +1,67 @@
+#include <boost/test/unit_test.hpp>
+
+#include <random>
+#include <stdexcept>
+
+#include "Algorithms.h"
+#include "GraphArena.h"
+#include "Network.h"
+#include "ResidualGraph.h"
+
+/**
+ * \brief Teste 1: Grafo a partir de uma lista de conexões
+ *
+ * Cada nó recebe exatamente o espaço das suas arestas diretas e reversas, e o fluxo máximo
+ * é o mesmo de um grafo montado nó a nó.
+ */
+BOOST_AUTO_TEST_CASE(TestGraphArenaEdgeList)
+{
+	std::vector<int> demands = { 0, 0, 0, 0 };
+	std::vector<std::uint32_t> tails = { 0, 0, 1, 2, 1 };
+	std::vector<std::uint32_t> heads = { 1, 2, 3, 3, 2 };
+	std::vector<int> capacities = { 10, 5, 4, 8, 3 };
+	GraphArena arena(demands, tails, heads, capacities);
+
+	BOOST_TEST(arena.getEdgeCount() == 5u);
+	BOOST_TEST(arena.getNode(1)->getEdges().size() == 3u);
+	BOOST_TEST(arena.getNode(1)->getEdges().capacity() == 3u);
+	BOOST_TEST(arena.getNode(3)->getEdges()[0].isReverse());
+	BOOST_TEST(arena.getNode(0)->getEdges()[0].getReverse()->getTarget() == arena.getNode(0));
+
+	BOOST_TEST(Algorithms::EdmondKarp(&arena.getGraph(), arena.getNode(0), arena.getNode(3)) == 12);
+	BOOST_TEST(arena.getMemoryUsage() > 10 * sizeof(GraphEdge));
+
+	std::vector<std::uint32_t> invalid = { 0, 0, 1, 2, 4 };
+	BOOST_CHECK_THROW(GraphArena(demands, tails, invalid, capacities), std::runtime_error);
+	BOOST_CHECK_THROW(GraphArena(demands, tails, heads, { capacities.data(), 4 }), std::runtime_error);
+}
+
+/**
+ * \brief Teste 2: Rede de fluxo de uma rede elétrica
+ *
+ * A arena segue a numeração de 'ResidualGraph(const Network&)' e o fluxo máximo coincide.
+ */
+BOOST_AUTO_TEST_CASE(TestGraphArenaNetwork)
+{
+	std::mt19937 random(5);
+
+	for (int round = 0; round < 20; round++) {
+		std::size_t nodeCount = 2 + random() % 50;
+		std::size_t edgeCount = random() % (4 * nodeCount);
+		NetworkBuilder builder(nodeCount, edgeCount);
+		for (std::size_t index = 1; index <= nodeCount; index++)
+			builder.defineNode(index, index % 4 == 1 ? 0 : static_cast<int>(random() % 20 + 1));
+		for (std::size_t e = 0; e < edgeCount; e++)
+			builder.addEdge(random() % nodeCount + 1, random() % nodeCount + 1, static_cast<int>(random() % 25));
+		Network network = builder.build();
+
+		GraphArena arena(network);
+		ResidualGraph graph(network);
+		BOOST_TEST(arena.getEdgeCount() == graph.getEdgeCount());
+		BOOST_TEST(arena.getNode(network.getSinkIndex())->getIndex() == network.getSinkIndex());
+
+		int expected = Algorithms::Dinic(graph, 0, static_cast<ResidualGraph::NodeId>(network.getSinkIndex()));
+		int maxFlow = Algorithms::EdmondKarp(&arena.getGraph(), arena.getNode(0), arena.getNode(network.getSinkIndex()));
+		BOOST_TEST(maxFlow == expected);
+	}
+}
@@ -0,0 +1,175 @@
+#include <boost/test/unit_test.hpp>
+
+#include <algorithm>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "Algorithms.h"
+#include "IncrementalMaxFlow.h"
+#include "Network.h"
+#include "NetworkParser.h"
+#include "ResidualGraph.h"
+
+namespace {
+	Network parseText(const std::string& text) {
+		return NetworkParser::parseBuffer(text.data(), text.size());
+	}
+
+	/**
+	 * \brief Resolve do zero a rede descrita pelo estado atual de 'state'.
+	 */
+	int solveFromScratch(const IncrementalMaxFlow& state, const Network& original) {
+		NetworkBuilder builder(original.getNodeCount(), state.getEdgeCount());
+		for (std::size_t index = 1; index <= original.getNodeCount(); index++)
+			builder.defineNode(index, original.getDemand(index));
+		for (std::size_t e = 0; e < state.getEdgeCount(); e++) {
+			const ResidualGraph& graph = state.getResidualGraph();
+			ResidualGraph::ArcId arc = graph.getEdgeArc(e);
+			builder.addEdge(graph.getNodeIndex(graph.getHead(graph.getReverse(arc))),
+				graph.getNodeIndex(graph.getHead(arc)), state.getEdgeCapacity(e));
+		}
+		Network network = builder.build();
+		ResidualGraph graph(network);
+		return Algorithms::EdmondKarp(graph, 0, static_cast<ResidualGraph::NodeId>(network.getSinkIndex()));
+	}
+}
+
+/**
+ * \brief Teste 1: Reduções cancelam o fluxo e aumentos o restauram
+ *
+ * Gerador (1) alimenta o consumidor (3) por dois caminhos: 1->3 (10) e 1->2->3 (5, 4).
+ */
+BOOST_AUTO_TEST_CASE(TestIncrementalCapacityChanges)
+{
+	Network network = parseText("3 3\n1 0\n2 20\n3 12\n1 3 10\n1 2 5\n2 3 4\n");
+	IncrementalMaxFlow state(network);
+	BOOST_CHECK(state.getMaxFlow() == 15);
+	BOOST_CHECK(state.getUnmetDemand() == 17);
+
+	std::vector<NetworkEdit> edits = { NetworkEdit::setCapacity(0, 3) };
+	BOOST_CHECK(state.apply(edits) == 8);
+	BOOST_CHECK(state.getEdgeFlow(0) == 3);
+
+	edits = { NetworkEdit::setCapacity(0, 30), NetworkEdit::setDemand(3, 25) };
+	BOOST_CHECK(state.apply(edits) == 30);
+	BOOST_CHECK(state.getUnmetDemand() == 15);
+
+	edits = { NetworkEdit::removeEdge(1), NetworkEdit::addEdge(2, 3, 9) };
+	BOOST_CHECK(state.apply(edits) == 25);
+	BOOST_CHECK(state.isRemoved(1));
+	BOOST_CHECK(state.getEdgeFlow(1) == 0);
+	BOOST_CHECK(state.getEdgeCount() == 4);
+
+	std::vector<std::size_t> critical = state.getCriticalEdges();
+	BOOST_CHECK(critical.empty());
+}
+
+/**
+ * \brief Teste 2: Alterações inválidas são recusadas
+ */
+BOOST_AUTO_TEST_CASE(TestIncrementalInvalidEdits)
+{
+	IncrementalMaxFlow state(parseText("2 1\n1 0\n2 5\n1 2 3\n"));
+
+	std::vector<NetworkEdit> edits = { NetworkEdit::setCapacity(0, 7), NetworkEdit::setCapacity(4, 1) };
+	BOOST_CHECK_THROW(state.apply(edits), std::runtime_error);
+	BOOST_CHECK(state.getMaxFlow() == 5);
+
+	edits = { NetworkEdit::setDemand(1, 3) };
+	BOOST_CHECK_THROW(state.apply(edits), std::runtime_error);
+	edits = { NetworkEdit::addEdge(1, 3, 1) };
+	BOOST_CHECK_THROW(state.apply(edits), std::runtime_error);
+	edits = { NetworkEdit::removeEdge(0), NetworkEdit::removeEdge(0) };
+	BOOST_CHECK_THROW(state.apply(edits), std::runtime_error);
+	BOOST_CHECK(state.getMaxFlow() == 0);
+}
+
+/**
+ * \brief Teste 3: Comparação com o fluxo recalculado do zero após lotes aleatórios
+ */
+BOOST_AUTO_TEST_CASE(TestIncrementalRandomBatches)
+{
+	std::mt19937 random(7);
+	for (int round = 0; round < 50; round++) {
+		const std::size_t nodeCount = 12;
+		NetworkBuilder builder(nodeCount, 40);
+		for (std::size_t index = 1; index <= nodeCount; index++)
+			builder.defineNode(index, index <= 3 ? 0 : static_cast<int>(random() % 20 + 1));
+		for (int e = 0; e < 40; e++)
+			builder.addEdge(random() % nodeCount + 1, random() % nodeCount + 1, static_cast<int>(random() % 15));
+		Network network = builder.build();
+
+		IncrementalMaxFlow state(network);
+		for (int batch = 0; batch < 10; batch++) {
+			std::vector<NetworkEdit> edits;
+			auto available = [&](std::size_t edge) {
+				return !state.isRemoved(edge) && std::find_if(edits.begin(), edits.end(), [&](const NetworkEdit& edit) {
+					return edit.type == NetworkEdit::Type::RemoveEdge && edit.first == edge; }) == edits.end();
+			};
+			for (int i = 0; i < 4; i++) {
+				std::size_t edge = random() % state.getEdgeCount();
+				switch (random() % 4) {
+				case 0:
+					if (available(edge))
+						edits.push_back(NetworkEdit::setCapacity(edge, static_cast<int>(random() % 15)));
+					break;
+				case 1:
+					edits.push_back(NetworkEdit::setDemand(random() % (nodeCount - 3) + 4, static_cast<int>(random() % 20 + 1)));
+					break;
+				case 2:
+					edits.push_back(NetworkEdit::addEdge(random() % nodeCount + 1, random() % nodeCount + 1, static_cast<int>(random() % 15)));
+					break;
+				default:
+					if (available(edge))
+						edits.push_back(NetworkEdit::removeEdge(edge));
+					break;
+				}
+			}
+			int maxFlow = state.apply(edits);
+
+			// Reconstrói as demandas atuais a partir das capacidades das arestas do sumidouro.
+			NetworkBuilder current(nodeCount, 0);
+			const ResidualGraph& graph = state.getResidualGraph();
+			for (std::size_t index = 1; index <= nodeCount; index++)
+				current.defineNode(index, network.getDemand(index));
+			for (std::size_t e = state.getEdgeCount(); e < graph.getEdgeCount(); e++) {
+				ResidualGraph::ArcId arc = graph.getEdgeArc(e);
+				if (graph.getHead(arc) == nodeCount + 1)
+					current.defineNode(graph.getNodeIndex(graph.getHead(graph.getReverse(arc))), graph.getCapacity(arc));
+			}
+			BOOST_REQUIRE(maxFlow == solveFromScratch(state, current.build()));
+			for (ResidualGraph::ArcId arc = 0; arc < graph.getArcCount(); arc++)
+				BOOST_REQUIRE(graph.getResidual(arc) >= 0);
+		}
+	}
+}
+
+/**
+ * \brief Teste 4: Um desvio completo mantém o fluxo máximo
+ *
+ * Os geradores (1, 2) alimentam o consumidor (3, demanda 8) por 1->3 (5), 1->2 (10) e 2->3 (10).
+ * Sem a conexão 1->3, todo o seu fluxo é desviado por 2->3; reduzir 2->3 depois disso devolve
+ * fluxo à origem, e aumentá-la o restaura.
+ */
+BOOST_AUTO_TEST_CASE(TestIncrementalLocalRepair)
+{
+	Network network = parseText("3 3\n1 0\n2 0\n3 8\n1 3 5\n1 2 10\n2 3 10\n");
+	IncrementalMaxFlow state(network);
+	BOOST_CHECK(state.getMaxFlow() == 8);
+
+	std::vector<NetworkEdit> edits = { NetworkEdit::removeEdge(0) };
+	BOOST_CHECK(state.apply(edits) == 8);
+	BOOST_CHECK(state.getEdgeFlow(0) == 0);
+	BOOST_CHECK(state.getEdgeFlow(2) == 8);
+	BOOST_CHECK(state.getMaxFlow() == solveFromScratch(state, network));
+
+	edits = { NetworkEdit::setCapacity(2, 6) };
+	BOOST_CHECK(state.apply(edits) == 6);
+	BOOST_CHECK(state.getUnmetDemand() == 2);
+
+	edits = { NetworkEdit::setCapacity(2, 10) };
+	BOOST_CHECK(state.apply(edits) == 8);
+	BOOST_CHECK(state.getMaxFlow() == solveFromScratch(state, network));
+}
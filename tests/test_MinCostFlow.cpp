@@ -0,0 +1,148 @@
+#include <boost/test/unit_test.hpp>
+
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "Algorithms.h"
+#include "Graph.h"
+#include "GraphNode.h"
+#include "Network.h"
+#include "NetworkParser.h"
+#include "ResidualGraph.h"
+
+namespace {
+	/**
+	 * \brief Verifica, por Bellman-Ford, que a rede residual não tem ciclo de custo negativo; é a
+	 *        condição para que um fluxo máximo tenha custo mínimo.
+	 */
+	bool hasNegativeCycle(const ResidualGraph& network, const std::vector<int>& costs) {
+		std::vector<std::int64_t> arcCost(network.getArcCount(), 0);
+		for (std::size_t e = 0; e < costs.size(); e++) {
+			arcCost[network.getEdgeArc(e)] = costs[e];
+			arcCost[network.getReverse(network.getEdgeArc(e))] = -costs[e];
+		}
+
+		std::vector<std::int64_t> distance(network.getNodeCount(), 0);
+		for (std::size_t round = 0; round <= network.getNodeCount(); round++) {
+			bool changed = false;
+			for (ResidualGraph::NodeId u = 0; u < network.getNodeCount(); u++) {
+				for (ResidualGraph::ArcId arc = network.begin(u); arc < network.end(u); arc++) {
+					ResidualGraph::NodeId v = network.getHead(arc);
+					if (network.getResidual(arc) > 0 && distance[u] + arcCost[arc] < distance[v]) {
+						distance[v] = distance[u] + arcCost[arc];
+						changed = true;
+					}
+				}
+			}
+			if (!changed)
+				return false;
+		}
+		return true;
+	}
+}
+
+/**
+ * \brief Teste 1: O caminho mais barato é usado primeiro
+ *
+ * De S a T há um caminho de custo 2 (S->1->T) e um de custo 10 (S->2->T), cada um com
+ * capacidade 4, e uma aresta S->T de capacidade 3 e custo 7.
+ * Esperado: Fluxo máximo = 11, custo = 4 * 2 + 3 * 7 + 4 * 10 = 69
+ */
+BOOST_AUTO_TEST_CASE(TestMinCostPrefersCheapPaths)
+{
+	GraphNode nodeS(0);
+	GraphNode node1(1);
+	GraphNode node2(2);
+	GraphNode nodeT(3);
+
+	nodeS.connect(&node1, 4, 1);
+	node1.connect(&nodeT, 9, 1);
+	nodeS.connect(&node2, 9, 5);
+	node2.connect(&nodeT, 4, 5);
+	nodeS.connect(&nodeT, 3, 7);
+
+	Graph graph({ &nodeS, &node1, &node2, &nodeT });
+
+	MinCostFlow<int> result = Algorithms::MinCostMaxFlow(&graph, &nodeS, &nodeT);
+	BOOST_CHECK(result.flow == 11);
+	BOOST_CHECK(result.cost == 69);
+}
+
+/**
+ * \brief Teste 2: Comparação com o Dinic em grafos aleatórios
+ *
+ * O fluxo é o máximo, o custo informado é o do fluxo encontrado e a rede residual não tem
+ * ciclos negativos. Custos que faltam valem zero, e custos negativos são rejeitados.
+ */
+BOOST_AUTO_TEST_CASE(TestMinCostMatchesDinic)
+{
+	std::mt19937 random(11);
+
+	for (int round = 0; round < 50; round++) {
+		std::size_t nodeCount = 2 + random() % 30;
+		std::size_t edgeCount = random() % (4 * nodeCount);
+		std::vector<ResidualGraph::NodeId> tails;
+		std::vector<ResidualGraph::NodeId> heads;
+		std::vector<int> capacities;
+		std::vector<int> costs;
+		for (std::size_t e = 0; e < edgeCount; e++) {
+			tails.push_back(static_cast<ResidualGraph::NodeId>(random() % nodeCount));
+			heads.push_back(static_cast<ResidualGraph::NodeId>(random() % nodeCount));
+			capacities.push_back(static_cast<int>(random() % 20));
+			costs.push_back(static_cast<int>(random() % 10));
+		}
+
+		ResidualGraph reference(nodeCount, tails, heads, capacities);
+		int expected = Algorithms::Dinic(reference, 0, static_cast<ResidualGraph::NodeId>(nodeCount - 1));
+
+		ResidualGraph network(nodeCount, tails, heads, capacities);
+		MinCostFlow<int> result = Algorithms::MinCostMaxFlow(network, costs, 0, static_cast<ResidualGraph::NodeId>(nodeCount - 1));
+		BOOST_REQUIRE(result.flow == expected);
+
+		std::int64_t cost = 0;
+		for (std::size_t e = 0; e < edgeCount; e++)
+			cost += static_cast<std::int64_t>(network.getEdgeFlow(e)) * costs[e];
+		BOOST_REQUIRE(result.cost == cost);
+		BOOST_REQUIRE(!hasNegativeCycle(network, costs));
+
+		BasicResidualGraph<std::int64_t> wide(nodeCount, tails, heads,
+			std::vector<std::int64_t>(capacities.begin(), capacities.end()));
+		MinCostFlow<std::int64_t> wideResult = Algorithms::MinCostMaxFlow(wide, costs, 0, static_cast<ResidualGraph::NodeId>(nodeCount - 1));
+		BOOST_REQUIRE(wideResult.flow == expected);
+		BOOST_REQUIRE(wideResult.cost == result.cost);
+	}
+
+	ResidualGraph network(2, std::vector<ResidualGraph::NodeId>{ 0, 0 }, std::vector<ResidualGraph::NodeId>{ 1, 1 },
+		std::vector<int>{ 3, 4 });
+	MinCostFlow<int> free = Algorithms::MinCostMaxFlow(network, std::vector<int>{ 2 }, 0, 1);
+	BOOST_CHECK(free.flow == 7);
+	BOOST_CHECK(free.cost == 6);
+	BOOST_CHECK_THROW(Algorithms::MinCostMaxFlow(network, std::vector<int>{ 1, -1 }, 0, 1), std::runtime_error);
+}
+
+/**
+ * \brief Teste 3: Coluna de custo da entrada
+ *
+ * O gerador 1 chega ao consumidor 3 diretamente (custo 9) ou passando pelo consumidor 2
+ * (custo 1 + 1), que só recebe 4. A conexão sem a quarta coluna custa zero.
+ * Esperado: Fluxo máximo = 10; o consumidor 2 fica com 2 e repassa 2 ao consumidor 3, que
+ * recebe os outros 4 pela conexão direta. Custo = 4 * 1 + 2 * 1 + 4 * 9 = 42
+ */
+BOOST_AUTO_TEST_CASE(TestMinCostFromNetwork)
+{
+	std::string text = "4 4\n1 0\n2 2\n3 6\n4 2\n1 3 10 9\n1 2 4 1\n2 3 10 1\n1 4 5\n";
+	Network network = NetworkParser::parseBuffer(text.data(), text.size());
+	BOOST_CHECK(network.hasEdgeCosts());
+	BOOST_CHECK(network.getEdgeCost(0) == 9);
+	BOOST_CHECK(network.getEdgeCost(3) == 0);
+
+	ResidualGraph graph(network);
+	MinCostFlow<int> result = Algorithms::MinCostMaxFlow(graph, network.getEdgeCosts(), 0,
+		static_cast<ResidualGraph::NodeId>(network.getSinkIndex()));
+	BOOST_CHECK(result.flow == 10);
+	BOOST_CHECK(graph.getEdgeFlow(0) == 4);
+	BOOST_CHECK(graph.getEdgeFlow(2) == 2);
+	BOOST_CHECK(result.cost == 42);
+}
@@ -0,0 +1,77 @@
+#include <boost/test/unit_test.hpp>
+
+#include <cstdint>
+#include <random>
+#include <sstream>
+
+#include "Algorithms.h"
+#include "FlowReport.h"
+#include "Network.h"
+#include "ResidualGraph.h"
+
+/**
+ * \brief Teste 1: Corte em uma rede pequena
+ *
+ * O gerador 1 alimenta os consumidores 2 (demanda 10) e 3 (demanda 10) pelas conexões
+ * 1->2 (capacidade 4) e 1->3 (capacidade 20); 2->3 tem capacidade 5.
+ * Esperado: fluxo 14; o corte tem a conexão 1->2 e a demanda do consumidor 3.
+ */
+BOOST_AUTO_TEST_CASE(TestMinCutSmallNetwork)
+{
+	NetworkBuilder builder(3, 3);
+	builder.defineNode(1, 0);
+	builder.defineNode(2, 10);
+	builder.defineNode(3, 10);
+	builder.addEdge(1, 2, 4);
+	builder.addEdge(1, 3, 20);
+	builder.addEdge(2, 3, 5);
+	Network network = builder.build();
+
+	ResidualGraph graph(network);
+	BOOST_TEST(Algorithms::Dinic(graph, 0, 4) == 14);
+
+	std::vector<std::uint8_t> sourceSide = Algorithms::MinCutSourceSide(graph, 0);
+	BOOST_TEST((sourceSide == std::vector<std::uint8_t>{ 1, 1, 0, 1, 0 }));
+
+	std::ostringstream out;
+	FlowReport::writeMinCut(out, network, graph);
+	BOOST_TEST(out.str() == "14\n1\n1 2 4\n");
+}
+
+/**
+ * \brief Teste 2: Valor do corte em redes aleatórias
+ *
+ * Para cada rede e algoritmo, as arestas do corte devem estar saturadas e a soma das suas
+ * capacidades deve ser igual ao fluxo máximo.
+ */
+BOOST_AUTO_TEST_CASE(TestMinCutMatchesMaxFlow)
+{
+	std::mt19937 random(11);
+
+	for (int round = 0; round < 40; round++) {
+		std::size_t nodeCount = 2 + random() % 40;
+		std::size_t edgeCount = random() % (5 * nodeCount);
+		NetworkBuilder builder(nodeCount, edgeCount);
+		for (std::size_t index = 1; index <= nodeCount; index++)
+			builder.defineNode(index, index <= 2 ? 0 : static_cast<int>(random() % 30 + 1));
+		for (std::size_t e = 0; e < edgeCount; e++)
+			builder.addEdge(random() % nodeCount + 1, random() % nodeCount + 1, static_cast<int>(random() % 20));
+		Network network = builder.build();
+		ResidualGraph::NodeId sink = static_cast<ResidualGraph::NodeId>(network.getSinkIndex());
+
+		for (int algorithm = 0; algorithm < 3; algorithm++) {
+			ResidualGraph graph(network);
+			int maxFlow = algorithm == 0 ? Algorithms::EdmondKarp(graph, 0, sink)
+				: algorithm == 1 ? Algorithms::PushRelabel(graph, 0, sink)
+				: Algorithms::Dinic(graph, 0, sink);
+
+			std::int64_t cutValue = 0;
+			for (ResidualGraph::ArcId arc : Algorithms::MinCut(graph, 0)) {
+				BOOST_TEST(graph.getResidual(arc) == 0);
+				cutValue += graph.getCapacity(arc);
+			}
+			BOOST_TEST(cutValue == maxFlow);
+			BOOST_TEST(!Algorithms::MinCutSourceSide(graph, 0)[sink]);
+		}
+	}
+}
@@ -0,0 +1,118 @@
+#include <boost/test/unit_test.hpp>
+
+#include <sstream>
+#include <stdexcept>
+
+#include "Algorithms.h"
+#include "Network.h"
+#include "NetworkGenerator.h"
+#include "ResidualGraph.h"
+
+namespace {
+	const NetworkGenerator::Topology TOPOLOGIES[] = {
+		NetworkGenerator::Topology::Layered,
+		NetworkGenerator::Topology::Geometric,
+		NetworkGenerator::Topology::Grid,
+		NetworkGenerator::Topology::Mesh,
+		NetworkGenerator::Topology::Adversarial,
+	};
+
+	/**
+	 * \brief Texto da rede, usado para comparar duas gerações.
+	 */
+	std::string print(const Network& network) {
+		std::ostringstream out;
+		network.print(out);
+		return out.str();
+	}
+
+	int solve(const Network& network, bool dinic) {
+		ResidualGraph graph(network);
+		ResidualGraph::NodeId sink = static_cast<ResidualGraph::NodeId>(network.getSinkIndex());
+		return dinic ? Algorithms::Dinic(graph, 0, sink) : Algorithms::EdmondKarp(graph, 0, sink);
+	}
+}
+
+BOOST_AUTO_TEST_CASE(test_generator_topologies)
+{
+	for (NetworkGenerator::Topology topology : TOPOLOGIES) {
+		NetworkGenerator::Options options;
+		options.topology = topology;
+		options.nodeCount = 400;
+		options.edgeCount = 1500;
+		options.minCapacity = 5;
+		options.maxCapacity = 50;
+		Network network = NetworkGenerator::generate(options);
+
+		BOOST_TEST(network.getNodeCount() == 400u);
+		BOOST_TEST(network.getEdgeCount() <= 1500u);
+		BOOST_TEST(!network.getGenerators().empty());
+		BOOST_TEST(network.getGenerators().size() < network.getNodeCount());
+		for (std::size_t edge = 0; edge < network.getEdgeCount(); edge++) {
+			BOOST_TEST(network.getEdgeCapacity(edge) >= 5);
+			if (topology != NetworkGenerator::Topology::Layered)
+				BOOST_TEST(network.getEdgeCapacity(edge) <= 50);
+		}
+		BOOST_TEST(solve(network, false) == solve(network, true));
+	}
+}
+
+BOOST_AUTO_TEST_CASE(test_generator_deterministic)
+{
+	for (NetworkGenerator::Topology topology : TOPOLOGIES) {
+		NetworkGenerator::Options options;
+		options.topology = topology;
+		options.nodeCount = 200;
+		options.edgeCount = 800;
+		std::string first = print(NetworkGenerator::generate(options));
+		BOOST_TEST(first == print(NetworkGenerator::generate(options)));
+
+		options.seed = 2;
+		if (topology != NetworkGenerator::Topology::Grid)
+			BOOST_TEST(first != print(NetworkGenerator::generate(options)));
+	}
+}
+
+BOOST_AUTO_TEST_CASE(test_generator_edge_target)
+{
+	NetworkGenerator::Options options;
+	options.nodeCount = 1000;
+	options.edgeCount = 5000;
+	for (NetworkGenerator::Topology topology : { NetworkGenerator::Topology::Layered, NetworkGenerator::Topology::Mesh }) {
+		options.topology = topology;
+		BOOST_TEST(NetworkGenerator::generate(options).getEdgeCount() == 5000u);
+	}
+
+	// Uma grade sem cordas tem no máximo quatro conexões por nó.
+	options.topology = NetworkGenerator::Topology::Grid;
+	BOOST_TEST(NetworkGenerator::generate(options).getEdgeCount() < 4000u);
+}
+
+BOOST_AUTO_TEST_CASE(test_generator_adversarial)
+{
+	NetworkGenerator::Options options;
+	options.topology = NetworkGenerator::Topology::Adversarial;
+	options.nodeCount = 300;
+	options.edgeCount = 900;
+	Network network = NetworkGenerator::generate(options);
+
+	// Todos os consumidores, de demanda 1, são atendidos pelo único gerador.
+	BOOST_TEST(network.getGenerators().size() == 1u);
+	BOOST_TEST(solve(network, false) == 299);
+	BOOST_TEST(solve(network, true) == 299);
+}
+
+BOOST_AUTO_TEST_CASE(test_generator_invalid_options)
+{
+	BOOST_CHECK_THROW(NetworkGenerator::parseTopology("estrela"), std::runtime_error);
+	BOOST_TEST((NetworkGenerator::parseTopology("mesh") == NetworkGenerator::Topology::Mesh));
+
+	NetworkGenerator::Options options;
+	options.nodeCount = 1;
+	BOOST_CHECK_THROW(NetworkGenerator::generate(options), std::runtime_error);
+
+	options.nodeCount = 10;
+	options.minCapacity = 10;
+	options.maxCapacity = 5;
+	BOOST_CHECK_THROW(NetworkGenerator::generate(options), std::runtime_error);
+}
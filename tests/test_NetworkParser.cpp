@@ -0,0 +1,119 @@
+#include <boost/test/unit_test.hpp>
+
+#include <stdexcept>
+#include <string>
+
+#include <unistd.h>
+
+#include "Network.h"
+#include "NetworkParser.h"
+
+namespace {
+	Network parseText(const std::string& text) {
+		return NetworkParser::parseBuffer(text.data(), text.size());
+	}
+
+	/**
+	 * \brief Verifica se a leitura de 'text' falha com uma mensagem que começa com 'prefix'.
+	 */
+	bool failsWith(const std::string& text, const std::string& prefix) {
+		try {
+			parseText(text);
+		}
+		catch (const std::runtime_error& error) {
+			return std::string(error.what()).rfind(prefix, 0) == 0;
+		}
+		return false;
+	}
+}
+
+/**
+ * \brief Teste 1: Leitura de uma rede válida
+ *
+ * Dois geradores e um consumidor; linhas em branco e '\r' são aceitos.
+ */
+BOOST_AUTO_TEST_CASE(TestParseNetwork)
+{
+	Network network = parseText("3 2\r\n1 0\n\n3 15\n2 0\n1 3 10\n2 3 7 \n");
+
+	BOOST_CHECK(network.getNodeCount() == 3);
+	BOOST_CHECK(network.getEdgeCount() == 2);
+	BOOST_CHECK(network.getSourceIndex() == 0);
+	BOOST_CHECK(network.getSinkIndex() == 4);
+	BOOST_CHECK(network.getDemand(3) == 15);
+	BOOST_CHECK(network.getGenerators().size() == 2);
+	BOOST_CHECK(network.getGenerators()[0] == 1 && network.getGenerators()[1] == 2);
+	BOOST_CHECK(network.getEdgeSource(1) == 2);
+	BOOST_CHECK(network.getEdgeTarget(1) == 3);
+	BOOST_CHECK(network.getEdgeCapacity(1) == 7);
+}
+
+/**
+ * \brief Teste 2: Linhas malformadas são reportadas com o número da linha
+ */
+BOOST_AUTO_TEST_CASE(TestParseErrors)
+{
+	BOOST_CHECK(failsWith("", "linha 1: entrada vazia"));
+	BOOST_CHECK(failsWith("2 1\n1 0\n2 x\n1 2 3\n", "linha 3: esperado"));
+	BOOST_CHECK(failsWith("2 1\n1 0\n0 5\n1 2 3\n", "linha 3: índice 0 fora do intervalo"));
+	BOOST_CHECK(failsWith("2 1\n1 0\n1 5\n1 2 3\n", "linha 3: nó 1 definido mais de uma vez"));
+	BOOST_CHECK(failsWith("2 1\n1 5\n2 5\n1 2 3\n", "linha 4: a rede não possui geradores"));
+	BOOST_CHECK(failsWith("2 1\n1 0\n2 5\n1 9 3\n", "linha 4: destino 9 fora do intervalo"));
+	BOOST_CHECK(failsWith("2 2\n1 0\n2 5\n1 2 3\n", "linha 5: fim da entrada"));
+	BOOST_CHECK(failsWith("2 1\n1 0\n2 5\n1 2 99999999999\n", "linha 4: capacidade"));
+}
+
+/**
+ * \brief Teste 3: Leitura em blocos de um descritor
+ *
+ * A entrada é escrita em um pipe, como acontece com a entrada padrão.
+ */
+BOOST_AUTO_TEST_CASE(TestParseDescriptor)
+{
+	std::string text = "2 1\n1 0\n2 20\n1 2 12345\n";
+
+	int fds[2];
+	BOOST_REQUIRE(::pipe(fds) == 0);
+	BOOST_REQUIRE(::write(fds[1], text.data(), text.size()) == static_cast<ssize_t>(text.size()));
+	::close(fds[1]);
+
+	Network network = NetworkParser::parseDescriptor(fds[0]);
+	::close(fds[0]);
+
+	BOOST_CHECK(network.getEdgeCount() == 1);
+	BOOST_CHECK(network.getEdgeCapacity(0) == 12345);
+	BOOST_CHECK(network.getDemand(2) == 20);
+}
+
+/**
+ * \brief Teste 4: Colunas opcionais e comentários no fim da linha
+ *
+ * O limite, o custo e o mínimo são lidos enquanto o próximo campo começa com um dígito; o
+ * restante da linha, como um comentário, é ignorado, e também um número depois do mínimo.
+ */
+BOOST_AUTO_TEST_CASE(TestParseOptionalColumns)
+{
+	Network network = parseText(
+		"3 4\n"
+		"1 0 50 # usina\n"
+		"2 8 3 # demanda firme\n"
+		"3 6 x\n"
+		"1 2 4 # sem custo\n"
+		"1 3 5 2 #7\n"
+		"1 2 9 1 3 # custo e mínimo\n"
+		"1 3 7 0 1 9 # o 9 é ignorado\n");
+
+	BOOST_CHECK(network.getSupplyLimit(1) == 50);
+	BOOST_CHECK(network.getFirmDemand(2) == 3);
+	BOOST_CHECK(network.getFirmDemand(3) == 0);
+	BOOST_CHECK(network.getDemand(3) == 6);
+	BOOST_REQUIRE(network.getEdgeCount() == 4);
+	BOOST_CHECK(network.getEdgeCapacity(0) == 4 && network.getEdgeCost(0) == 0 && network.getEdgeLowerBound(0) == 0);
+	BOOST_CHECK(network.getEdgeCapacity(1) == 5 && network.getEdgeCost(1) == 2 && network.getEdgeLowerBound(1) == 0);
+	BOOST_CHECK(network.getEdgeCapacity(2) == 9 && network.getEdgeCost(2) == 1 && network.getEdgeLowerBound(2) == 3);
+	BOOST_CHECK(network.getEdgeCapacity(3) == 7 && network.getEdgeCost(3) == 0 && network.getEdgeLowerBound(3) == 1);
+
+	// Um número no lugar do comentário é lido como coluna.
+	BOOST_CHECK(failsWith("2 1\n1 0\n2 5\n1 2 4 0 5\n", "linha 4: mínimo 5 fora do intervalo"));
+	BOOST_CHECK(failsWith("2 1\n1 0\n2 5 6\n1 2 4\n", "linha 3: demanda firme 6 fora do intervalo"));
+}
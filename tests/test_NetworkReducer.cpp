@@ -0,0 +1,105 @@
+#include <boost/test/unit_test.hpp>
+
+#include <random>
+#include <vector>
+
+#include "Algorithms.h"
+#include "Network.h"
+#include "NetworkGenerator.h"
+#include "NetworkReducer.h"
+#include "ResidualGraph.h"
+
+namespace {
+	/**
+	 * \brief Resolve a rede reduzida, devolve o fluxo à rede original e confere o resultado.
+	 */
+	void checkReduction(const Network& network) {
+		ResidualGraph::NodeId sink = static_cast<ResidualGraph::NodeId>(network.getSinkIndex());
+		ResidualGraph reference(network);
+		int expected = Algorithms::Dinic(reference, 0, sink);
+
+		NetworkReducer reducer(network);
+		BOOST_REQUIRE(reducer.getOriginalEdgeCount() == reference.getEdgeCount());
+		BOOST_REQUIRE(reducer.getGraph().getEdgeCount() <= reference.getEdgeCount());
+		std::int64_t reduced = Algorithms::Dinic(reducer.getGraph(), reducer.getSource(), reducer.getSink());
+		BOOST_REQUIRE(reduced == expected);
+
+		// O fluxo devolvido é válido (capacidades e conservação) e máximo.
+		ResidualGraph restored(network);
+		restored.setEdgeFlows(reducer.expandFlows());
+		std::int64_t delivered = 0;
+		for (ResidualGraph::ArcId arc = restored.begin(sink); arc < restored.end(sink); arc++)
+			delivered += restored.getResidual(arc);
+		BOOST_REQUIRE(delivered == expected);
+		for (ResidualGraph::NodeId v = 1; v < sink; v++) {
+			std::int64_t balance = 0;
+			for (ResidualGraph::ArcId arc = restored.begin(v); arc < restored.end(v); arc++)
+				balance += restored.getEdgeId(arc) == ResidualGraph::NO_EDGE ? restored.getResidual(arc) : -restored.getFlow(arc);
+			BOOST_REQUIRE(balance == 0);
+		}
+		BOOST_REQUIRE(Algorithms::EdmondKarp(restored, 0, sink) == 0);
+	}
+}
+
+/**
+ * \brief Teste 1: Redes aleatórias e sintéticas
+ *
+ * O fluxo máximo da rede reduzida é o da rede original, e o fluxo devolvido às arestas
+ * originais é válido e máximo.
+ */
+BOOST_AUTO_TEST_CASE(TestReducerPreservesMaxFlow)
+{
+	std::mt19937 random(17);
+	for (int round = 0; round < 40; round++) {
+		std::size_t nodeCount = 2 + random() % 30;
+		std::size_t edgeCount = random() % (3 * nodeCount);
+		NetworkBuilder builder(nodeCount, edgeCount);
+		for (std::size_t index = 1; index <= nodeCount; index++)
+			builder.defineNode(index, index % 4 == 1 ? 0 : static_cast<int>(1 + random() % 40));
+		for (std::size_t e = 0; e < edgeCount; e++)
+			builder.addEdge(random() % nodeCount + 1, random() % nodeCount + 1, static_cast<int>(random() % 30));
+		checkReduction(builder.build());
+	}
+
+	for (const char* topology : { "layered", "geometric", "grid", "adversarial" }) {
+		NetworkGenerator::Options options;
+		options.topology = NetworkGenerator::parseTopology(topology);
+		options.nodeCount = 400;
+		options.edgeCount = 900;
+		options.minCapacity = 1;
+		options.maxCapacity = 100;
+		options.seed = 5;
+		checkReduction(NetworkGenerator::generate(options));
+	}
+}
+
+/**
+ * \brief Teste 2: Poda, arestas paralelas e cadeias
+ *
+ * O gerador 1 alimenta o consumidor folha 2 e, por duas conexões paralelas, o consumidor 4; o
+ * consumidor 3 não recebe energia e é podado. Toda a rede se reduz a uma aresta da super origem
+ * ao super sumidouro, com capacidade min(10, 5) + min(3 + 4, 10) = 12.
+ */
+BOOST_AUTO_TEST_CASE(TestReducerContractsToSingleEdge)
+{
+	NetworkBuilder builder(4, 4);
+	builder.defineNode(1, 0);
+	builder.defineNode(2, 5);
+	builder.defineNode(3, 8);
+	builder.defineNode(4, 10);
+	builder.addEdge(1, 2, 10);
+	builder.addEdge(1, 4, 3);
+	builder.addEdge(1, 4, 4);
+	builder.addEdge(3, 4, 6);
+	Network network = builder.build();
+
+	NetworkReducer reducer(network);
+	BOOST_TEST(reducer.getGraph().getNodeCount() == 2);
+	BOOST_TEST(reducer.getGraph().getEdgeCount() == 1);
+	BOOST_TEST(Algorithms::EdmondKarp(reducer.getGraph(), reducer.getSource(), reducer.getSink()) == 12);
+
+	std::vector<int> flows = reducer.expandFlows();
+	BOOST_TEST(flows[0] == 5);
+	BOOST_TEST(flows[1] + flows[2] == 7);
+	BOOST_TEST(flows[3] == 0);
+}
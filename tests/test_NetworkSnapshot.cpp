@@ -0,0 +1,196 @@
+#include <boost/test/unit_test.hpp>
+
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <initializer_list>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+#include <unistd.h>
+
+#include "Algorithms.h"
+#include "Network.h"
+#include "NetworkParser.h"
+#include "NetworkSnapshot.h"
+#include "ResidualGraph.h"
+
+namespace {
+	const std::string TEXT = "4 4\n1 0\n2 0\n3 10\n4 6\n1 3 8\n2 3 5\n2 4 4\n3 4 3\n";
+
+	Network parseText(const std::string& text) {
+		return NetworkParser::parseBuffer(text.data(), text.size());
+	}
+
+	/**
+	 * \brief Caminho de um arquivo temporário, removido no destrutor.
+	 */
+	struct TemporaryFile {
+		std::string path = "/tmp/test_snapshot_" + std::to_string(::getpid()) + ".bin";
+		~TemporaryFile() { std::remove(path.c_str()); }
+	};
+}
+
+/**
+ * \brief Teste 1: Gravação e carga da rede e do fluxo
+ */
+BOOST_AUTO_TEST_CASE(TestSnapshotRoundTrip)
+{
+	Network network = parseText(TEXT);
+	ResidualGraph graph(network);
+	int maxFlow = Algorithms::EdmondKarp(graph, 0, static_cast<ResidualGraph::NodeId>(network.getSinkIndex()));
+
+	TemporaryFile file;
+	NetworkSnapshot::write(file.path, network, &graph, maxFlow);
+	BOOST_REQUIRE(NetworkSnapshot::isSnapshot(file.path));
+
+	NetworkSnapshot snapshot = NetworkSnapshot::load(file.path);
+	const Network& loaded = snapshot.getNetwork();
+	BOOST_CHECK(loaded.getNodeCount() == 4);
+	BOOST_CHECK(loaded.getEdgeCount() == 4);
+	BOOST_CHECK(loaded.getDemand(3) == 10);
+	BOOST_CHECK(loaded.getEdgeTarget(2) == 4);
+	BOOST_CHECK(loaded.getEdgeCapacity(3) == 3);
+	BOOST_REQUIRE(snapshot.hasFlow());
+	BOOST_CHECK(snapshot.getMaxFlow() == maxFlow);
+	BOOST_CHECK_NO_THROW(snapshot.validate());
+
+	ResidualGraph restored(loaded);
+	restored.setEdgeFlows(snapshot.getFlows());
+	for (ResidualGraph::ArcId arc = 0; arc < graph.getArcCount(); arc++)
+		BOOST_CHECK(restored.getResidual(arc) == graph.getResidual(arc));
+}
+
+/**
+ * \brief Teste 2: A conversão texto -> snapshot -> texto preserva a rede
+ */
+BOOST_AUTO_TEST_CASE(TestSnapshotTextConversion)
+{
+	TemporaryFile file;
+	NetworkSnapshot::write(file.path, parseText(TEXT));
+
+	NetworkSnapshot snapshot = NetworkSnapshot::load(file.path);
+	BOOST_CHECK(!snapshot.hasFlow());
+
+	std::ostringstream text;
+	snapshot.getNetwork().print(text);
+	BOOST_CHECK(text.str() == TEXT);
+}
+
+/**
+ * \brief Teste 3: Arquivos que não são snapshots ou estão truncados são recusados
+ */
+BOOST_AUTO_TEST_CASE(TestSnapshotInvalid)
+{
+	TemporaryFile file;
+	{
+		std::ofstream out(file.path);
+		out << TEXT;
+	}
+	BOOST_CHECK(!NetworkSnapshot::isSnapshot(file.path));
+	BOOST_CHECK_THROW(NetworkSnapshot::load(file.path), std::runtime_error);
+
+	NetworkSnapshot::write(file.path, parseText(TEXT));
+	BOOST_REQUIRE(::truncate(file.path.c_str(), 100) == 0);
+	BOOST_CHECK(NetworkSnapshot::isSnapshot(file.path));
+	BOOST_CHECK_THROW(NetworkSnapshot::load(file.path), std::runtime_error);
+}
+
+/**
+ * \brief Teste 4: Snapshot com índices adulterados
+ *
+ * Na rede "2 1 / 1 0 / 2 5 / 1 2 4", depois do cabeçalho de 64 bytes vêm as demandas
+ * (4 x int32, até 80), o gerador (80), a origem (88) e o destino (96) da conexão. A carga não
+ * percorre as seções, mas 'validate' recusa os índices fora do intervalo antes que a rede de
+ * fluxo seja montada.
+ */
+BOOST_AUTO_TEST_CASE(TestSnapshotCorrupted)
+{
+	TemporaryFile file;
+	auto corrupt = [&](std::streamoff offset, std::uint32_t value) {
+		NetworkSnapshot::write(file.path, parseText("2 1\n1 0\n2 5\n1 2 4\n"));
+		std::fstream out(file.path, std::ios::in | std::ios::out | std::ios::binary);
+		out.seekp(offset);
+		out.write(reinterpret_cast<const char*>(&value), sizeof(value));
+	};
+
+	corrupt(96, 2);
+	BOOST_CHECK_NO_THROW(NetworkSnapshot::load(file.path).validate());
+
+	for (auto [offset, value] : { std::pair<std::streamoff, std::uint32_t>{ 96, 0x0fffffff }, { 96, 0 }, { 88, 3 },
+		{ 80, 0x0fffffff }, { 80, 2 }, { 72, 0xffffffff } }) {
+		corrupt(offset, value);
+		NetworkSnapshot snapshot = NetworkSnapshot::load(file.path);
+		BOOST_CHECK_THROW(snapshot.validate(), std::runtime_error);
+	}
+
+	corrupt(96, 0x0fffffff);
+	try {
+		NetworkSnapshot::load(file.path).validate();
+		BOOST_ERROR("o snapshot adulterado foi aceito");
+	}
+	catch (const std::runtime_error& error) {
+		BOOST_CHECK(std::string(error.what()) == "snapshot inválido: destino 268435455 fora do intervalo 1..2");
+	}
+}
+
+/**
+ * \brief Teste 5: Snapshot com fluxo adulterado
+ *
+ * Na rede "2 1 / 1 0 / 2 5 / 1 2 4" resolvida, o fluxo máximo fica no byte 56 do cabeçalho
+ * (int64) e o fluxo da conexão, da aresta da super origem e da aresta do super sumidouro, nos
+ * bytes 112, 116 e 120, todos iguais a 4. 'validate' recusa o fluxo que não se conserva e o
+ * fluxo máximo diferente do que chega ao sumidouro, que seriam impressos sem conferência.
+ */
+BOOST_AUTO_TEST_CASE(TestSnapshotCorruptedFlow)
+{
+	Network network = parseText("2 1\n1 0\n2 5\n1 2 4\n");
+	ResidualGraph graph(network);
+	int maxFlow = Algorithms::EdmondKarp(graph, 0, static_cast<ResidualGraph::NodeId>(network.getSinkIndex()));
+	BOOST_REQUIRE(maxFlow == 4);
+
+	TemporaryFile file;
+	auto corrupt = [&](std::initializer_list<std::pair<std::streamoff, std::int32_t>> flows, std::int64_t headerMaxFlow) {
+		NetworkSnapshot::write(file.path, network, &graph, maxFlow);
+		std::fstream out(file.path, std::ios::in | std::ios::out | std::ios::binary);
+		for (auto [offset, value] : flows) {
+			out.seekp(offset);
+			out.write(reinterpret_cast<const char*>(&value), sizeof(value));
+		}
+		out.seekp(56);
+		out.write(reinterpret_cast<const char*>(&headerMaxFlow), sizeof(headerMaxFlow));
+	};
+
+	// Um fluxo menor, mas conservado, é aceito: 'validate' não refaz o fluxo máximo.
+	corrupt({}, 4);
+	BOOST_CHECK_NO_THROW(NetworkSnapshot::load(file.path).validate());
+	corrupt({ { 112, 3 }, { 116, 3 }, { 120, 3 } }, 3);
+	BOOST_CHECK_NO_THROW(NetworkSnapshot::load(file.path).validate());
+
+	corrupt({ { 112, 3 } }, 4);
+	try {
+		NetworkSnapshot::load(file.path).validate();
+		BOOST_ERROR("o fluxo adulterado foi aceito");
+	}
+	catch (const std::runtime_error& error) {
+		BOOST_CHECK(std::string(error.what()) == "snapshot inválido: o fluxo não se conserva no nó 1 (saldo 1)");
+	}
+
+	corrupt({}, 5);
+	try {
+		NetworkSnapshot::load(file.path).validate();
+		BOOST_ERROR("o fluxo máximo adulterado foi aceito");
+	}
+	catch (const std::runtime_error& error) {
+		BOOST_CHECK(std::string(error.what()) == "snapshot inválido: fluxo máximo 5 diferente do fluxo que chega ao sumidouro, 4");
+	}
+
+	corrupt({ { 112, 5 }, { 116, 5 }, { 120, 5 } }, 5);
+	BOOST_CHECK_THROW(NetworkSnapshot::load(file.path).validate(), std::runtime_error);
+	corrupt({ { 116, -1 } }, 4);
+	BOOST_CHECK_THROW(NetworkSnapshot::load(file.path).validate(), std::runtime_error);
+	corrupt({}, std::int64_t{ 1 } << 40);
+	BOOST_CHECK_THROW(NetworkSnapshot::load(file.path), std::runtime_error);
+}
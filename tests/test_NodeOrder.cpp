@@ -0,0 +1,109 @@
+#include <boost/test/unit_test.hpp>
+
+#include <algorithm>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "Algorithms.h"
+#include "FlowReport.h"
+#include "Network.h"
+#include "NetworkGenerator.h"
+#include "ResidualGraph.h"
+
+namespace {
+	/**
+	 * \brief Resolve a rede com a numeração pedida e retorna o fluxo máximo e o corte mínimo.
+	 *
+	 * \details O corte lido da rede residual (os nós alcançáveis a partir da origem) é o mesmo
+	 *          para qualquer fluxo máximo; já as arestas saturadas dependem de qual fluxo máximo
+	 *          o algoritmo encontra, e a ordem dos arcos muda com a numeração.
+	 */
+	std::string solveAndReport(const Network& network, NodeOrder order) {
+		ResidualGraph graph(network, order);
+
+		// A numeração é uma permutação, e as conversões são inversas uma da outra.
+		std::vector<bool> seen(graph.getNodeCount(), false);
+		for (std::size_t index = 0; index < graph.getNodeCount(); index++) {
+			ResidualGraph::NodeId id = graph.getNodeId(index);
+			BOOST_REQUIRE(id < graph.getNodeCount());
+			BOOST_REQUIRE(!seen[id]);
+			seen[id] = true;
+			BOOST_REQUIRE(graph.getNodeIndex(id) == index);
+		}
+
+		int maxFlow = Algorithms::Dinic(graph, graph.getNodeId(network.getSourceIndex()), graph.getNodeId(network.getSinkIndex()));
+		std::ostringstream report;
+		report << maxFlow << '\n';
+		FlowReport::writeMinCut(report, network, graph);
+		return report.str();
+	}
+}
+
+/**
+ * \brief Teste 1: O resultado não depende da numeração
+ *
+ * Redes aleatórias (com nós isolados, que formam componentes próprios) e sintéticas dão o mesmo
+ * fluxo e o mesmo corte, listado na mesma ordem, com as três numerações.
+ */
+BOOST_AUTO_TEST_CASE(TestNodeOrderPreservesReport)
+{
+	std::mt19937 random(18);
+	for (int round = 0; round < 30; round++) {
+		std::size_t nodeCount = 2 + random() % 40;
+		std::size_t edgeCount = random() % (2 * nodeCount);
+		NetworkBuilder builder(nodeCount, edgeCount);
+		for (std::size_t index = 1; index <= nodeCount; index++)
+			builder.defineNode(index, index % 3 == 1 ? 0 : static_cast<int>(1 + random() % 40));
+		for (std::size_t e = 0; e < edgeCount; e++)
+			builder.addEdge(random() % nodeCount + 1, random() % nodeCount + 1, static_cast<int>(random() % 30));
+		Network network = builder.build();
+
+		std::string expected = solveAndReport(network, NodeOrder::Input);
+		BOOST_REQUIRE(solveAndReport(network, NodeOrder::Bfs) == expected);
+		BOOST_REQUIRE(solveAndReport(network, NodeOrder::ReverseCuthillMcKee) == expected);
+	}
+
+	for (const char* topology : { "layered", "geometric", "grid" }) {
+		NetworkGenerator::Options options;
+		options.topology = NetworkGenerator::parseTopology(topology);
+		options.nodeCount = 500;
+		options.edgeCount = 1500;
+		options.minCapacity = 1;
+		options.maxCapacity = 100;
+		options.seed = 18;
+		Network network = NetworkGenerator::generate(options);
+
+		std::string expected = solveAndReport(network, NodeOrder::Input);
+		BOOST_REQUIRE(solveAndReport(network, NodeOrder::Bfs) == expected);
+		BOOST_REQUIRE(solveAndReport(network, NodeOrder::ReverseCuthillMcKee) == expected);
+	}
+}
+
+/**
+ * \brief Teste 2: Ordem BFS a partir da super origem
+ *
+ * Na cadeia 1 -> 2 -> 4 -> 3, com o gerador 1, a BFS sem direção visita a super origem, o
+ * gerador, o consumidor 2, os vizinhos de 2 (o consumidor 4 e o super sumidouro 5) e por fim o
+ * consumidor 3.
+ */
+BOOST_AUTO_TEST_CASE(TestNodeOrderBfs)
+{
+	NetworkBuilder builder(4, 3);
+	builder.defineNode(1, 0);
+	builder.defineNode(2, 4);
+	builder.defineNode(3, 6);
+	builder.defineNode(4, 2);
+	builder.addEdge(1, 2, 9);
+	builder.addEdge(2, 4, 5);
+	builder.addEdge(4, 3, 5);
+	Network network = builder.build();
+
+	ResidualGraph graph(network, NodeOrder::Bfs);
+	std::vector<ResidualGraph::NodeId> expected = { 0, 1, 2, 5, 3, 4 };
+	for (std::size_t index = 0; index < expected.size(); index++)
+		BOOST_TEST(graph.getNodeId(index) == expected[index]);
+	BOOST_TEST(Algorithms::EdmondKarp(graph, 0, graph.getNodeId(5)) == 9);
+	BOOST_TEST(graph.getEdgeFlow(2) == 3);
+}
@@ -0,0 +1,97 @@
+#include <boost/test/unit_test.hpp>
+
+#include <random>
+#include <vector>
+
+#include "Algorithms.h"
+#include "Graph.h"
+#include "GraphNode.h"
+#include "Network.h"
+#include "ResidualGraph.h"
+#include "ThreadPool.h"
+
+namespace {
+	/**
+	 * \brief Verifica se a rede contém um fluxo válido de valor 'flow' entre 'source' e 'sink'.
+	 */
+	bool isValidFlow(const ResidualGraph& network, ResidualGraph::NodeId source, ResidualGraph::NodeId sink, int flow) {
+		for (ResidualGraph::NodeId u = 0; u < network.getNodeCount(); u++) {
+			long long balance = 0;
+			for (ResidualGraph::ArcId arc = network.begin(u); arc < network.end(u); arc++) {
+				if (network.getResidual(arc) < 0)
+					return false;
+				if (network.getEdgeId(arc) != ResidualGraph::NO_EDGE)
+					balance -= network.getFlow(arc);
+				else
+					balance += network.getResidual(arc);
+			}
+			if (balance != (u == source ? -flow : u == sink ? flow : 0))
+				return false;
+		}
+		return true;
+	}
+}
+
+/**
+ * \brief Teste 1: Comparação com o Edmonds-Karp em grafos aleatórios pequenos
+ */
+BOOST_AUTO_TEST_CASE(TestParallelPushRelabelMatchesEdmondKarp)
+{
+	std::mt19937 random(17);
+	ThreadPool pool(4);
+
+	for (int round = 0; round < 100; round++) {
+		std::size_t nodeCount = 2 + random() % 30;
+		std::size_t edgeCount = random() % (4 * nodeCount);
+
+		std::vector<GraphNode> storage;
+		storage.reserve(nodeCount);
+		for (std::size_t i = 0; i < nodeCount; i++)
+			storage.emplace_back(i);
+		for (std::size_t i = 0; i < edgeCount; i++)
+			storage[random() % nodeCount].connect(&storage[random() % nodeCount], static_cast<int>(random() % 20));
+
+		std::vector<GraphNode*> nodes;
+		for (GraphNode& node : storage)
+			nodes.push_back(&node);
+		Graph graph(nodes);
+
+		ResidualGraph expected(&graph);
+		ResidualGraph actual(&graph);
+		ResidualGraph::NodeId sink = static_cast<ResidualGraph::NodeId>(nodeCount - 1);
+
+		int expectedFlow = Algorithms::EdmondKarp(expected, 0, sink);
+		int actualFlow = Algorithms::ParallelPushRelabel(actual, 0, sink, pool);
+		BOOST_CHECK_EQUAL(expectedFlow, actualFlow);
+		BOOST_CHECK(isValidFlow(actual, 0, sink, actualFlow));
+	}
+}
+
+/**
+ * \brief Teste 2: Rede elétrica com vários milhares de nós e número variável de threads
+ *
+ * A super origem tem arestas de capacidade INT_MAX, e o excesso que não chega aos
+ * consumidores precisa ser devolvido a ela na segunda fase.
+ */
+BOOST_AUTO_TEST_CASE(TestParallelPushRelabelLargeNetwork)
+{
+	std::mt19937 random(3);
+	const std::size_t nodeCount = 5000;
+	NetworkBuilder builder(nodeCount, 4 * nodeCount);
+	for (std::size_t index = 1; index <= nodeCount; index++)
+		builder.defineNode(index, index % 50 == 0 ? 0 : static_cast<int>(random() % 30));
+	for (std::size_t e = 0; e < 4 * nodeCount; e++)
+		builder.addEdge(random() % nodeCount + 1, random() % nodeCount + 1, static_cast<int>(random() % 100));
+	Network network = builder.build();
+	ResidualGraph::NodeId sink = static_cast<ResidualGraph::NodeId>(network.getSinkIndex());
+
+	ResidualGraph expected(network);
+	int expectedFlow = Algorithms::Dinic(expected, 0, sink);
+
+	for (std::size_t threads : { 1, 2, 8 }) {
+		ResidualGraph actual(network);
+		int actualFlow = Algorithms::ParallelPushRelabel(actual, 0, sink, threads);
+		BOOST_CHECK_EQUAL(expectedFlow, actualFlow);
+		BOOST_CHECK(isValidFlow(actual, 0, sink, actualFlow));
+	}
+}
@@ -0,0 +1,222 @@
+#include <boost/test/unit_test.hpp>
+
+#include <cmath>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "Algorithms.h"
+#include "Network.h"
+#include "NetworkParser.h"
+#include "ParametricMaxFlow.h"
+#include "ResidualGraph.h"
+
+namespace {
+	std::vector<ParametricMaxFlow::MaxFlowAlgorithm> algorithms() {
+		return {
+			[](ParametricMaxFlow::Graph& graph, ParametricMaxFlow::Graph::NodeId source, ParametricMaxFlow::Graph::NodeId sink) {
+				return Algorithms::Dinic(graph, source, sink); },
+			[](ParametricMaxFlow::Graph& graph, ParametricMaxFlow::Graph::NodeId source, ParametricMaxFlow::Graph::NodeId sink) {
+				return Algorithms::EdmondKarp(graph, source, sink); },
+			[](ParametricMaxFlow::Graph& graph, ParametricMaxFlow::Graph::NodeId source, ParametricMaxFlow::Graph::NodeId sink) {
+				return Algorithms::PushRelabel(graph, source, sink); },
+			[](ParametricMaxFlow::Graph& graph, ParametricMaxFlow::Graph::NodeId source, ParametricMaxFlow::Graph::NodeId sink) {
+				return Algorithms::CapacityScaling(graph, source, sink); },
+		};
+	}
+
+	/**
+	 * \brief Rede aleatória de 2 a 21 nós, com um gerador a cada três nós.
+	 */
+	Network randomNetwork(std::mt19937& random) {
+		std::size_t nodeCount = 2 + random() % 20;
+		std::size_t edgeCount = random() % (3 * nodeCount);
+		NetworkBuilder builder(nodeCount, edgeCount);
+		for (std::size_t index = 1; index <= nodeCount; index++)
+			builder.defineNode(index, index % 3 == 1 ? 0 : static_cast<int>(1 + random() % 20));
+		for (std::size_t e = 0; e < edgeCount; e++)
+			builder.addEdge(random() % nodeCount + 1, random() % nodeCount + 1, static_cast<int>(random() % 30));
+		return builder.build();
+	}
+
+	/**
+	 * \brief Fluxo máximo calculado do zero, com as demandas de 'network' multiplicadas por 'lambda'.
+	 */
+	std::int64_t coldMaxFlow(const Network& network, double lambda) {
+		// Um consumidor com demanda zero viraria gerador, então a rede não é montada de novo:
+		// só as arestas do super sumidouro, as últimas, mudam de capacidade.
+		BasicResidualGraph<std::int64_t> graph(network);
+		std::size_t edge = network.getEdgeCount() + network.getGenerators().size();
+		for (std::size_t index = 1; index <= network.getNodeCount(); index++)
+			if (network.getDemand(index) > 0)
+				graph.setCapacity(graph.getEdgeArc(edge++), static_cast<std::int64_t>(std::floor(lambda * network.getDemand(index))));
+		return Algorithms::Dinic(graph, 0, static_cast<BasicResidualGraph<std::int64_t>::NodeId>(network.getSinkIndex()));
+	}
+
+	/**
+	 * \brief Fluxo máximo com as demandas de 'network' multiplicadas por 'lambda', sem arredondamento.
+	 */
+	double fractionalMaxFlow(const Network& network, double lambda) {
+		BasicResidualGraph<double> graph(network);
+		std::size_t edge = network.getEdgeCount() + network.getGenerators().size();
+		for (std::size_t index = 1; index <= network.getNodeCount(); index++)
+			if (network.getDemand(index) > 0)
+				graph.setCapacity(graph.getEdgeArc(edge++), lambda * network.getDemand(index));
+		return Algorithms::Dinic(graph, 0, static_cast<BasicResidualGraph<double>::NodeId>(network.getSinkIndex()));
+	}
+}
+
+/**
+ * \brief Teste 1: Curva de uma rede pequena
+ *
+ * O gerador 1 alimenta os consumidores 2 e 3, de demanda 5 cada, por conexões de capacidade 4
+ * e 10. A conexão 1 -> 2 satura em 'lambda' = 0.8 e o consumidor 3, em 'lambda' = 2.
+ * Esperado: inclinações 10, 5 e 0, e mudanças em (0.8, 8) e (2, 14)
+ */
+BOOST_AUTO_TEST_CASE(TestParametricMaxFlowBreakpoints)
+{
+	std::string text = "3 2\n1 0\n2 5\n3 5\n1 2 4\n1 3 10\n";
+	Network network = NetworkParser::parseBuffer(text.data(), text.size());
+
+	ParametricMaxFlow parametric(network, algorithms()[0]);
+	std::vector<ParametricPoint> points = parametric.sweep({ 3, 0, 1, 0.5, 2, 1.5, 2.5 });
+	BOOST_REQUIRE(points.size() == 7);
+	std::vector<std::int64_t> flows{ 0, 4, 9, 11, 14, 14, 14 };
+	std::vector<std::int64_t> slopes{ 10, 10, 5, 5, 0, 0, 0 };
+	for (std::size_t i = 0; i < points.size(); i++) {
+		BOOST_CHECK(points[i].lambda == 0.5 * static_cast<double>(i));
+		BOOST_CHECK(points[i].maxFlow == flows[i]);
+		BOOST_CHECK(points[i].demand == 2 * static_cast<std::int64_t>(5 * points[i].lambda));
+		BOOST_CHECK(points[i].cutSlope == slopes[i]);
+	}
+
+	std::vector<ParametricBreakpoint> breakpoints = parametric.breakpoints(0, 3);
+	BOOST_REQUIRE(breakpoints.size() == 2);
+	BOOST_CHECK_CLOSE(breakpoints[0].lambda, 0.8, 1e-9);
+	BOOST_CHECK_CLOSE(breakpoints[0].maxFlow, 8, 1e-9);
+	BOOST_CHECK_CLOSE(breakpoints[1].lambda, 2, 1e-9);
+	BOOST_CHECK_CLOSE(breakpoints[1].maxFlow, 14, 1e-9);
+
+	// Os fatores só podem crescer.
+	BOOST_CHECK_THROW(parametric.solve(2.5), std::runtime_error);
+	BOOST_CHECK_THROW(parametric.solve(ParametricMaxFlow::MAX_LAMBDA * 2), std::runtime_error);
+	BOOST_CHECK(parametric.solve(3).maxFlow == 14);
+}
+
+/**
+ * \brief Teste 2: Listas de fatores
+ */
+BOOST_AUTO_TEST_CASE(TestParametricMaxFlowParseLambdas)
+{
+	BOOST_CHECK((ParametricMaxFlow::parseLambdas("1.5,0,2") == std::vector<double>{ 1.5, 0, 2 }));
+	BOOST_CHECK((ParametricMaxFlow::parseLambdas("0:1:0.25") == std::vector<double>{ 0, 0.25, 0.5, 0.75, 1 }));
+	BOOST_CHECK(ParametricMaxFlow::parseLambdas("0:1:0.1").size() == 11);
+	BOOST_CHECK(ParametricMaxFlow::parseLambdas("0:1:0.3").back() == 0.8999999999999999);
+
+	for (std::string text : { "", "1,", ",1", "a", "1:2", "2:1:1", "0:1:0", "0:1:-1", "0:1e9:1e-9", "1:2:x" })
+		BOOST_CHECK_THROW(ParametricMaxFlow::parseLambdas(text), std::runtime_error);
+}
+
+/**
+ * \brief Teste 3: Redes aleatórias
+ *
+ * Cada ponto da varredura, que parte do fluxo do ponto anterior, tem o mesmo fluxo máximo que a
+ * rede com as demandas multiplicadas resolvida do zero, e o valor da reta do corte no ponto é o
+ * próprio fluxo máximo.
+ */
+BOOST_AUTO_TEST_CASE(TestParametricMaxFlowRandom)
+{
+	std::mt19937 random(24);
+	std::vector<double> lambdas = ParametricMaxFlow::parseLambdas("0:3:0.3");
+	for (int round = 0; round < 30; round++) {
+		Network network = randomNetwork(random);
+
+		std::vector<std::int64_t> expected;
+		for (double lambda : lambdas)
+			expected.push_back(coldMaxFlow(network, lambda));
+		for (const ParametricMaxFlow::MaxFlowAlgorithm& algorithm : algorithms()) {
+			ParametricMaxFlow parametric(network, algorithm);
+			std::vector<ParametricPoint> points = parametric.sweep(lambdas);
+			for (std::size_t i = 0; i < points.size(); i++) {
+				BOOST_REQUIRE(points[i].maxFlow == expected[i]);
+				BOOST_REQUIRE(points[i].maxFlow <= points[i].demand);
+				BOOST_REQUIRE(i == 0 || points[i].cutSlope <= points[i - 1].cutSlope);
+			}
+		}
+	}
+}
+
+/**
+ * \brief Teste 4: Várias mudanças entre dois pontos
+ *
+ * Os consumidores 2, 3 e 4, de demandas 3, 5 e 5, recebem do gerador 1 por conexões de
+ * capacidade 1, 4 e 10, que saturam em 'lambda' = 1/3, 0.8 e 2. A varredura só tem os pontos 0 e
+ * 3, mas as mudanças não dependem dos pontos.
+ * Esperado: mudanças em (1/3, 13/3), (0.8, 9) e (2, 15), e só a do meio entre 0.5 e 1
+ */
+BOOST_AUTO_TEST_CASE(TestParametricMaxFlowBreakpointsBetweenPoints)
+{
+	std::string text = "4 3\n1 0\n2 3\n3 5\n4 5\n1 2 1\n1 3 4\n1 4 10\n";
+	Network network = NetworkParser::parseBuffer(text.data(), text.size());
+
+	for (const ParametricMaxFlow::MaxFlowAlgorithm& algorithm : algorithms()) {
+		ParametricMaxFlow parametric(network, algorithm);
+		std::vector<ParametricPoint> points = parametric.sweep({ 0, 3 });
+		BOOST_REQUIRE(points[1].maxFlow == 15);
+
+		std::vector<ParametricBreakpoint> breakpoints = parametric.breakpoints(0, 3);
+		BOOST_REQUIRE(breakpoints.size() == 3);
+		BOOST_CHECK_CLOSE(breakpoints[0].lambda, 1.0 / 3, 1e-9);
+		BOOST_CHECK_CLOSE(breakpoints[0].maxFlow, 13.0 / 3, 1e-9);
+		BOOST_CHECK_CLOSE(breakpoints[1].lambda, 0.8, 1e-9);
+		BOOST_CHECK_CLOSE(breakpoints[1].maxFlow, 9, 1e-9);
+		BOOST_CHECK_CLOSE(breakpoints[2].lambda, 2, 1e-9);
+		BOOST_CHECK_CLOSE(breakpoints[2].maxFlow, 15, 1e-9);
+
+		breakpoints = parametric.breakpoints(0.5, 1);
+		BOOST_REQUIRE(breakpoints.size() == 1);
+		BOOST_CHECK_CLOSE(breakpoints[0].lambda, 0.8, 1e-9);
+	}
+}
+
+/**
+ * \brief Teste 5: Mudanças de redes aleatórias
+ *
+ * A curva sem arredondamento, calculada com capacidades reais, passa por cada mudança, é uma
+ * reta entre duas mudanças vizinhas (e entre as pontas do intervalo e as mudanças mais
+ * próximas) e muda de inclinação em cada mudança que não é uma ponta.
+ */
+BOOST_AUTO_TEST_CASE(TestParametricMaxFlowBreakpointsRandom)
+{
+	std::mt19937 random(23);
+	for (int round = 0; round < 30; round++) {
+		Network network = randomNetwork(random);
+
+		for (const ParametricMaxFlow::MaxFlowAlgorithm& algorithm : algorithms()) {
+			std::vector<ParametricBreakpoint> breakpoints = ParametricMaxFlow(network, algorithm).breakpoints(0.5, 3);
+			// As pontas do intervalo também podem ser mudanças.
+			std::vector<std::pair<double, double>> curve;
+			if (breakpoints.empty() || breakpoints.front().lambda > 0.5)
+				curve.emplace_back(0.5, fractionalMaxFlow(network, 0.5));
+			for (const ParametricBreakpoint& breakpoint : breakpoints) {
+				BOOST_REQUIRE(curve.empty() || breakpoint.lambda > curve.back().first);
+				BOOST_REQUIRE(std::abs(breakpoint.maxFlow - fractionalMaxFlow(network, breakpoint.lambda)) < 1e-6);
+				curve.emplace_back(breakpoint.lambda, breakpoint.maxFlow);
+			}
+			if (curve.back().first < 3)
+				curve.emplace_back(3, fractionalMaxFlow(network, 3));
+
+			for (std::size_t i = 1; i < curve.size(); i++) {
+				auto [left, leftFlow] = curve[i - 1];
+				auto [right, rightFlow] = curve[i];
+				BOOST_REQUIRE(std::abs(fractionalMaxFlow(network, (left + right) / 2) - (leftFlow + rightFlow) / 2) < 1e-6);
+				if (i + 1 < curve.size()) {
+					auto [next, nextFlow] = curve[i + 1];
+					BOOST_REQUIRE(std::abs((rightFlow - leftFlow) / (right - left) - (nextFlow - rightFlow) / (next - right)) > 1e-6);
+				}
+			}
+		}
+	}
+}
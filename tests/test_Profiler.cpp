@@ -0,0 +1,72 @@
+#include <boost/test/unit_test.hpp>
+
+#include <sstream>
+#include <string>
+
+#include "Algorithms.h"
+#include "Network.h"
+#include "Profiler.h"
+#include "ResidualGraph.h"
+
+/**
+ * \brief Teste 1: Fases acumuladas e formato do resumo
+ */
+BOOST_AUTO_TEST_CASE(TestProfilerPhases)
+{
+	Profiler::reset();
+	Profiler::addPhase("parse", 1.5);
+	Profiler::addPhase("solve", 2.0);
+	Profiler::addPhase("parse", 0.5);
+	{
+		Profiler::ScopedPhase phase("report");
+	}
+
+	std::ostringstream json;
+	Profiler::writeJson(json);
+	std::string text = json.str();
+	BOOST_TEST(text.find("\"parse\": 2") != std::string::npos);
+	BOOST_TEST(text.find("\"solve\": 2") != std::string::npos);
+	BOOST_TEST(text.find("\"report\": ") != std::string::npos);
+	BOOST_TEST(text.find("\"parse\"") < text.find("\"solve\""));
+	BOOST_TEST(text.find(Profiler::enabled ? "\"instrumented\": true" : "\"instrumented\": false") != std::string::npos);
+	BOOST_TEST((text.find("\"counters\"") != std::string::npos) == Profiler::enabled);
+	Profiler::reset();
+}
+
+/**
+ * \brief Teste 2: Contadores do Edmonds-Karp
+ *
+ * Dois caminhos disjuntos de três arcos (origem -> gerador -> consumidor -> sumidouro), e uma
+ * última busca sem sucesso. Sem 'METALMAX_PROFILE' os contadores ficam em zero.
+ */
+BOOST_AUTO_TEST_CASE(TestProfilerCounters)
+{
+	NetworkBuilder builder(4, 2);
+	builder.defineNode(1, 0);
+	builder.defineNode(2, 0);
+	builder.defineNode(3, 4);
+	builder.defineNode(4, 6);
+	builder.addEdge(1, 3, 10);
+	builder.addEdge(2, 4, 10);
+	Network network = builder.build();
+
+	Profiler::reset();
+	ResidualGraph graph(network);
+	BOOST_TEST(Algorithms::EdmondKarp(graph, 0, 5) == 10);
+
+	if constexpr (Profiler::enabled) {
+		BOOST_TEST(Profiler::get(Profiler::Counter::BfsCalls) == 3);
+		BOOST_TEST(Profiler::get(Profiler::Counter::AugmentingPaths) == 2);
+		BOOST_TEST(Profiler::get(Profiler::Counter::EdgesScanned) > 0);
+
+		std::ostringstream json;
+		Profiler::writeJson(json);
+		BOOST_TEST(json.str().find("\"path_length\": { \"count\": 2, \"sum\": 6, \"min\": 3, \"max\": 3") != std::string::npos);
+		BOOST_TEST(json.str().find("\"bottleneck\": { \"count\": 2, \"sum\": 10, \"min\": 4, \"max\": 6") != std::string::npos);
+	}
+	else {
+		BOOST_TEST(Profiler::get(Profiler::Counter::BfsCalls) == 0);
+		BOOST_TEST(Profiler::get(Profiler::Counter::AugmentingPaths) == 0);
+	}
+	Profiler::reset();
+}
@@ -0,0 +1,100 @@
+#include <boost/test/unit_test.hpp>
+
+#include <random>
+
+#include "Graph.h"
+#include "GraphNode.h"
+#include "ResidualGraph.h"
+#include "Algorithms.h"
+
+/**
+ * \brief Teste 1: Grafo com múltiplos caminhos
+ *
+ * Mesmo grafo do teste de Edmonds-Karp:
+ *   (S) --10--> (1) --5--> (3) --10--> (T)
+ *    \                       ^
+ *     \--10--> (2) --5------/
+ *
+ * Esperado: Fluxo máximo = 10
+ */
+BOOST_AUTO_TEST_CASE(TestPushRelabelMultiplePaths)
+{
+	GraphNode nodeS(0);
+	GraphNode node1(1);
+	GraphNode node2(2);
+	GraphNode node3(3);
+	GraphNode nodeT(4);
+
+	nodeS.connect(&node1, 10);
+	nodeS.connect(&node2, 10);
+	node1.connect(&node3, 5);
+	node2.connect(&node3, 5);
+	node3.connect(&nodeT, 10);
+
+	Graph graph({ &nodeS, &node1, &node2, &node3, &nodeT });
+
+	int maxFlow = Algorithms::PushRelabel(&graph, &nodeS, &nodeT);
+	BOOST_CHECK(maxFlow == 10);
+
+	// A aresta 3->T (após os reversos de 1->3 e 2->3) termina com o fluxo igual a 10,
+	// ou seja, sem capacidade residual.
+	BOOST_CHECK(node3.getEdges()[2].getFlow() == 0);
+}
+
+/**
+ * \brief Teste 2: Comparação com o Edmonds-Karp em grafos aleatórios
+ *
+ * Para cada grafo gerado, o valor do fluxo deve ser o mesmo dos dois algoritmos e o
+ * resultado do push-relabel deve ser um fluxo válido (conservação em todos os nós
+ * intermediários e nenhuma capacidade residual negativa).
+ */
+BOOST_AUTO_TEST_CASE(TestPushRelabelMatchesEdmondKarp)
+{
+	std::mt19937 random(42);
+
+	for (int round = 0; round < 50; round++) {
+		std::size_t nodeCount = 2 + random() % 30;
+		std::size_t edgeCount = random() % (4 * nodeCount);
+
+		std::vector<GraphNode> storage;
+		storage.reserve(nodeCount);
+		for (std::size_t i = 0; i < nodeCount; i++)
+			storage.emplace_back(i);
+		for (std::size_t i = 0; i < edgeCount; i++) {
+			std::size_t u = random() % nodeCount;
+			std::size_t v = random() % nodeCount;
+			if (u != v)
+				storage[u].connect(&storage[v], static_cast<int>(random() % 20));
+		}
+
+		std::vector<GraphNode*> nodes;
+		for (GraphNode& node : storage)
+			nodes.push_back(&node);
+		Graph graph(nodes);
+
+		ResidualGraph expected(&graph);
+		ResidualGraph actual(&graph);
+		ResidualGraph::NodeId sink = static_cast<ResidualGraph::NodeId>(nodeCount - 1);
+
+		int expectedFlow = Algorithms::EdmondKarp(expected, 0, sink);
+		int actualFlow = Algorithms::PushRelabel(actual, 0, sink);
+		BOOST_CHECK_EQUAL(expectedFlow, actualFlow);
+
+		for (ResidualGraph::NodeId u = 0; u < actual.getNodeCount(); u++) {
+			int balance = 0;
+			for (ResidualGraph::ArcId arc = actual.begin(u); arc < actual.end(u); arc++) {
+				BOOST_CHECK(actual.getResidual(arc) >= 0);
+				if (actual.getEdgeId(arc) != ResidualGraph::NO_EDGE)
+					balance -= actual.getFlow(arc);
+				else
+					balance += actual.getResidual(arc);
+			}
+			if (u == 0)
+				BOOST_CHECK_EQUAL(balance, -actualFlow);
+			else if (u == sink)
+				BOOST_CHECK_EQUAL(balance, actualFlow);
+			else
+				BOOST_CHECK_EQUAL(balance, 0);
+		}
+	}
+}
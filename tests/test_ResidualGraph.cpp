@@ -0,0 +1,113 @@
+#include <boost/test/unit_test.hpp>
+
+#include "Graph.h"
+#include "GraphNode.h"
+#include "ResidualGraph.h"
+#include "Algorithms.h"
+
+/**
+ * \brief Teste 1: Estrutura da rede residual
+ *
+ * Grafo (S) --7--> (1) --3--> (T). Cada aresta gera um arco direto e um reverso,
+ * e os arcos de cada nó ficam contíguos.
+ */
+BOOST_AUTO_TEST_CASE(TestResidualGraphLayout)
+{
+	GraphNode nodeS(0);
+	GraphNode node1(1);
+	GraphNode nodeT(2);
+
+	nodeS.connect(&node1, 7);
+	node1.connect(&nodeT, 3);
+
+	Graph graph({ &nodeS, &node1, &nodeT });
+	ResidualGraph network(&graph);
+
+	BOOST_CHECK(network.getNodeCount() == 3);
+	BOOST_CHECK(network.getEdgeCount() == 2);
+	BOOST_CHECK(network.getArcCount() == 4);
+
+	// O nó 1 possui o reverso de S->1 e o arco direto 1->T.
+	ResidualGraph::NodeId u = network.getNodeId(1);
+	BOOST_CHECK(network.end(u) - network.begin(u) == 2);
+
+	for (ResidualGraph::ArcId arc = 0; arc < network.getArcCount(); arc++) {
+		BOOST_CHECK(network.getReverse(network.getReverse(arc)) == arc);
+		BOOST_CHECK(network.getResidual(arc) == network.getCapacity(arc));
+	}
+}
+
+/**
+ * \brief Teste 2: Cancelamento de fluxo pelos arcos reversos
+ *
+ * Estrutura:
+ *   (S) --1--> (1) --1--> (3) --1--> (T)
+ *    \          \                    ^
+ *     \          \--1--> (4) --1----/
+ *      \--1--> (2) --1--> (3)
+ *
+ * A BFS encontra primeiro S->1->3->T; o segundo caminho S->2->3->1->4->T só existe
+ * se o fluxo em 1->3 puder ser cancelado pelo arco reverso.
+ * Esperado: Fluxo máximo = 2
+ */
+BOOST_AUTO_TEST_CASE(TestFlowCancellation)
+{
+	GraphNode nodeS(0);
+	GraphNode node1(1);
+	GraphNode node2(2);
+	GraphNode node3(3);
+	GraphNode node4(4);
+	GraphNode nodeT(5);
+
+	nodeS.connect(&node1, 1);
+	nodeS.connect(&node2, 1);
+	node1.connect(&node3, 1);
+	node1.connect(&node4, 1);
+	node2.connect(&node3, 1);
+	node3.connect(&nodeT, 1);
+	node4.connect(&nodeT, 1);
+
+	Graph graph({ &nodeS, &node1, &node2, &node3, &node4, &nodeT });
+
+	int maxFlow = Algorithms::EdmondKarp(&graph, &nodeS, &nodeT);
+	BOOST_CHECK(maxFlow == 2);
+
+	// As arestas que chegam em T ficam sem capacidade residual. Os nós 3 e 4 guardam antes
+	// as arestas reversas das conexões que chegam a eles.
+	BOOST_CHECK(node3.getEdges()[2].getTarget() == &nodeT);
+	BOOST_CHECK(node3.getEdges()[2].getFlow() == 0);
+	BOOST_CHECK(node4.getEdges()[1].getTarget() == &nodeT);
+	BOOST_CHECK(node4.getEdges()[1].getFlow() == 0);
+}
+
+/**
+ * \brief Teste 3: Arestas reversas na adjacência dos nós
+ *
+ * 'connect' cria a aresta reversa no nó de destino, e após o fluxo máximo a aresta
+ * reversa guarda o fluxo que passa pela aresta direta.
+ */
+BOOST_AUTO_TEST_CASE(TestReverseEdgesInAdjacency)
+{
+	GraphNode nodeS(0);
+	GraphNode nodeT(1);
+
+	nodeS.connect(&nodeT, 10);
+	nodeS.connect(&nodeT, 5);
+
+	BOOST_CHECK(nodeS.getEdges().size() == 2);
+	BOOST_CHECK(nodeT.getEdges().size() == 2);
+	BOOST_CHECK(nodeT.getEdges()[0].isReverse());
+	BOOST_CHECK(nodeT.isConnected(&nodeS) == false);
+
+	for (GraphEdge& edge : nodeS.getEdges()) {
+		BOOST_CHECK(!edge.isReverse());
+		BOOST_CHECK(edge.getReverse()->getTarget() == &nodeS);
+		BOOST_CHECK(edge.getReverse()->getReverse() == &edge);
+	}
+
+	Graph graph({ &nodeS, &nodeT });
+	int maxFlow = Algorithms::EdmondKarp(&graph, &nodeS, &nodeT);
+	BOOST_CHECK(maxFlow == 15);
+	BOOST_CHECK(nodeS.getEdges()[0].getReverse()->getFlow() == 10);
+	BOOST_CHECK(nodeS.getEdges()[1].getReverse()->getFlow() == 5);
+}
@@ -0,0 +1,154 @@
+#include <boost/test/unit_test.hpp>
+
+#include <random>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "Algorithms.h"
+#include "Network.h"
+#include "ResidualGraph.h"
+#include "ScenarioBatch.h"
+#include "TestNetworks.h"
+#include "ThreadPool.h"
+
+namespace {
+	/**
+	 * \brief Fluxo máximo da rede com as alterações do cenário, montada e resolvida do zero.
+	 */
+	int solveFromScratch(const Network& network, const Scenario& scenario) {
+		std::vector<int> demands(network.getDemands().begin(), network.getDemands().end());
+		std::vector<int> capacities(network.getEdgeCapacities().begin(), network.getEdgeCapacities().end());
+		for (const NetworkEdit& edit : scenario.edits) {
+			if (edit.type == NetworkEdit::Type::Demand)
+				demands[edit.first] = edit.value;
+			else
+				capacities[edit.first] = edit.value;
+		}
+
+		// Um consumidor com demanda zero não pode virar gerador; ele apenas perde a aresta do sumidouro.
+		NetworkBuilder builder(network.getNodeCount(), network.getEdgeCount());
+		for (std::size_t index = 1; index <= network.getNodeCount(); index++)
+			builder.defineNode(index, network.getDemand(index) == 0 ? 0 : 1);
+		for (std::size_t e = 0; e < network.getEdgeCount(); e++)
+			builder.addEdge(network.getEdgeSource(e), network.getEdgeTarget(e), capacities[e]);
+		Network edited = builder.build();
+
+		ResidualGraph graph(edited);
+		std::size_t sinkEdge = network.getEdgeCount() + network.getGenerators().size();
+		for (std::size_t index = 1; index <= network.getNodeCount(); index++)
+			if (network.getDemand(index) > 0)
+				graph.setCapacity(graph.getEdgeArc(sinkEdge++), demands[index]);
+		return Algorithms::EdmondKarp(graph, 0, static_cast<ResidualGraph::NodeId>(edited.getSinkIndex()));
+	}
+}
+
+/**
+ * \brief Teste 1: Cada cenário confere com a rede alterada resolvida do zero
+ *
+ * Os cenários passam pelo formato texto, são resolvidos em paralelo e escritos na ordem da
+ * entrada; as capacidades de cada cenário não vazam para os seguintes.
+ */
+BOOST_AUTO_TEST_CASE(TestScenarioBatchMatchesFullSolves)
+{
+	std::mt19937 random(15);
+	ThreadPool pool(4);
+	for (int round = 0; round < 10; round++) {
+		Network network = TestNetworks::randomNetwork(random, 30);
+
+		std::ostringstream text;
+		for (int s = 0; s < 40; s++) {
+			text << "cenario c" << s << '\n';
+			for (int k = 0; k < 3; k++) {
+				std::size_t consumer = 4 + random() % 9;
+				text << "demanda " << consumer << ' ' << random() % 30 << '\n';
+				std::size_t edge = random() % network.getEdgeCount();
+				text << "capacidade " << network.getEdgeSource(edge) << ' ' << network.getEdgeTarget(edge) << ' ' << random() % 20 << '\n';
+			}
+		}
+
+		std::istringstream in(text.str());
+		ScenarioReader reader(in, network);
+		std::vector<Scenario> scenarios;
+		for (Scenario scenario; reader.next(scenario);)
+			scenarios.push_back(scenario);
+		BOOST_REQUIRE(scenarios.size() == 40);
+
+		std::istringstream again(text.str());
+		ScenarioReader batchReader(again, network);
+		ScenarioBatch batch(network, [](ResidualGraph& graph, ResidualGraph::NodeId source, ResidualGraph::NodeId sink) {
+			return Algorithms::Dinic(graph, source, sink); }, pool);
+		std::ostringstream out;
+		BOOST_REQUIRE(batch.run(batchReader, out) == 40);
+
+		std::istringstream lines(out.str());
+		for (const Scenario& scenario : scenarios) {
+			std::string name;
+			int maxFlow;
+			std::int64_t unmetDemand;
+			BOOST_REQUIRE(lines >> name >> maxFlow >> unmetDemand);
+			BOOST_REQUIRE(name == scenario.name);
+			BOOST_REQUIRE(maxFlow == solveFromScratch(network, scenario));
+		}
+	}
+}
+
+/**
+ * \brief Teste 2: Demanda não atendida com alterações repetidas do mesmo consumidor
+ */
+BOOST_AUTO_TEST_CASE(TestScenarioBatchUnmetDemand)
+{
+	NetworkBuilder builder(3, 2);
+	builder.defineNode(1, 0);
+	builder.defineNode(2, 10);
+	builder.defineNode(3, 5);
+	builder.addEdge(1, 2, 8);
+	builder.addEdge(1, 3, 8);
+	Network network = builder.build();
+
+	ThreadPool pool(2);
+	ScenarioBatch batch(network, [](ResidualGraph& graph, ResidualGraph::NodeId source, ResidualGraph::NodeId sink) {
+		return Algorithms::EdmondKarp(graph, source, sink); }, pool);
+
+	Scenario scenario{ "s", { NetworkEdit::setDemand(2, 20), NetworkEdit::setDemand(2, 7), NetworkEdit::setCapacity(1, 2) } };
+	ScenarioResult result = batch.solve(scenario, 0);
+	BOOST_TEST(result.maxFlow == 9);
+	BOOST_TEST(result.unmetDemand == 3);
+
+	ScenarioResult base = batch.solve({ "base", {} }, 0);
+	BOOST_TEST(base.maxFlow == 13);
+	BOOST_TEST(base.unmetDemand == 2);
+}
+
+/**
+ * \brief Teste 3: Erros de formato e referências inválidas
+ */
+BOOST_AUTO_TEST_CASE(TestScenarioReaderErrors)
+{
+	NetworkBuilder builder(3, 1);
+	builder.defineNode(1, 0);
+	builder.defineNode(2, 10);
+	builder.defineNode(3, 5);
+	builder.addEdge(1, 2, 8);
+	Network network = builder.build();
+
+	for (std::string text : { "demanda 2 3\n", "cenario a\ndemanda 1 3\n", "cenario a\ndemanda 4 3\n",
+		"cenario a\ncapacidade 2 1 3\n", "cenario a\ncapacidade 1 2 -1\n", "cenario a\nperda 1 2\n" }) {
+		std::istringstream in(text);
+		ScenarioReader reader(in, network);
+		Scenario scenario;
+		BOOST_CHECK_THROW(reader.next(scenario), std::runtime_error);
+	}
+
+	std::istringstream in("# comentário\n\ncenario a\n\ncenario b\ncapacidade 1 2 3\n");
+	ScenarioReader reader(in, network);
+	Scenario scenario;
+	BOOST_REQUIRE(reader.next(scenario));
+	BOOST_TEST(scenario.name == "a");
+	BOOST_TEST(scenario.edits.empty());
+	BOOST_REQUIRE(reader.next(scenario));
+	BOOST_TEST(scenario.name == "b");
+	BOOST_TEST(scenario.edits.size() == 1);
+	BOOST_TEST(!reader.next(scenario));
+}
@@ -0,0 +1,45 @@
+#include <boost/test/unit_test.hpp>
+
+#include <atomic>
+#include <stdexcept>
+#include <vector>
+
+#include "ThreadPool.h"
+
+/**
+ * \brief Teste 1: Cada índice é executado exatamente uma vez, em laços consecutivos
+ */
+BOOST_AUTO_TEST_CASE(TestThreadPoolParallelFor)
+{
+	ThreadPool pool(4);
+	BOOST_CHECK(pool.getThreadCount() == 4);
+
+	for (std::size_t count : { 0, 1, 7, 1000 }) {
+		std::vector<std::atomic<int>> calls(count);
+		std::atomic<bool> validThread = true;
+		pool.parallelFor(count, [&](std::size_t index, std::size_t thread) {
+			calls[index]++;
+			if (thread >= pool.getThreadCount())
+				validThread = false;
+		});
+		for (std::atomic<int>& call : calls)
+			BOOST_CHECK(call == 1);
+		BOOST_CHECK(validThread);
+	}
+}
+
+/**
+ * \brief Teste 2: A exceção de uma tarefa é relançada e o conjunto continua utilizável
+ */
+BOOST_AUTO_TEST_CASE(TestThreadPoolException)
+{
+	ThreadPool pool(3);
+	BOOST_CHECK_THROW(pool.parallelFor(100, [](std::size_t index, std::size_t) {
+		if (index == 42)
+			throw std::runtime_error("falha");
+	}), std::runtime_error);
+
+	std::atomic<std::size_t> sum = 0;
+	pool.parallelFor(10, [&](std::size_t index, std::size_t) { sum += index; });
+	BOOST_CHECK(sum == 45);
+}
@@ -54,11 +54,12 @@ std::string readFile(const std::string& filePath) {
  * e a sada capturada no arquivo de sada. Aps a execuo, os arquivos temporrios so removidos.
  *
  * \param input A string de entrada que ser passada para o programa.
+ * \param arguments Argumentos de linha de comando repassados ao programa.
  * \return A sada gerada pelo programa como uma string.
  *
  * \throws std::runtime_error Se o programa no puder ser executado ou se ocorrer erro na manipulao de arquivos.
  */
-std::string runProgram(const std::string& input) {
+std::string runProgram(const std::string& input, const std::string& arguments = "") {
 	const std::string executable = "./bin/run.out";
 
 	const std::string tempInput = "temp_input.txt";
@@ -68,7 +69,8 @@ std::string runProgram(const std::string& input) {
 	inputFile << input;
 	inputFile.close();
 
-	const std::string command = executable + " < " + tempInput + " > " + tempOutput;
+	const std::string command = executable + " " + arguments + " < " + tempInput + " > " + tempOutput;
+
 	int retCode = std::system(command.c_str());
 	if (retCode != 0) {
 		throw std::runtime_error("Erro ao executar o programa.");
@@ -161,7 +163,6 @@ BOOST_AUTO_TEST_CASE(IntegrationTest3) {
 		);
 	}
 }
-/*
 BOOST_AUTO_TEST_CASE(IntegrationTest4) {
 	namespace fs = std::filesystem;
 	const std::string inputsPath = "./tests/inputs";
@@ -194,4 +195,54 @@ BOOST_AUTO_TEST_CASE(IntegrationTest4) {
 			);
 		}
 	}
-}*/
\ No newline at end of file
+}
+
+// Roda os arquivos de teste com os demais algoritmos e compara as duas primeiras linhas: o fluxo
+// mximo e a demanda no atendida. A perda de energia e as conexes crticas dependem de qual
+// fluxo mximo foi encontrado, ento podem diferir das sadas de referncia.
+BOOST_AUTO_TEST_CASE(IntegrationTestAlgorithms) {
+	namespace fs = std::filesystem;
+	const std::string inputsPath = "./tests/inputs";
+	const std::string outputsPath = "./tests/outputs";
+
+	for (const std::string algorithm : { "push-relabel", "dinic", "parallel-push-relabel --threads=4" }) {
+		for (const auto& inputFile : fs::directory_iterator(inputsPath)) {
+			std::string inputFilePath = inputFile.path().string();
+			std::string outputFilePath = outputsPath + "/" + inputFile.path().filename().string();
+
+			std::string input = readFile(inputFilePath);
+			std::string expectedOutput = readFile(outputFilePath);
+			std::string actualOutput = runProgram(input, "--algorithm=" + algorithm);
+
+			std::vector<std::string> expectedLines = splitLines(expectedOutput);
+			std::vector<std::string> actualLines = splitLines(actualOutput);
+
+			BOOST_REQUIRE_MESSAGE(
+				actualLines.size() > 1,
+				"A sada gerada tem menos de duas linhas no arquivo: " + inputFilePath
+			);
+
+			for (size_t i = 0; i < 2; ++i) {
+				BOOST_CHECK_MESSAGE(
+					expectedLines[i] == actualLines[i],
+					"Falha na linha " + std::to_string(i + 1) + " (" + algorithm + ") para arquivo: " + inputFilePath +
+					"\nEsperado: " + expectedLines[i] +
+					"\nGerado: " + actualLines[i]
+				);
+			}
+		}
+	}
+}
+
+// Uma rede com mais de um fluxo mximo: o Edmonds-Karp e o push-relabel deixam capacidades
+// residuais diferentes nas conexes dos geradores, e s as duas primeiras linhas coincidem.
+BOOST_AUTO_TEST_CASE(IntegrationTestNonUniqueFlow) {
+	const std::string input = "6 6\n1 0\n3 0\n5 0\n6 19\n2 5\n4 18\n4 1 21\n2 3 24\n1 6 25\n3 1 19\n6 2 4\n6 5 7\n";
+
+	for (const std::string algorithm : { "edmonds-karp", "push-relabel", "dinic" }) {
+		std::vector<std::string> lines = splitLines(runProgram(input, "--algorithm=" + algorithm));
+		BOOST_REQUIRE_MESSAGE(lines.size() > 1, "A sada gerada tem menos de duas linhas (" + algorithm + ")");
+		BOOST_CHECK_MESSAGE(lines[0] == "23" && lines[1] == "19",
+			"Falha (" + algorithm + "): " + lines[0] + " " + lines[1]);
+	}
+}